@@ -5,6 +5,7 @@ TARGET = showmewhatyouspeak
 QT       += multimedia widgets
 
 SOURCES  += main.cpp \
+            audioringbuffer.cpp \
             engine.cpp \
             frequencyspectrum.cpp \
             helpers.cpp \
@@ -13,13 +14,15 @@ SOURCES  += main.cpp \
             spectrograph.cpp \
             spectrumanalyser.cpp
 
-HEADERS  += engine.h \
+HEADERS  += audioringbuffer.h \
+            engine.h \
             frequencyspectrum.h \
             helpers.h \
             mainwidget.h \
             settingsdialog.h \
             spectrograph.h \
-            spectrumanalyser.h
+            spectrumanalyser.h \
+            spscqueue.h
 
 INCLUDEPATH += ../fftreal
 DEPENDPATH += $${INCLUDEPATH}
@@ -0,0 +1,106 @@
+#include "audioringbuffer.h"
+
+#include <QIODevice>
+
+#include <atomic>
+#include <string.h>
+
+AudioRingBuffer::AudioRingBuffer()
+    :   m_data(0)
+    ,   m_capacity(0)
+    ,   m_reserved(0)
+    ,   m_end(0)
+{
+
+}
+
+AudioRingBuffer::~AudioRingBuffer()
+{
+    delete[] m_data;
+}
+
+void AudioRingBuffer::allocate(qint64 capacity)
+{
+    Q_ASSERT(capacity >= 0);
+
+    delete[] m_data;
+    m_data = 0;
+    m_capacity = capacity;
+    if (m_capacity > 0) {
+        m_data = new char[2 * m_capacity];
+        memset(m_data, 0, 2 * m_capacity);
+    }
+    clear();
+}
+
+void AudioRingBuffer::clear()
+{
+    m_reserved.storeRelease(0);
+    m_end.storeRelease(0);
+}
+
+qint64 AudioRingBuffer::startPosition() const
+{
+    return qMax(qint64(0), endPosition() - m_capacity);
+}
+
+bool AudioRingBuffer::contains(qint64 position, qint64 length) const
+{
+    return m_capacity > 0 && position >= 0 && length >= 0
+        && position >= m_reserved.loadAcquire() - m_capacity
+        && position + length <= endPosition();
+}
+
+qint64 AudioRingBuffer::write(QIODevice *device, qint64 maxLength)
+{
+    if (0 == m_capacity)
+        return 0;
+
+    qint64 end = m_end.load();
+    qint64 bytesWritten = 0;
+    while (bytesWritten < maxLength) {
+        const qint64 offset = end % m_capacity;
+        const qint64 chunk = qMin(maxLength - bytesWritten, m_capacity - offset);
+
+        // Readers must see the reservation before any overwritten byte
+        m_reserved.store(end + chunk);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        const qint64 bytesRead = device->read(m_data + offset, chunk);
+        if (bytesRead <= 0) {
+            m_reserved.storeRelease(end);
+            break;
+        }
+        memcpy(m_data + m_capacity + offset, m_data + offset, bytesRead);
+
+        end += bytesRead;
+        bytesWritten += bytesRead;
+        m_reserved.storeRelease(end);
+        m_end.storeRelease(end);
+
+        if (bytesRead < chunk)
+            break;
+    }
+
+    return bytesWritten;
+}
+
+const char *AudioRingBuffer::data(qint64 position, qint64 length) const
+{
+    if (!contains(position, length))
+        return 0;
+    return m_data + position % m_capacity;
+}
+
+bool AudioRingBuffer::read(char *dest, qint64 position, qint64 length) const
+{
+    const char *const src = data(position, length);
+    if (!src)
+        return false;
+
+    memcpy(dest, src, length);
+
+    // The copy must be complete before the writer's progress is checked
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return contains(position, length);
+}
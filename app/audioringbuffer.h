@@ -0,0 +1,92 @@
+#ifndef AUDIORINGBUFFER_H
+#define AUDIORINGBUFFER_H
+
+#include <QAtomicInteger>
+#include <QtCore/qglobal.h>
+
+QT_FORWARD_DECLARE_CLASS(QIODevice)
+
+/**
+ * Fixed-size history of the captured audio, addressed by absolute position.
+ *
+ * Positions count the bytes written since the last clear(); the buffer
+ * holds the last capacity() of them.  Writing never blocks nor allocates:
+ * the oldest data is simply overwritten.
+ *
+ * The storage holds two copies of the history, one after the other, so any
+ * window of up to capacity() bytes is contiguous in memory and can be read
+ * in place with data().
+ *
+ * There must be a single writer.  Readers may run on other threads: read()
+ * detects the windows overwritten while it copies them.
+ */
+class AudioRingBuffer
+{
+public:
+    AudioRingBuffer();
+    ~AudioRingBuffer();
+
+    /**
+     * Allocate the storage and empty the buffer.  Neither the writer nor
+     * readers may be using the buffer.
+     * \param capacity History depth in bytes, 0 to free the storage
+     */
+    void allocate(qint64 capacity);
+
+    /**
+     * Empty the buffer, positions restart from 0.  Neither the writer nor
+     * readers may be using the buffer.
+     */
+    void clear();
+
+    qint64 capacity() const { return m_capacity; }
+
+    /**
+     * Position following the newest byte, i.e. number of bytes written
+     * since the last clear().
+     */
+    qint64 endPosition() const { return m_end.loadAcquire(); }
+
+    /**
+     * Position of the oldest byte still held.
+     */
+    qint64 startPosition() const;
+
+    /**
+     * Whether the window is still held.
+     */
+    bool contains(qint64 position, qint64 length) const;
+
+    /**
+     * Writer side: read up to maxLength bytes from device into the buffer.
+     * \return Number of bytes read
+     */
+    qint64 write(QIODevice *device, qint64 maxLength);
+
+    /**
+     * Contiguous view of a window, or 0 if the window is not held.  The
+     * view is valid until the writer overwrites the window: from another
+     * thread, check contains() again once done with it.
+     */
+    const char *data(qint64 position, qint64 length) const;
+
+    /**
+     * Copy a window.
+     * \return false if the window is not held, or was overwritten during
+     *         the copy
+     */
+    bool read(char *dest, qint64 position, qint64 length) const;
+
+private:
+    Q_DISABLE_COPY(AudioRingBuffer)
+
+    char*                       m_data;     // 2 * m_capacity bytes
+    qint64                      m_capacity;
+
+    // The writer publishes m_reserved before it overwrites anything, and
+    // m_end once the new bytes are in place
+    QAtomicInteger<qint64>      m_reserved;
+    QAtomicInteger<qint64>      m_end;
+};
+
+#endif // AUDIORINGBUFFER_H
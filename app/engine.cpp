@@ -11,9 +11,11 @@
 #include <QSet>
 #include <QThread>
 
-const qint64 BufferDurationUs       = 60 * 1000000; //60 seconds
+const qint64 DefaultHistoryDurationUs = 60 * 1000000; //60 seconds
+const qint64 MaxHistoryDurationUs   = 10 * 60 * qint64(1000000); //10 minutes
 const int    NotifyIntervalMs       = 100;
 const int    LevelWindowUs          = 0.1 * 1000000;
+const qint64 DefaultAnalysisHopUs   = 10 * 1000; //10 ms
 
 Engine::Engine(QObject *parent)
     :   QObject(parent)
@@ -30,21 +32,25 @@ Engine::Engine(QObject *parent)
     ,   m_audioOutputDevice(QAudioDeviceInfo::defaultOutputDevice())
     ,   m_audioOutput(0)
     ,   m_playPosition(0)
-    ,   m_bufferPosition(0)
+    ,   m_historyDurationUs(DefaultHistoryDurationUs)
     ,   m_bufferLength(0)
     ,   m_dataLength(0)
+    ,   m_bufferNotifyPosition(0)
+    ,   m_playBufferPosition(0)
+    ,   m_analysisHopUs(DefaultAnalysisHopUs)
+    ,   m_analysisHopLength(0)
+    ,   m_nextAnalysisPosition(0)
     ,   m_levelBufferLength(0)
     ,   m_rmsLevel(0.0)
     ,   m_peakLevel(0.0)
     ,   m_spectrumBufferLength(0)
     ,   m_spectrumAnalyser()
-    ,   m_spectrumPosition(0)
     ,   m_count(0)
     ,   m_thresholdSilence(-30)
 {
     qRegisterMetaType<FrequencySpectrum>("FrequencySpectrum");
-    connect(&m_spectrumAnalyser, QOverload<const FrequencySpectrum&>::of(&SpectrumAnalyser::spectrumChanged),
-            this, QOverload<const FrequencySpectrum&>::of(&Engine::spectrumChanged));
+    connect(&m_spectrumAnalyser, &SpectrumAnalyser::spectrumChanged,
+            this, QOverload<qint64, const FrequencySpectrum&>::of(&Engine::spectrumChanged));
     connect(&m_spectrumAnalyser, &SpectrumAnalyser::baseFrequencyChanged,
             this, &Engine::baseFrequencyChanged);
 
@@ -61,6 +67,50 @@ Engine::Engine(QObject *parent)
             else
                 --i;
         }
+
+        if (arguments.at(i) == QStringLiteral("-fftlength")
+                || arguments.at(i) == QStringLiteral("--fft-length")) {
+            ++i;
+            if (i < arguments.count()) {
+                const int length = arguments.at(i).toInt();
+                if (!m_spectrumAnalyser.setLength(length))
+                    qWarning() << "Engine::Engine unsupported FFT length" << length;
+            } else {
+                --i;
+            }
+        }
+
+        if (arguments.at(i) == QStringLiteral("-history")
+                || arguments.at(i) == QStringLiteral("--history-seconds")) {
+            ++i;
+            if (i < arguments.count()) {
+                const int seconds = arguments.at(i).toInt();
+                if (seconds > 0 && qint64(seconds) * 1000000 <= MaxHistoryDurationUs)
+                    setHistoryDuration(qint64(seconds) * 1000000);
+                else
+                    qWarning() << "Engine::Engine invalid history duration" << arguments.at(i);
+            } else {
+                --i;
+            }
+        }
+
+        if (arguments.at(i) == QStringLiteral("-backlog")
+                || arguments.at(i) == QStringLiteral("--spectrum-backlog"))
+            m_spectrumAnalyser.setPolicy(SpectrumAnalyser::ProcessBacklog);
+
+        if (arguments.at(i) == QStringLiteral("-hop")
+                || arguments.at(i) == QStringLiteral("--hop-ms")) {
+            ++i;
+            if (i < arguments.count()) {
+                const int ms = arguments.at(i).toInt();
+                if (ms > 0)
+                    setAnalysisHop(qint64(ms) * 1000);
+                else
+                    qWarning() << "Engine::Engine invalid analysis hop" << arguments.at(i);
+            } else {
+                --i;
+            }
+        }
     }
 
     initialize();
@@ -77,11 +127,36 @@ bool Engine::initializeRecord()
     return initialize();
 }
 
+void Engine::setHistoryDuration(qint64 durationUs)
+{
+    // The history is held twice in memory, see AudioRingBuffer
+    if (durationUs > MaxHistoryDurationUs) {
+        qWarning() << "Engine::setHistoryDuration" << durationUs
+                   << "us is too long, clamped to" << MaxHistoryDurationUs;
+        durationUs = MaxHistoryDurationUs;
+    }
+    m_historyDurationUs = durationUs;
+}
+
+void Engine::setAnalysisHop(qint64 durationUs)
+{
+    m_analysisHopUs = durationUs;
+    m_analysisHopLength = audioLength(m_format, m_analysisHopUs);
+}
+
 qint64 Engine::bufferLength() const
 {
     return m_bufferLength;
 }
 
+QByteArray Engine::bufferView(qint64 position, qint64 length) const
+{
+    const char *const data = m_buffer.data(position, length);
+    if (!data)
+        return QByteArray();
+    return QByteArray::fromRawData(data, length);
+}
+
 void Engine::startRecording()
 {
     if (m_audioInput) {
@@ -92,7 +167,7 @@ void Engine::startRecording()
             m_spectrumAnalyser.cancelCalculation();
             spectrumChanged(0, 0, FrequencySpectrum());
 
-            m_buffer.fill(0);
+            m_buffer.clear();
             setRecordPosition(0, true);
             stopPlayback();
             m_mode = QAudio::AudioInput;
@@ -103,6 +178,8 @@ void Engine::startRecording()
 
             m_count = 0;
             m_dataLength = 0;
+            m_bufferNotifyPosition = 0;
+            m_nextAnalysisPosition = 0;
             emit dataLengthChanged(0);
             m_audioInputIODevice = m_audioInput->start();
             connect(m_audioInputIODevice, &QIODevice::readyRead,
@@ -130,8 +207,12 @@ void Engine::startPlayback()
                     this, &Engine::audioNotify);
 
             m_count = 0;
+            // Plays the history in place
+            m_playBufferPosition = m_buffer.startPosition();
+            const qint64 playLength = m_dataLength - m_playBufferPosition;
+            m_playBuffer = bufferView(m_playBufferPosition, playLength);
             m_audioOutputIODevice.close();
-            m_audioOutputIODevice.setBuffer(&m_buffer);
+            m_audioOutputIODevice.setBuffer(&m_playBuffer);
             m_audioOutputIODevice.open(QIODevice::ReadOnly);
             m_audioOutput->start(&m_audioOutputIODevice);
         }
@@ -179,29 +260,28 @@ void Engine::audioNotify()
     switch (m_mode)
     {
         case QAudio::AudioInput: {
-                const qint64 recordPosition = qMin(m_bufferLength, audioLength(m_format, m_audioInput->processedUSecs()));
+                const qint64 recordPosition = audioLength(m_format, m_audioInput->processedUSecs());
                 setRecordPosition(recordPosition);
-                const qint64 levelPosition = m_dataLength - m_levelBufferLength;
-                if (levelPosition >= 0)
-                    calculateLevel(levelPosition, m_levelBufferLength);
-                if (m_dataLength >= m_spectrumBufferLength) {
-                    const qint64 spectrumPosition = m_dataLength - m_spectrumBufferLength;
-                    calculateSpectrum(spectrumPosition);
-                }
-                emit bufferChanged(0, m_dataLength, m_buffer);
+                // Data which has already left the history is not reported
+                const qint64 bufferPosition = qMax(m_bufferNotifyPosition, m_buffer.startPosition());
+                const qint64 length = m_dataLength - bufferPosition;
+                m_bufferNotifyPosition = m_dataLength;
+                if (length > 0)
+                    emit bufferChanged(bufferPosition, length, bufferView(bufferPosition, length));
             }
             break;
         case QAudio::AudioOutput: {
+                const qint64 playLength = m_playBuffer.size();
                 const qint64 playPosition = audioLength(m_format, m_audioOutput->processedUSecs());
-                setPlayPosition(qMin(bufferLength(), playPosition));
+                setPlayPosition(qMin(playLength, playPosition));
                 const qint64 levelPosition = playPosition - m_levelBufferLength;
                 const qint64 spectrumPosition = playPosition - m_spectrumBufferLength;
-                if (playPosition >= m_dataLength)
+                if (playPosition >= playLength)
                     stopPlayback();
-                if (levelPosition >= 0 && levelPosition + m_levelBufferLength < m_bufferPosition + m_dataLength)
-                    calculateLevel(levelPosition, m_levelBufferLength);
-                if (spectrumPosition >= 0 && spectrumPosition + m_spectrumBufferLength < m_bufferPosition + m_dataLength)
-                    calculateSpectrum(spectrumPosition);
+                if (levelPosition >= 0 && levelPosition + m_levelBufferLength < playLength)
+                    calculateLevel(m_playBufferPosition + levelPosition, m_levelBufferLength);
+                if (spectrumPosition >= 0 && spectrumPosition + m_spectrumBufferLength < playLength)
+                    calculateSpectrum(m_playBufferPosition + spectrumPosition);
             }
             break;
         }
@@ -233,26 +313,21 @@ void Engine::audioStateChanged(QAudio::State state)
 
 void Engine::audioDataReady()
 {
+    // The oldest data is overwritten once the history is full, so
+    // everything available is read and recording never stops
     const qint64 bytesReady = m_audioInput->bytesReady();
-    const qint64 bytesSpace = m_buffer.size() - m_dataLength;
-    const qint64 bytesToRead = qMin(bytesReady, bytesSpace);
-
-    const qint64 bytesRead = m_audioInputIODevice->read(
-                                       m_buffer.data() + m_dataLength,
-                                       bytesToRead);
+    const qint64 bytesRead = m_buffer.write(m_audioInputIODevice, bytesReady);
 
     if (bytesRead) {
         m_dataLength += bytesRead;
         emit dataLengthChanged(dataLength());
+        analyseRecordedData();
     }
-
-    if (m_buffer.size() == m_dataLength)
-        stopRecording();
 }
 
-void Engine::spectrumChanged(const FrequencySpectrum &spectrum)
+void Engine::spectrumChanged(qint64 position, const FrequencySpectrum &spectrum)
 {
-    emit spectrumChanged(m_spectrumPosition, m_spectrumBufferLength, spectrum);
+    emit spectrumChanged(position, m_spectrumBufferLength, spectrum);
 }
 
 void Engine::resetAudioDevices()
@@ -264,7 +339,6 @@ void Engine::resetAudioDevices()
     delete m_audioOutput;
     m_audioOutput = 0;
     setPlayPosition(0);
-    m_spectrumPosition = 0;
 }
 
 void Engine::reset()
@@ -273,10 +347,13 @@ void Engine::reset()
     stopPlayback();
     setState(QAudio::AudioInput, QAudio::StoppedState);
     setFormat(QAudioFormat());
-    m_buffer.clear();
-    m_bufferPosition = 0;
+    m_playBuffer.clear();
+    m_playBufferPosition = 0;
+    m_buffer.allocate(0);
     m_bufferLength = 0;
     m_dataLength = 0;
+    m_bufferNotifyPosition = 0;
+    m_nextAnalysisPosition = 0;
     emit dataLengthChanged(0);
     resetAudioDevices();
 }
@@ -291,11 +368,10 @@ bool Engine::initialize()
         if (m_format != format) {
             resetAudioDevices();
 
-            m_bufferLength = audioLength(m_format, BufferDurationUs);
-            m_buffer.resize(m_bufferLength);
-            m_buffer.fill(0);
+            m_bufferLength = audioLength(m_format, m_historyDurationUs);
+            m_buffer.allocate(m_bufferLength);
             emit bufferLengthChanged(bufferLength());
-            emit bufferChanged(0, 0, m_buffer);
+            emit bufferChanged(0, 0, QByteArray());
             m_audioInput = new QAudioInput(m_audioInputDevice, m_format, this);
             m_audioInput->setNotifyInterval(NotifyIntervalMs);
             result = true;
@@ -396,9 +472,12 @@ void Engine::setPlayPosition(qint64 position, bool forceEmit)
 
 void Engine::calculateLevel(qint64 position, qint64 length)
 {
+    const char *ptr = m_buffer.data(position, length);
+    if (!ptr)
+        return;
+
     qreal peakLevel = 0.0;
 
-    const char *ptr = m_buffer.constData() + position - m_bufferPosition;
     const char *const end = ptr + length;
     while (ptr < end) {
         const qint16 value = *reinterpret_cast<const qint16*>(ptr);
@@ -413,11 +492,35 @@ void Engine::calculateLevel(qint64 position, qint64 length)
 
 void Engine::calculateSpectrum(qint64 position)
 {
-    if (m_spectrumAnalyser.isReady()) {
-        m_spectrumBuffer = QByteArray::fromRawData(m_buffer.constData() + position - m_bufferPosition,
-                                                   m_spectrumBufferLength);
-        m_spectrumPosition = position;
-        m_spectrumAnalyser.calculate(m_spectrumBuffer, m_format);
+    // Always offered: when the analyser is busy, it decides which frames
+    // to coalesce and accounts for them
+    m_spectrumBuffer = bufferView(position, m_spectrumBufferLength);
+    if (m_spectrumBuffer.isNull())
+        return;
+    m_spectrumAnalyser.calculate(m_spectrumBuffer, m_format, position);
+}
+
+void Engine::analyseRecordedData()
+{
+    if (m_analysisHopLength <= 0 || m_dataLength < m_nextAnalysisPosition)
+        return;
+
+    // Analysis windows end on hop boundaries, and a read may bring several
+    // of them.  The level is only computed for the newest one.  Every
+    // spectrum window is offered to the analyser, which coalesces them
+    // according to its policy, so a burst of data never makes the engine
+    // fall behind
+    const qint64 firstPosition = m_nextAnalysisPosition;
+    const qint64 lastPosition = firstPosition
+        + (m_dataLength - firstPosition) / m_analysisHopLength * m_analysisHopLength;
+    m_nextAnalysisPosition = lastPosition + m_analysisHopLength;
+
+    if (lastPosition >= m_levelBufferLength)
+        calculateLevel(lastPosition - m_levelBufferLength, m_levelBufferLength);
+
+    for (qint64 position = firstPosition; position <= lastPosition; position += m_analysisHopLength) {
+        if (position >= m_spectrumBufferLength)
+            calculateSpectrum(position - m_spectrumBufferLength);
     }
 }
 
@@ -426,7 +529,8 @@ void Engine::setFormat(const QAudioFormat &format)
     const bool changed = (format != m_format);
     m_format = format;
     m_levelBufferLength = audioLength(m_format, LevelWindowUs);
-    m_spectrumBufferLength = SpectrumLengthSamples *
+    m_analysisHopLength = audioLength(m_format, m_analysisHopUs);
+    m_spectrumBufferLength = m_spectrumAnalyser.length() *
                             (m_format.sampleSize() / 8) * m_format.channelCount();
     if (changed)
         emit formatChanged(m_format);
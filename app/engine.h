@@ -1,6 +1,7 @@
 #ifndef ENGINE_H
 #define ENGINE_H
 
+#include "audioringbuffer.h"
 #include "spectrumanalyser.h"
 
 #include <QAudioDeviceInfo>
@@ -59,7 +60,23 @@ public:
     bool initializeRecord();
 
     /**
-     * Position of the audio input device.
+     * Set the depth of the capture history.  Recording goes on past it,
+     * overwriting the oldest data.  Takes effect at the next
+     * initializeRecord().
+     * \param durationUs Duration in microseconds, at most 10 minutes
+     */
+    void setHistoryDuration(qint64 durationUs);
+
+    /**
+     * Set the interval between two analyses of the recorded audio.  The
+     * level and spectrum windows end every durationUs of captured audio,
+     * so successive windows overlap when it is shorter than them.
+     * \param durationUs Duration in microseconds
+     */
+    void setAnalysisHop(qint64 durationUs);
+
+    /**
+     * Position of the audio input device, from the start of the recording.
      * \return Position in bytes.
      */
     qint64 recordPosition() const { return m_recordPosition; }
@@ -83,17 +100,36 @@ public:
     qint64 playPosition() const { return m_playPosition; }
 
     /**
-     * Length of the internal engine buffer.
+     * Length of the internal engine buffer, i.e. depth of the capture
+     * history.
      * \return Buffer length in bytes.
      */
     qint64 bufferLength() const;
 
     /**
-     * Amount of data held in the buffer.
+     * Amount of data captured since the start of the recording.  Only the
+     * last bufferLength() bytes of it are held.
      * \return Data length in bytes.
      */
     qint64 dataLength() const { return m_dataLength; }
 
+    /**
+     * Zero-copy view of part of the capture history.  The view refers to
+     * the engine's storage: it is valid until the data is overwritten,
+     * i.e. while position stays within the last bufferLength() bytes.
+     * \param position Position in bytes, from the start of the recording
+     * \param length   Length in bytes
+     * \return Null QByteArray if the range is not held
+     */
+    QByteArray bufferView(qint64 position, qint64 length) const;
+
+    /**
+     * Number of spectrum frames analysed, coalesced and dropped so far,
+     * to measure the analysis headroom.
+     */
+    const SpectrumAnalyser::Counters &spectrumCounters() const
+                                    { return m_spectrumAnalyser.counters(); }
+
 public slots:
     void startRecording();
     void startPlayback();
@@ -163,9 +199,13 @@ signals:
     void spectrumChanged(qint64 position, qint64 length, const FrequencySpectrum &spectrum);
 
     /**
-     * Buffer containing audio data has changed.
-     * \param position Position of start of buffer in bytes
-     * \param buffer   Buffer
+     * Audio data has been appended to the buffer.  Only the data captured
+     * since the previous notification is reported, so the cost does not
+     * grow with the length of the recording; older data can be read with
+     * bufferView().
+     * \param position Position of the new data in bytes
+     * \param length   Length of the new data in bytes
+     * \param buffer   Zero-copy view of the new data, see bufferView()
      */
     void bufferChanged(qint64 position, qint64 length, const QByteArray &buffer);
 
@@ -173,7 +213,7 @@ private slots:
     void audioNotify();
     void audioStateChanged(QAudio::State state);
     void audioDataReady();
-    void spectrumChanged(const FrequencySpectrum &spectrum);
+    void spectrumChanged(qint64 position, const FrequencySpectrum &spectrum);
 
 private:
     void resetAudioDevices();
@@ -188,6 +228,7 @@ private:
     void setPlayPosition(qint64 position, bool forceEmit = false);
     void calculateLevel(qint64 position, qint64 length);
     void calculateSpectrum(qint64 position);
+    void analyseRecordedData();
 
 private:
     QAudio::Mode        m_mode;
@@ -208,10 +249,19 @@ private:
     qint64              m_playPosition;
     QBuffer             m_audioOutputIODevice;
 
-    QByteArray          m_buffer;
-    qint64              m_bufferPosition;
+    AudioRingBuffer     m_buffer;
+    qint64              m_historyDurationUs;
     qint64              m_bufferLength;
     qint64              m_dataLength;
+    qint64              m_bufferNotifyPosition; // end of the last bufferChanged range
+
+    // Played part of the history, and its position in m_buffer
+    QByteArray          m_playBuffer;
+    qint64              m_playBufferPosition;
+
+    qint64              m_analysisHopUs;
+    qint64              m_analysisHopLength;
+    qint64              m_nextAnalysisPosition; // end of the next window to analyse
 
     int                 m_levelBufferLength;
     qreal               m_rmsLevel;
@@ -220,7 +270,6 @@ private:
     int                 m_spectrumBufferLength;
     QByteArray          m_spectrumBuffer;
     SpectrumAnalyser    m_spectrumAnalyser;
-    qint64              m_spectrumPosition;
 
     int                 m_count;
     int                 m_thresholdSilence;
@@ -7,14 +7,18 @@
 #include <QAudioFormat>
 #include <QThread>
 
-SpectrumAnalyserThread::SpectrumAnalyserThread(QObject *parent)
-    :   QObject(parent)
+#include <string.h>
+
+SpectrumAnalyserThread::SpectrumAnalyserThread()
+    :   QObject()
     ,   m_fft(new FFTRealWrapper)
     ,   m_numSamples(SpectrumLengthSamples)
     ,   m_window(SpectrumLengthSamples, 0.0)
-    ,   m_input(SpectrumLengthSamples, 0.0)
     ,   m_output(SpectrumLengthSamples, 0.0)
     ,   m_spectrum(SpectrumLengthSamples)
+    ,   m_queue(SpectrumFrameQueueLength)
+    ,   m_coalescing(true)
+    ,   m_wakeupPending(0)
 {
     calculateWindow();
 }
@@ -24,6 +28,87 @@ SpectrumAnalyserThread::~SpectrumAnalyserThread()
     delete m_fft;
 }
 
+bool SpectrumAnalyserThread::setLength(int numSamples)
+{
+    if (numSamples == m_numSamples)
+        return true;
+
+    FFTRealWrapper *const fft = FFTRealWrapper::create(numSamples);
+    if (!fft)
+        return false;
+
+    delete m_fft;
+    m_fft = fft;
+    m_numSamples = numSamples;
+    m_window.fill(0.0, m_numSamples);
+    m_output.fill(0.0, m_numSamples);
+    m_spectrum = FrequencySpectrum(m_numSamples);
+    calculateWindow();
+    return true;
+}
+
+void SpectrumAnalyserThread::setCoalescing(bool enabled)
+{
+    m_coalescing = enabled;
+}
+
+bool SpectrumAnalyserThread::post(const QByteArray &buffer,
+                                  int inputFrequency,
+                                  int bytesPerSample,
+                                  qint64 position)
+{
+    SpectrumFrame *const frame = m_queue.back();
+    if (!frame)
+        return false;
+
+    // The slot keeps the allocation of the frame it held before, so this
+    // only allocates when the length changes
+    frame->samples.resize(buffer.size());
+    memcpy(frame->samples.data(), buffer.constData(), buffer.size());
+    frame->inputFrequency = inputFrequency;
+    frame->bytesPerSample = bytesPerSample;
+    frame->position = position;
+    m_queue.push();
+
+    if (0 == m_wakeupPending.fetchAndStoreRelease(1))
+        QMetaObject::invokeMethod(this, "processFrames", Qt::QueuedConnection);
+
+    return true;
+}
+
+void SpectrumAnalyserThread::processFrames()
+{
+    // Cleared first: a frame posted from now on schedules another call,
+    // even if this one drains it
+    m_wakeupPending.fetchAndStoreAcquire(0);
+
+    while (const SpectrumFrame *frame = m_queue.front()) {
+        int numCoalesced = 0;
+        if (m_coalescing) {
+            while (m_queue.size() > 1) {
+                m_queue.pop();
+                frame = m_queue.front();
+                ++numCoalesced;
+            }
+        }
+
+        int baseFrequency = 0;
+        const bool valid = calculateSpectrum(frame->samples,
+                                             frame->inputFrequency,
+                                             frame->bytesPerSample,
+                                             baseFrequency);
+
+        // The slot is released before the result is sent, so the producer
+        // finds room for a waiting frame when it gets the result
+        const qint64 position = frame->position;
+        m_queue.pop();
+        if (valid)
+            emit calculationComplete(m_spectrum, baseFrequency, numCoalesced, position);
+        else
+            emit frameRejected(numCoalesced);
+    }
+}
+
 void SpectrumAnalyserThread::calculateWindow()
 {
     for (int i=0; i<m_numSamples; ++i) {
@@ -36,35 +121,39 @@ void SpectrumAnalyserThread::calculateWindow()
     }
 }
 
-void SpectrumAnalyserThread::calculateSpectrum(const QByteArray &buffer,
+bool SpectrumAnalyserThread::calculateSpectrum(const QByteArray &buffer,
                                                 int inputFrequency,
-                                                int bytesPerSample)
+                                                int bytesPerSample,
+                                                int &baseFrequency)
 {
-    const char *ptr = buffer.constData();
-    for (int i=0; i<m_numSamples; ++i) {
-        const qint16 pcmSample = *reinterpret_cast<const qint16*>(ptr);
-        // scale down to range [-1.0, 1.0]
-        const DataType realSample = pcmToReal(pcmSample);
-        const DataType windowedSample = realSample * m_window[i];
-        m_input[i] = windowedSample;
-        ptr += bytesPerSample;
+    // The FFT reads m_numSamples samples: a frame of another length, e.g.
+    // posted before setLength(), must not be used
+    if (buffer.size() != m_numSamples * bytesPerSample) {
+        qWarning() << "SpectrumAnalyserThread::calculateSpectrum frame of"
+                   << buffer.size() << "bytes, expected" << m_numSamples * bytesPerSample;
+        return false;
     }
 
-    m_fft->calculateFFT(m_output.data(), m_input.data());
+    // Only the bins up to SpectrumHighFreq are shown: the FFT skips the
+    // work which only feeds the bins above
+    const int halfLength = m_numSamples / 2;
+    const int maxBin = qMin(halfLength,
+                            qCeil(SpectrumHighFreq * m_numSamples / inputFrequency));
+    m_fft->setMaxBin(maxBin);
+
+    // Samples are scaled down to range [-1.0, 1.0] and windowed within the
+    // FFT, m_output[i] = SpectrumAnalyserMultiplier * ln(magnitude of bin i)
+    m_fft->calculateLogMagnitudePcm16(m_output.data(), buffer.constData(),
+                                      bytesPerSample, m_window.constData(),
+                                      SpectrumAnalyserMultiplier);
 
     int _baseFrequency = 0;
     int _maxAmplitude = 0;
 
-    for (int i=2; i<=m_numSamples/2; ++i) {
+    for (int i=2; i<=halfLength; ++i) {
         m_spectrum[i].frequency = qreal(i * inputFrequency) / (m_numSamples);
 
-        const qreal real = m_output[i];
-        qreal imag = 0.0;
-        if (i>0 && i<m_numSamples/2)
-            imag = m_output[m_numSamples/2 + i];
-
-        const qreal magnitude = qSqrt(real*real + imag*imag);
-        qreal amplitude = SpectrumAnalyserMultiplier * qLn(magnitude);
+        qreal amplitude = (i <= maxBin) ? m_output[i] : 0.0;
 
         m_spectrum[i].clipped = (amplitude > 1.0);
         amplitude = qMax(qreal(0.0), amplitude);
@@ -77,59 +166,171 @@ void SpectrumAnalyserThread::calculateSpectrum(const QByteArray &buffer,
         }
     }
 
-    emit calculationComplete(m_spectrum, _baseFrequency);
+    baseFrequency = _baseFrequency;
+    return true;
 }
 
 SpectrumAnalyser::SpectrumAnalyser(QObject *parent)
     :   QObject(parent)
-    ,   m_thread(new SpectrumAnalyserThread(this))
-    ,   m_state(Idle)
+    ,   m_thread(new SpectrumAnalyserThread)
+    ,   m_workerThread(new QThread(this))
+    ,   m_length(SpectrumLengthSamples)
+    ,   m_pending(0)
+    ,   m_discard(0)
+    ,   m_policy(LatestWins)
+    ,   m_waiting(false)
+    ,   m_waitingInputFrequency(0)
+    ,   m_waitingBytesPerSample(0)
+    ,   m_waitingPosition(0)
 {
+    // moveToThread() cannot be called on a QObject with a parent
+    m_thread->moveToThread(m_workerThread);
     connect(m_thread, &SpectrumAnalyserThread::calculationComplete,
             this, &SpectrumAnalyser::calculationComplete);
+    connect(m_thread, &SpectrumAnalyserThread::frameRejected,
+            this, &SpectrumAnalyser::frameRejected);
+    m_workerThread->start();
 }
 
 SpectrumAnalyser::~SpectrumAnalyser()
 {
+    m_workerThread->quit();
+    m_workerThread->wait();
+    delete m_thread;
+}
+
+bool SpectrumAnalyser::setLength(int numSamples)
+{
+    // A waiting frame has the previous length and would be posted after
+    // the change
+    if (m_waiting) {
+        m_waiting = false;
+        ++m_counters.framesDropped;
+    }
+
+    // Frames already posted are processed first, with the previous length
+    bool result = false;
+    QMetaObject::invokeMethod(m_thread, "setLength",
+                              Qt::BlockingQueuedConnection,
+                              Q_RETURN_ARG(bool, result),
+                              Q_ARG(int, numSamples));
+    if (result)
+        m_length = numSamples;
+    return result;
+}
 
+int SpectrumAnalyser::length() const
+{
+    return m_length;
 }
 
 
+void SpectrumAnalyser::setPolicy(Policy policy)
+{
+    m_policy = policy;
+    QMetaObject::invokeMethod(m_thread, "setCoalescing",
+                              Qt::QueuedConnection,
+                              Q_ARG(bool, LatestWins == policy));
+}
+
+SpectrumAnalyser::Policy SpectrumAnalyser::policy() const
+{
+    return m_policy;
+}
+
+void SpectrumAnalyser::resetCounters()
+{
+    m_counters = Counters();
+}
+
 void SpectrumAnalyser::calculate(const QByteArray &buffer,
-                         const QAudioFormat &format)
+                         const QAudioFormat &format,
+                         qint64 position)
 {
-    if (isReady()) {
-        const int bytesPerSample = format.sampleSize() * format.channelCount() / 8;
+    const int bytesPerSample = format.sampleSize() * format.channelCount() / 8;
 
-        m_state = Busy;
+    // A frame still waiting for room is older than this one
+    if (m_waiting) {
+        m_waiting = false;
+        ++m_counters.framesCoalesced;
+    }
+
+    if (m_thread->post(buffer, format.sampleRate(), bytesPerSample, position)) {
+        ++m_pending;
+        return;
+    }
 
-        const bool b = QMetaObject::invokeMethod(m_thread, "calculateSpectrum",
-                                  Qt::AutoConnection,
-                                  Q_ARG(QByteArray, buffer),
-                                  Q_ARG(int, format.sampleRate()),
-                                  Q_ARG(int, bytesPerSample));
-        Q_UNUSED(b);
+    // The buffer may only be valid during this call: keep a copy, in
+    // storage which is reused from one frame to the next
+    m_waitingBuffer.resize(buffer.size());
+    memcpy(m_waitingBuffer.data(), buffer.constData(), buffer.size());
+    m_waitingInputFrequency = format.sampleRate();
+    m_waitingBytesPerSample = bytesPerSample;
+    m_waitingPosition = position;
+    m_waiting = true;
+}
 
+void SpectrumAnalyser::cancelCalculation()
+{
+    m_discard = m_pending;
+    if (m_waiting) {
+        m_waiting = false;
+        ++m_counters.framesDropped;
     }
 }
 
-bool SpectrumAnalyser::isReady() const
+void SpectrumAnalyser::calculationComplete(const FrequencySpectrum &spectrum, int baseFrequency,
+                                           int numCoalesced, qint64 position)
 {
-    return (Idle == m_state);
+    if (!settleFrames(numCoalesced))
+        return;
+
+    ++m_counters.framesAnalysed;
+    emit spectrumChanged(position, spectrum);
+    emit baseFrequencyChanged(baseFrequency);
 }
 
-void SpectrumAnalyser::cancelCalculation()
+void SpectrumAnalyser::frameRejected(int numCoalesced)
 {
-    if (Busy == m_state)
-        m_state = Cancelled;
+    if (settleFrames(numCoalesced))
+        ++m_counters.framesDropped;
 }
 
-void SpectrumAnalyser::calculationComplete(const FrequencySpectrum &spectrum, int baseFrequency)
+/**
+ * Accounts for the frames covered by a result: the newest one, and the
+ * older ones coalesced into it.  The frames posted before
+ * cancelCalculation() come first and are dropped, whatever happened to
+ * them.  Also posts the waiting frame, now that a slot is free.
+ * \return false if the newest frame was dropped, true if it is left to
+ *         the caller
+ */
+bool SpectrumAnalyser::settleFrames(int numCoalesced)
 {
-    if (Busy == m_state){
-        emit spectrumChanged(spectrum);
-        emit baseFrequencyChanged(baseFrequency);
+    const int numFrames = numCoalesced + 1;
+    Q_ASSERT(m_pending >= numFrames);
+    m_pending -= numFrames;
+
+    const int numDiscarded = qMin(m_discard, numFrames);
+    m_discard -= numDiscarded;
+
+    const int numDiscardedCoalesced = qMin(numDiscarded, numCoalesced);
+    m_counters.framesCoalesced += numCoalesced - numDiscardedCoalesced;
+    m_counters.framesDropped += numDiscardedCoalesced;
+
+    postWaitingFrame();
+
+    if (numDiscarded == numFrames) {
+        ++m_counters.framesDropped;
+        return false;
     }
+    return true;
+}
 
-    m_state = Idle;
+void SpectrumAnalyser::postWaitingFrame()
+{
+    if (m_waiting && m_thread->post(m_waitingBuffer, m_waitingInputFrequency,
+                                    m_waitingBytesPerSample, m_waitingPosition)) {
+        m_waiting = false;
+        ++m_pending;
+    }
 }
@@ -2,6 +2,7 @@
 #define SPECTRUMANALYSER_H
 
 
+#include <QAtomicInt>
 #include <QByteArray>
 #include <QObject>
 #include <QVector>
@@ -11,8 +12,10 @@
 #include "frequencyspectrum.h"
 #include "spectrumanalyser.h"
 #include "helpers.h"
+#include "spscqueue.h"
 
-// number of audio samples used to calculate the freq spectrum
+// default number of audio samples used to calculate the freq spectrum;
+// can be changed at runtime with SpectrumAnalyser::setLength()
 const int    SpectrumLengthSamples  = PowOfTwo<FFTLengthPowerOfTwo>::Result;
 
 // number of bands in the freq spectrum
@@ -30,6 +33,9 @@ const int   WaveformTileLength      = 4096;
 // fudge(??) factor used to calculate the spectrum bar heights
 const qreal SpectrumAnalyserMultiplier = 0.15;
 
+// number of frames which can wait for the analysis thread
+const int   SpectrumFrameQueueLength = 4;
+
 // disable message timeout
 const int   NullMessageTimeout      = -1;
 
@@ -38,38 +44,92 @@ QT_FORWARD_DECLARE_CLASS(QThread)
 
 class FFTRealWrapper;
 
+/**
+ * Window of audio samples waiting for the analysis thread.
+ */
+struct SpectrumFrame
+{
+    SpectrumFrame() : inputFrequency(0), bytesPerSample(0), position(0) { }
+
+    QByteArray  samples;
+    int         inputFrequency;
+    int         bytesPerSample;
+    qint64      position;       // of the window in the capture, in bytes
+};
+
+/**
+ * Spectrum calculation, living in its own thread.  Frames are handed over
+ * through a lock-free queue, so the producer never waits for the FFT, and
+ * the results come back as queued signals.
+ */
 class SpectrumAnalyserThread : public QObject
 {
     Q_OBJECT
 
 public:
-    SpectrumAnalyserThread(QObject *parent);
+    SpectrumAnalyserThread();
     ~SpectrumAnalyserThread();
 
-public slots:
-    void calculateSpectrum(const QByteArray &buffer,
-                           int inputFrequency,
-                           int bytesPerSample);
+    Q_INVOKABLE bool setLength(int numSamples);
+
+    /**
+     * Whether processFrames() only analyses the newest queued frame,
+     * skipping the older ones, or every frame in order.
+     */
+    Q_INVOKABLE void setCoalescing(bool enabled);
+
+    /**
+     * Copies a window of samples into the frame queue and wakes the thread
+     * up.  Must only be called from one thread, the producer.
+     * \return false, without queueing the frame, if the queue is full
+     */
+    bool post(const QByteArray &buffer,
+              int inputFrequency,
+              int bytesPerSample,
+              qint64 position);
 
 signals:
-    void calculationComplete(const FrequencySpectrum &spectrum, int baseFrequency);
+    /**
+     * \param numCoalesced Number of older frames skipped for this one
+     * \param position     Position of the analysed frame, as posted
+     */
+    void calculationComplete(const FrequencySpectrum &spectrum, int baseFrequency,
+                             int numCoalesced, qint64 position);
+
+    /**
+     * The newest frame did not match the current length, and was skipped
+     * together with the numCoalesced older ones.
+     */
+    void frameRejected(int numCoalesced);
+
+private slots:
+    void processFrames();
 
 private:
     void calculateWindow();
+    bool calculateSpectrum(const QByteArray &buffer,
+                           int inputFrequency,
+                           int bytesPerSample,
+                           int &baseFrequency);
 
 private:
     FFTRealWrapper*                             m_fft;
 
-    const int                                   m_numSamples;
+    int                                         m_numSamples;
 
     typedef FFTRealFixLenParam::DataType        DataType;
     QVector<DataType>                           m_window;
 
-    QVector<DataType>                           m_input;
     QVector<DataType>                           m_output;
 
     FrequencySpectrum                           m_spectrum;
 
+    SpscQueue<SpectrumFrame>                    m_queue;
+    bool                                        m_coalescing;
+
+    // Set by post() when it schedules processFrames(), cleared by
+    // processFrames() before it drains the queue
+    QAtomicInt                                  m_wakeupPending;
 
 };
 
@@ -82,31 +142,108 @@ public:
     ~SpectrumAnalyser();
 
 public:
-    void calculate(const QByteArray &buffer, const QAudioFormat &format);
-    bool isReady() const;
+    /**
+     * Set the number of samples used for each spectrum calculation.
+     * Returns false, leaving the length unchanged, if the FFT library
+     * does not support the requested length.
+     */
+    bool setLength(int numSamples);
+    int length() const;
+
+    /**
+     * How frames are scheduled when they arrive faster than they are
+     * analysed.
+     */
+    enum Policy {
+        /**
+         * Only the newest pending frame is analysed, the older ones are
+         * coalesced into it.  Keeps the latency at one analysis.
+         */
+        LatestWins,
+        /**
+         * Every queued frame is analysed, in order and in one batch, up to
+         * SpectrumFrameQueueLength of them.  Beyond that the newest frame
+         * still replaces the older ones waiting for room.
+         */
+        ProcessBacklog
+    };
+
+    void setPolicy(Policy policy);
+    Policy policy() const;
+
+    /**
+     * Frame accounting.  Every frame passed to calculate() ends up in
+     * exactly one of the counters, once its fate is known.
+     */
+    struct Counters {
+        Counters() : framesAnalysed(0), framesCoalesced(0), framesDropped(0) { }
+
+        quint64 framesAnalysed;  // spectrum calculated and emitted
+        quint64 framesCoalesced; // superseded by a newer frame before analysis
+        quint64 framesDropped;   // discarded by cancelCalculation() or setLength()
+    };
+
+    const Counters &counters() const { return m_counters; }
+    void resetCounters();
+
+    /**
+     * Queue a window of samples for the analysis thread.  The samples are
+     * copied, so the buffer can be reused as soon as this returns.  If the
+     * queue is full, the frame waits for room, replacing any older frame
+     * already waiting.
+     * \param position Position of the window, returned with its spectrum
+     */
+    void calculate(const QByteArray &buffer, const QAudioFormat &format,
+                   qint64 position);
+
+    /**
+     * Discard the frames which are still queued or waiting, and the results
+     * of those being analysed.
+     */
     void cancelCalculation();
 
 signals:
-    void spectrumChanged(const FrequencySpectrum &spectrum);
+    /**
+     * \param position Position of the analysed window, as passed to
+     *                 calculate().  The analysis is asynchronous, so it is
+     *                 usually older than the last window passed.
+     */
+    void spectrumChanged(qint64 position, const FrequencySpectrum &spectrum);
     void baseFrequencyChanged(int baseFrequency);
 
 private slots:
-    void calculationComplete(const FrequencySpectrum &spectrum, int baseFrequency);
+    void calculationComplete(const FrequencySpectrum &spectrum, int baseFrequency,
+                             int numCoalesced, qint64 position);
+    void frameRejected(int numCoalesced);
 
 private:
     void calculateWindow();
+    bool settleFrames(int numCoalesced);
+    void postWaitingFrame();
 
 private:
 
     SpectrumAnalyserThread*    m_thread;
+    QThread*                   m_workerThread;
 
-    enum State {
-        Idle,
-        Busy,
-        Cancelled
-    };
+    int                        m_length;
+
+    // number of frames posted whose result has not come back yet
+    int                        m_pending;
+
+    // number of pending frames to drop, after cancelCalculation()
+    int                        m_discard;
+
+    Policy                     m_policy;
+
+    // newest frame which did not fit in the queue
+    bool                       m_waiting;
+    QByteArray                 m_waitingBuffer;
+    int                        m_waitingInputFrequency;
+    int                        m_waitingBytesPerSample;
+    qint64                     m_waitingPosition;
 
-    State              m_state;
+    Counters                   m_counters;
 };
 
 #endif // SPECTRUMANALYSER_H
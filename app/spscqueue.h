@@ -0,0 +1,128 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <QAtomicInteger>
+#include <QtCore/qglobal.h>
+
+/**
+ * Bounded lock-free queue for one producer thread and one consumer thread.
+ *
+ * Slots are allocated once and reused: the producer fills the slot returned
+ * by back() in place and publishes it with push(), the consumer reads the
+ * slot returned by front() in place and releases it with pop().  Neither
+ * side ever blocks or allocates.
+ */
+template <typename T>
+class SpscQueue
+{
+public:
+    /**
+     * \param capacity Number of slots, rounded up to a power of two
+     */
+    explicit SpscQueue(int capacity);
+    ~SpscQueue();
+
+    int capacity() const { return m_mask + 1; }
+
+    /**
+     * Producer side: free slot to fill, or 0 if the queue is full.
+     */
+    T *back();
+
+    /**
+     * Producer side: makes the slot returned by back() visible to the
+     * consumer.
+     */
+    void push();
+
+    /**
+     * Consumer side: oldest published slot, or 0 if the queue is empty.
+     */
+    T *front();
+
+    /**
+     * Consumer side: gives the slot returned by front() back to the producer.
+     */
+    void pop();
+
+    /**
+     * Number of published slots.  Exact only from the producer or the
+     * consumer thread, and only until the other side moves.
+     */
+    int size() const;
+
+private:
+    Q_DISABLE_COPY(SpscQueue)
+
+    T*                          m_slots;
+    quint32                     m_mask;
+
+    // Free-running counters, the slot index is counter & m_mask.  They are
+    // kept on separate cache lines so each side only writes its own line.
+    QAtomicInteger<quint32>     m_head; // written by the consumer
+    char                        m_padding[64];
+    QAtomicInteger<quint32>     m_tail; // written by the producer
+};
+
+template <typename T>
+SpscQueue<T>::SpscQueue(int capacity)
+    :   m_slots(0)
+    ,   m_mask(0)
+    ,   m_head(0)
+    ,   m_tail(0)
+{
+    Q_ASSERT(capacity > 0);
+    quint32 size = 1;
+    while (size < quint32(capacity))
+        size *= 2;
+    m_slots = new T[size];
+    m_mask = size - 1;
+}
+
+template <typename T>
+SpscQueue<T>::~SpscQueue()
+{
+    delete[] m_slots;
+}
+
+template <typename T>
+T *SpscQueue<T>::back()
+{
+    const quint32 tail = m_tail.load();
+    if (tail - m_head.loadAcquire() > m_mask)
+        return 0;
+    return &m_slots[tail & m_mask];
+}
+
+template <typename T>
+void SpscQueue<T>::push()
+{
+    const quint32 tail = m_tail.load();
+    Q_ASSERT(tail - m_head.loadAcquire() <= m_mask);
+    m_tail.storeRelease(tail + 1);
+}
+
+template <typename T>
+T *SpscQueue<T>::front()
+{
+    const quint32 head = m_head.load();
+    if (head == m_tail.loadAcquire())
+        return 0;
+    return &m_slots[head & m_mask];
+}
+
+template <typename T>
+void SpscQueue<T>::pop()
+{
+    const quint32 head = m_head.load();
+    Q_ASSERT(head != m_tail.loadAcquire());
+    m_head.storeRelease(head + 1);
+}
+
+template <typename T>
+int SpscQueue<T>::size() const
+{
+    return int(m_tail.loadAcquire() - m_head.loadAcquire());
+}
+
+#endif // SPSCQUEUE_H
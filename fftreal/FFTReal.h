@@ -37,6 +37,10 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 #include	"def.h"
 #include	"DynArray.h"
+#include	"FFTRealBitRev.h"
+#include	"FFTRealCodelet.h"
+#include	"FFTRealTable.h"
+#include	"FFTRealThreadPool.h"
 #include	"OscSinCos.h"
 
 
@@ -51,6 +55,9 @@ public:
 
 	enum {			MAX_BIT_DEPTH	= 30	};	// So length can be represented as long int
 
+	// Under this bit depth, a pass is too short to be worth splitting
+	enum {			MIN_PARALLEL_BIT_DEPTH	= 17	};
+
 	typedef	DT	DataType;
 
 	explicit			FFTReal (long length);
@@ -58,7 +65,12 @@ public:
 
 	long				get_length () const;
 	void				do_fft (DataType f [], const DataType x []) const;
+	void				do_fft (DataType f [], const DataType x [], DataType buffer []) const;
 	void				do_ifft (const DataType f [], DataType x []) const;
+	void				do_ifft (const DataType f [], DataType x [], DataType buffer []) const;
+	void				set_thread_pool (FFTRealThreadPool *pool_ptr);
+	void				set_input_len (long input_len);
+	long				get_input_len () const;
 	void				rescale (DataType x []) const;
 	DataType *		use_buffer () const;
 
@@ -79,9 +91,33 @@ private:
 
 	typedef	OscSinCos <DataType>	OscType;
 
-	void				init_br_lut ();
-	void				init_trigo_lut ();
-	void				init_trigo_osc ();
+	enum PassType
+	{
+		PassType_DIRECT_SPREAD = 0,
+		PassType_DIRECT_1_2,
+		PassType_DIRECT_3,
+		PassType_DIRECT_N,
+		PassType_INVERSE_N,
+		PassType_INVERSE_3,
+		PassType_INVERSE_1_2
+	};
+
+	// Arguments of a pass shared by the threads of the pool
+	class PassTask
+	{
+	public:
+		const FFTReal *
+							_fft_ptr;
+		PassType			_type;
+		DataType *		_df_ptr;
+		const DataType *
+							_sf_ptr;
+		int				_pass;
+	};
+
+	static long		get_trigo_lut_size (int nbr_bits);
+	static void		init_br_lut (long table_ptr [], long size, long nbr_bits);
+	static void		init_trigo_lut (DataType table_ptr [], long size, long nbr_bits);
 
 	FORCEINLINE const long *
 						get_br_ptr () const;
@@ -90,30 +126,39 @@ private:
 	FORCEINLINE long
 						get_trigo_level_index (int level) const;
 
-	inline void		compute_fft_general (DataType f [], const DataType x []) const;
-	inline void		compute_direct_pass_1_2 (DataType df [], const DataType x []) const;
-	inline void		compute_direct_pass_3 (DataType df [], const DataType sf []) const;
-	inline void		compute_direct_pass_n (DataType df [], const DataType sf [], int pass) const;
-	inline void		compute_direct_pass_n_lut (DataType df [], const DataType sf [], int pass) const;
-	inline void		compute_direct_pass_n_osc (DataType df [], const DataType sf [], int pass) const;
-
-	inline void		compute_ifft_general (const DataType f [], DataType x []) const;
-	inline void		compute_inverse_pass_n (DataType df [], const DataType sf [], int pass) const;
-	inline void		compute_inverse_pass_n_osc (DataType df [], const DataType sf [], int pass) const;
-	inline void		compute_inverse_pass_n_lut (DataType df [], const DataType sf [], int pass) const;
-	inline void		compute_inverse_pass_3 (DataType df [], const DataType sf []) const;
-	inline void		compute_inverse_pass_1_2 (DataType x [], const DataType sf []) const;
+	inline void		run_pass (PassType type, DataType df [], const DataType sf [], int pass) const;
+	static void		exec_pass_task (void *ctx_ptr, int part, int nbr_parts);
+	inline void		compute_pass (PassType type, DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const;
+	static inline void
+						get_part_range (long &beg, long &end, long nbr_items, int part, int nbr_parts);
+	inline void		get_pass_range (long &grp_beg, long &grp_end, long &i_beg, long &i_end, int pass, int part, int nbr_parts) const;
+
+	inline int		get_spread_bits () const;
+	inline void		compute_fft_general (DataType f [], const DataType x [], DataType buffer []) const;
+	inline void		compute_direct_pass_1_2 (DataType df [], const DataType x [], int part, int nbr_parts) const;
+	inline void		compute_direct_pass_3 (DataType df [], const DataType sf [], int part, int nbr_parts) const;
+	inline void		compute_direct_pass_n (DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const;
+	inline void		compute_direct_pass_n_lut (DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const;
+	inline void		compute_direct_pass_n_osc (DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const;
+
+	inline void		compute_ifft_general (const DataType f [], DataType x [], DataType buffer []) const;
+	inline void		compute_inverse_pass_n (DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const;
+	inline void		compute_inverse_pass_n_osc (DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const;
+	inline void		compute_inverse_pass_n_lut (DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const;
+	inline void		compute_inverse_pass_3 (DataType df [], const DataType sf [], int part, int nbr_parts) const;
+	inline void		compute_inverse_pass_1_2 (DataType x [], const DataType sf [], int part, int nbr_parts) const;
 
 	const long		_length;
 	const int		_nbr_bits;
-	DynArray <long>
+	FFTRealTable <long>
 						_br_lut;
-	DynArray <DataType>
+	FFTRealTable <DataType>
 						_trigo_lut;
 	mutable DynArray <DataType>
 						_buffer;
-   mutable DynArray <OscType>
-						_trigo_osc;
+	FFTRealThreadPool *
+						_pool_ptr;
+	long				_input_len;
 
 
 
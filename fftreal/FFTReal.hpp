@@ -35,6 +35,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
+#include	<algorithm>
+
 #include	<cassert>
 #include	<cmath>
 
@@ -85,7 +87,9 @@ Name: ctor
 Input parameters:
 	- length: length of the array on which we want to do a FFT. Range: power of
 		2 only, > 0.
-Throws: std::bad_alloc
+	The lookup tables are shared with the other objects of the same length
+	and type, see FFTRealTable.
+Throws: std::bad_alloc, std::system_error
 ==============================================================================
 */
 
@@ -93,17 +97,14 @@ template <class DT>
 FFTReal <DT>::FFTReal (long length)
 :	_length (length)
 ,	_nbr_bits (FFTReal_get_next_pow2 (length))
-,	_br_lut ()
-,	_trigo_lut ()
+,	_br_lut (&init_br_lut, 1L << _nbr_bits, _nbr_bits)
+,	_trigo_lut (&init_trigo_lut, get_trigo_lut_size (_nbr_bits), _nbr_bits)
 ,	_buffer (length)
-,	_trigo_osc ()
+,	_pool_ptr (0)
+,	_input_len (length)
 {
 	assert (FFTReal_is_pow2 (length));
 	assert (_nbr_bits <= MAX_BIT_DEPTH);
-
-	init_br_lut ();
-	init_trigo_lut ();
-	init_trigo_osc ();
 }
 
 
@@ -138,23 +139,58 @@ Output parameters:
 		f [0...length(x)/2] = real values,
 		f [length(x)/2+1...length(x)-1] = negative imaginary values of
 		coefficents 1...length(x)/2-1.
+	Uses the internal buffer: not reentrant.
 Throws: Nothing
 ==============================================================================
 */
 
 template <class DT>
 void	FFTReal <DT>::do_fft (DataType f [], const DataType x []) const
+{
+	do_fft (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Same as do_fft (f, x), with a scratch buffer supplied by the caller
+	instead of the internal one. The object itself is only read, so several
+	threads can share it as long as each one uses its own buffer.
+Input parameters:
+	- x: pointer on the source array (time).
+Output parameters:
+	- f: pointer on the destination array (frequencies).
+Input/output parameters:
+	- buffer: scratch array, get_length () elements. Must be different from
+		x and f.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::do_fft (DataType f [], const DataType x [], DataType buffer []) const
 {
 	assert (f != 0);
-	assert (f != use_buffer ());
+	assert (f != buffer);
 	assert (x != 0);
-	assert (x != use_buffer ());
+	assert (x != buffer);
 	assert (x != f);
+	assert (buffer != 0);
 
-	// General case
+	// General case. Short transforms use straight-line code.
 	if (_nbr_bits > 2)
 	{
-		compute_fft_general (f, x);
+		switch (_nbr_bits)
+		{
+		case	3:	FFTRealCodelet <3>::do_fft (f, x);	break;
+		case	4:	FFTRealCodelet <4>::do_fft (f, x);	break;
+		case	5:	FFTRealCodelet <5>::do_fft (f, x);	break;
+		case	6:	FFTRealCodelet <6>::do_fft (f, x);	break;
+		default:	compute_fft_general (f, x, buffer);	break;
+		}
 	}
 
 	// 4-point FFT
@@ -199,23 +235,58 @@ Input parameters:
 		coefficents 1...length(x)/2-1.
 Output parameters:
 	- x: pointer on the destination array (time).
+	Uses the internal buffer: not reentrant.
 Throws: Nothing
 ==============================================================================
 */
 
 template <class DT>
 void	FFTReal <DT>::do_ifft (const DataType f [], DataType x []) const
+{
+	do_ifft (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_ifft
+Description:
+	Same as do_ifft (f, x), with a scratch buffer supplied by the caller
+	instead of the internal one. The object itself is only read, so several
+	threads can share it as long as each one uses its own buffer.
+Input parameters:
+	- f: pointer on the source array (frequencies).
+Output parameters:
+	- x: pointer on the destination array (time).
+Input/output parameters:
+	- buffer: scratch array, get_length () elements. Must be different from
+		x and f.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::do_ifft (const DataType f [], DataType x [], DataType buffer []) const
 {
 	assert (f != 0);
-	assert (f != use_buffer ());
+	assert (f != buffer);
 	assert (x != 0);
-	assert (x != use_buffer ());
+	assert (x != buffer);
 	assert (x != f);
+	assert (buffer != 0);
 
-	// General case
+	// General case. Short transforms use straight-line code.
 	if (_nbr_bits > 2)
 	{
-		compute_ifft_general (f, x);
+		switch (_nbr_bits)
+		{
+		case	3:	FFTRealCodelet <3>::do_ifft (f, x);	break;
+		case	4:	FFTRealCodelet <4>::do_ifft (f, x);	break;
+		case	5:	FFTRealCodelet <5>::do_ifft (f, x);	break;
+		case	6:	FFTRealCodelet <6>::do_ifft (f, x);	break;
+		default:	compute_ifft_general (f, x, buffer);	break;
+		}
 	}
 
 	// 4-point IFFT
@@ -246,6 +317,68 @@ void	FFTReal <DT>::do_ifft (const DataType f [], DataType x []) const
 
 
 
+/*
+==============================================================================
+Name: set_thread_pool
+Description:
+	Spreads each pass of the following transforms over the threads of a
+	pool, for lengths of 2^MIN_PARALLEL_BIT_DEPTH points and more. Shorter
+	transforms are always done by the calling thread. The pool may be shared
+	with other objects.
+	With the pool, the trigonometric oscillators of the last passes restart
+	from an exact phase at each part, so results may differ from the single-
+	threaded ones in the last bits.
+Input parameters:
+	- pool_ptr: pool to use, or 0 to go back to the calling thread only. The
+		pool must live as long as it is used by this object.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::set_thread_pool (FFTRealThreadPool *pool_ptr)
+{
+	_pool_ptr = pool_ptr;
+}
+
+
+
+/*
+==============================================================================
+Name: set_input_len
+Description:
+	Tells the following direct transforms that the source is zero-padded.
+	When it is not longer than length / 8, the first passes, which would
+	only combine single samples with zeros, are replaced by a copy of the
+	samples. A source of M samples padded to N points then costs about
+	log2 (M) passes and the copy, instead of log2 (N) passes.
+Input parameters:
+	- input_len: number of leading samples of the source which can be non-
+		zero, in [0 ; get_length ()]. x [input_len] to x [length - 1] must
+		be zero, they may not be read. Default: get_length ().
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::set_input_len (long input_len)
+{
+	assert (input_len >= 0);
+	assert (input_len <= _length);
+
+	_input_len = input_len;
+}
+
+
+
+template <class DT>
+long	FFTReal <DT>::get_input_len () const
+{
+	return (_input_len);
+}
+
+
+
 /*
 ==============================================================================
 Name: rescale
@@ -299,7 +432,8 @@ void	FFTReal <DT>::rescale (DataType x []) const
 Name: use_buffer
 Description:
 	Access the internal buffer, whose length is the FFT one.
-	Buffer content will be erased at each do_fft() / do_ifft() call!
+	Buffer content will be erased at each do_fft() / do_ifft() call without
+	explicit scratch buffer!
 	This buffer cannot be used as:
 		- source for FFT or IFFT done with this object
 		- destination for FFT or IFFT done with this object
@@ -326,12 +460,20 @@ typename FFTReal <DT>::DataType *	FFTReal <DT>::use_buffer () const
 
 
 template <class DT>
-void	FFTReal <DT>::init_br_lut ()
+long	FFTReal <DT>::get_trigo_lut_size (int nbr_bits)
+{
+	return ((nbr_bits > 3) ? (1L << (nbr_bits - 1)) - 4 : 0);
+}
+
+
+
+template <class DT>
+void	FFTReal <DT>::init_br_lut (long table_ptr [], long size, long nbr_bits)
 {
-	const long		length = 1L << _nbr_bits;
-	_br_lut.resize (length);
+	const long		length = 1L << nbr_bits;
+	assert (size == length);
 
-	_br_lut [0] = 0;
+	table_ptr [0] = 0;
 	long				br_index = 0;
 	for (long cnt = 1; cnt < length; ++cnt)
 	{
@@ -342,33 +484,28 @@ void	FFTReal <DT>::init_br_lut ()
 			bit >>= 1;
 		}
 
-		_br_lut [cnt] = br_index;
+		table_ptr [cnt] = br_index;
 	}
 }
 
 
 
 template <class DT>
-void	FFTReal <DT>::init_trigo_lut ()
+void	FFTReal <DT>::init_trigo_lut (DataType table_ptr [], long size, long nbr_bits)
 {
 	using namespace std;
 
-	if (_nbr_bits > 3)
+	assert (size == get_trigo_lut_size (int (nbr_bits)));
+
+	for (int level = 3; level < nbr_bits; ++level)
 	{
-		const long		total_len = (1L << (_nbr_bits - 1)) - 4;
-		_trigo_lut.resize (total_len);
+		const long		level_len = 1L << (level - 1);
+		DataType	* const	level_ptr = table_ptr + (level_len - 4);
+		const double	mul = PI / (level_len << 1);
 
-		for (int level = 3; level < _nbr_bits; ++level)
+		for (long i = 0; i < level_len; ++ i)
 		{
-			const long		level_len = 1L << (level - 1);
-			DataType	* const	level_ptr =
-				&_trigo_lut [get_trigo_level_index (level)];
-			const double	mul = PI / (level_len << 1);
-
-			for (long i = 0; i < level_len; ++ i)
-			{
-				level_ptr [i] = static_cast <DataType> (cos (i * mul));
-			}
+			level_ptr [i] = static_cast <DataType> (cos (i * mul));
 		}
 	}
 }
@@ -376,62 +513,175 @@ void	FFTReal <DT>::init_trigo_lut ()
 
 
 template <class DT>
-void	FFTReal <DT>::init_trigo_osc ()
+const long *	FFTReal <DT>::get_br_ptr () const
+{
+	return (&_br_lut [0]);
+}
+
+
+
+template <class DT>
+const typename FFTReal <DT>::DataType *	FFTReal <DT>::get_trigo_ptr (int level) const
+{
+	assert (level >= 3);
+
+	return (&_trigo_lut [get_trigo_level_index (level)]);
+}
+
+
+
+template <class DT>
+long	FFTReal <DT>::get_trigo_level_index (int level) const
+{
+	assert (level >= 3);
+
+	return ((1L << (level - 1)) - 4);
+}
+
+
+
+// Calls the pass function, with the thread pool if there is one
+template <class DT>
+void	FFTReal <DT>::run_pass (PassType type, DataType df [], const DataType sf [], int pass) const
 {
-	const int		nbr_osc = _nbr_bits - TRIGO_BD_LIMIT;
-	if (nbr_osc > 0)
+	if (_pool_ptr != 0 && _nbr_bits >= MIN_PARALLEL_BIT_DEPTH)
 	{
-		_trigo_osc.resize (nbr_osc);
+		PassTask			task;
+		task._fft_ptr = this;
+		task._type    = type;
+		task._df_ptr  = df;
+		task._sf_ptr  = sf;
+		task._pass    = pass;
+		_pool_ptr->run (&exec_pass_task, &task);
+	}
+	else
+	{
+		compute_pass (type, df, sf, pass, 0, 1);
+	}
+}
+
+
+
+template <class DT>
+void	FFTReal <DT>::exec_pass_task (void *ctx_ptr, int part, int nbr_parts)
+{
+	assert (ctx_ptr != 0);
+
+	const PassTask &	task = *static_cast <const PassTask *> (ctx_ptr);
+	task._fft_ptr->compute_pass (
+		task._type, task._df_ptr, task._sf_ptr, task._pass, part, nbr_parts
+	);
+}
+
 
-		for (int osc_cnt = 0; osc_cnt < nbr_osc; ++osc_cnt)
-		{
-			OscType &		osc = _trigo_osc [osc_cnt];
 
-			const long		len = 1L << (TRIGO_BD_LIMIT + osc_cnt);
-			const double	mul = (0.5 * PI) / len;
-			osc.set_step (mul);
+template <class DT>
+void	FFTReal <DT>::compute_pass (PassType type, DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const
+{
+	switch (type)
+	{
+	case	PassType_DIRECT_SPREAD:
+		FFTRealBitRev::direct_pass_spread (_length, df, sf, pass, part, nbr_parts);
+		break;
+	case	PassType_DIRECT_1_2:
+		if (_nbr_bits >= FFTRealBitRev::MIN_NBR_BITS)
+		{
+			FFTRealBitRev::direct_pass_1_2 (_length, df, sf, part, nbr_parts);
 		}
+		else
+		{
+			compute_direct_pass_1_2 (df, sf, part, nbr_parts);
+		}
+		break;
+	case	PassType_DIRECT_3:
+		compute_direct_pass_3 (df, sf, part, nbr_parts);
+		break;
+	case	PassType_DIRECT_N:
+		compute_direct_pass_n (df, sf, pass, part, nbr_parts);
+		break;
+	case	PassType_INVERSE_N:
+		compute_inverse_pass_n (df, sf, pass, part, nbr_parts);
+		break;
+	case	PassType_INVERSE_3:
+		compute_inverse_pass_3 (df, sf, part, nbr_parts);
+		break;
+	case	PassType_INVERSE_1_2:
+		compute_inverse_pass_1_2 (df, sf, part, nbr_parts);
+		break;
+	default:
+		assert (false);
+		break;
 	}
 }
 
 
 
+// [beg ; end[: items of the part, out of nbr_items
 template <class DT>
-const long *	FFTReal <DT>::get_br_ptr () const
+void	FFTReal <DT>::get_part_range (long &beg, long &end, long nbr_items, int part, int nbr_parts)
 {
-	return (&_br_lut [0]);
+	assert (nbr_items >= 0);
+	assert (part >= 0);
+	assert (part < nbr_parts);
+
+	const long		part_len = nbr_items / nbr_parts;
+	const long		rem = nbr_items % nbr_parts;
+
+	beg = part_len *  part      + std::min (long (part    ), rem);
+	end = part_len * (part + 1) + std::min (long (part + 1), rem);
 }
 
 
 
+// Parts of a pass made of butterfly groups: whole groups if there are enough
+// of them to balance the parts, otherwise slices [i_beg ; i_end[ of every
+// group.
 template <class DT>
-const typename FFTReal <DT>::DataType *	FFTReal <DT>::get_trigo_ptr (int level) const
+void	FFTReal <DT>::get_pass_range (long &grp_beg, long &grp_end, long &i_beg, long &i_end, int pass, int part, int nbr_parts) const
 {
-	assert (level >= 3);
+	const long		nbr_groups = _length >> (pass + 1);
+	const long		h_nbr_coef = 1L << (pass - 1);
 
-	return (&_trigo_lut [get_trigo_level_index (level)]);
+	if (nbr_groups >= nbr_parts * 8L)
+	{
+		get_part_range (grp_beg, grp_end, nbr_groups, part, nbr_parts);
+		i_beg = 0;
+		i_end = h_nbr_coef;
+	}
+	else
+	{
+		grp_beg = 0;
+		grp_end = nbr_groups;
+		get_part_range (i_beg, i_end, h_nbr_coef, part, nbr_parts);
+	}
 }
 
 
 
+// Number of first passes which can be replaced by
+// FFTRealBitRev::direct_pass_spread (), given the zero-padding of the source
 template <class DT>
-long	FFTReal <DT>::get_trigo_level_index (int level) const
+int	FFTReal <DT>::get_spread_bits () const
 {
-	assert (level >= 3);
+	int				blk_bits = 0;
+	while (blk_bits < _nbr_bits && _input_len <= (_length >> (blk_bits + 1)))
+	{
+		++ blk_bits;
+	}
 
-	return ((1L << (level - 1)) - 4);
+	return (blk_bits);
 }
 
 
 
 // Transform in several passes
 template <class DT>
-void	FFTReal <DT>::compute_fft_general (DataType f [], const DataType x []) const
+void	FFTReal <DT>::compute_fft_general (DataType f [], const DataType x [], DataType buffer []) const
 {
 	assert (f != 0);
-	assert (f != use_buffer ());
+	assert (f != buffer);
 	assert (x != 0);
-	assert (x != use_buffer ());
+	assert (x != buffer);
 	assert (x != f);
 
 	DataType *		sf;
@@ -439,21 +689,41 @@ void	FFTReal <DT>::compute_fft_general (DataType f [], const DataType x []) cons
 
 	if ((_nbr_bits & 1) != 0)
 	{
-		df = use_buffer ();
+		df = buffer;
 		sf = f;
 	}
 	else
 	{
 		df = f;
-		sf = use_buffer ();
+		sf = buffer;
 	}
 
-	compute_direct_pass_1_2 (df, x);
-	compute_direct_pass_3 (sf, df);
+	// The output of pass p (blocks of 2^p) is in df for even p, in sf for
+	// odd p. The loop reads sf.
+	int				pass = 3;
+	const int		spread_bits = get_spread_bits ();
+	if (spread_bits >= 3)
+	{
+		if ((spread_bits & 1) == 0)
+		{
+			run_pass (PassType_DIRECT_SPREAD, df, x, spread_bits);
+			std::swap (df, sf);
+		}
+		else
+		{
+			run_pass (PassType_DIRECT_SPREAD, sf, x, spread_bits);
+		}
+		pass = spread_bits;
+	}
+	else
+	{
+		run_pass (PassType_DIRECT_1_2, df, x, 2);
+		run_pass (PassType_DIRECT_3, sf, df, 3);
+	}
 
-	for (int pass = 3; pass < _nbr_bits; ++ pass)
+	for ( ; pass < _nbr_bits; ++ pass)
 	{
-		compute_direct_pass_n (df, sf, pass);
+		run_pass (PassType_DIRECT_N, df, sf, pass);
 
 		DataType * const	temp_ptr = df;
 		df = sf;
@@ -464,15 +734,19 @@ void	FFTReal <DT>::compute_fft_general (DataType f [], const DataType x []) cons
 
 
 template <class DT>
-void	FFTReal <DT>::compute_direct_pass_1_2 (DataType df [], const DataType x []) const
+void	FFTReal <DT>::compute_direct_pass_1_2 (DataType df [], const DataType x [], int part, int nbr_parts) const
 {
 	assert (df != 0);
 	assert (x != 0);
 	assert (df != x);
 
 	const long * const	bit_rev_lut_ptr = get_br_ptr ();
-	long				coef_index = 0;
-	do
+	long				coef_index;
+	long				coef_end;
+	get_part_range (coef_index, coef_end, _length >> 2, part, nbr_parts);
+	coef_index <<= 2;
+	coef_end <<= 2;
+	while (coef_index < coef_end)
 	{
 		const long		rev_index_0 = bit_rev_lut_ptr [coef_index];
 		const long		rev_index_1 = bit_rev_lut_ptr [coef_index + 1];
@@ -491,21 +765,24 @@ void	FFTReal <DT>::compute_direct_pass_1_2 (DataType df [], const DataType x [])
 		
 		coef_index += 4;
 	}
-	while (coef_index < _length);
 }
 
 
 
 template <class DT>
-void	FFTReal <DT>::compute_direct_pass_3 (DataType df [], const DataType sf []) const
+void	FFTReal <DT>::compute_direct_pass_3 (DataType df [], const DataType sf [], int part, int nbr_parts) const
 {
 	assert (df != 0);
 	assert (sf != 0);
 	assert (df != sf);
 
 	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
-	long				coef_index = 0;
-	do
+	long				coef_index;
+	long				coef_end;
+	get_part_range (coef_index, coef_end, _length >> 3, part, nbr_parts);
+	coef_index <<= 3;
+	coef_end <<= 3;
+	while (coef_index < coef_end)
 	{
 		DataType			v;
 
@@ -524,13 +801,12 @@ void	FFTReal <DT>::compute_direct_pass_3 (DataType df [], const DataType sf [])
 
 		coef_index += 8;
 	}
-	while (coef_index < _length);
 }
 
 
 
 template <class DT>
-void	FFTReal <DT>::compute_direct_pass_n (DataType df [], const DataType sf [], int pass) const
+void	FFTReal <DT>::compute_direct_pass_n (DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const
 {
 	assert (df != 0);
 	assert (sf != 0);
@@ -540,18 +816,18 @@ void	FFTReal <DT>::compute_direct_pass_n (DataType df [], const DataType sf [],
 
 	if (pass <= TRIGO_BD_LIMIT)
 	{
-		compute_direct_pass_n_lut (df, sf, pass);
+		compute_direct_pass_n_lut (df, sf, pass, part, nbr_parts);
 	}
 	else
 	{
-		compute_direct_pass_n_osc (df, sf, pass);
+		compute_direct_pass_n_osc (df, sf, pass, part, nbr_parts);
 	}
 }
 
 
 
 template <class DT>
-void	FFTReal <DT>::compute_direct_pass_n_lut (DataType df [], const DataType sf [], int pass) const
+void	FFTReal <DT>::compute_direct_pass_n_lut (DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const
 {
 	assert (df != 0);
 	assert (sf != 0);
@@ -562,9 +838,16 @@ void	FFTReal <DT>::compute_direct_pass_n_lut (DataType df [], const DataType sf
 	const long		nbr_coef = 1 << pass;
 	const long		h_nbr_coef = nbr_coef >> 1;
 	const long		d_nbr_coef = nbr_coef << 1;
-	long				coef_index = 0;
+	long				grp_beg;
+	long				grp_end;
+	long				i_beg;
+	long				i_end;
+	get_pass_range (grp_beg, grp_end, i_beg, i_end, pass, part, nbr_parts);
+	const long		i_loop = std::max (i_beg, 1L);
+	long				coef_index = grp_beg * d_nbr_coef;
+	const long		coef_end = grp_end * d_nbr_coef;
 	const DataType	* const	cos_ptr = get_trigo_ptr (pass);
-	do
+	while (coef_index < coef_end)
 	{
 		const DataType	* const	sf1r = sf + coef_index;
 		const DataType	* const	sf2r = sf1r + nbr_coef;
@@ -572,15 +855,18 @@ void	FFTReal <DT>::compute_direct_pass_n_lut (DataType df [], const DataType sf
 		DataType			* const	dfi = dfr + nbr_coef;
 
 		// Extreme coefficients are always real
-		dfr [0] = sf1r [0] + sf2r [0];
-		dfi [0] = sf1r [0] - sf2r [0];	// dfr [nbr_coef] =
-		dfr [h_nbr_coef] = sf1r [h_nbr_coef];
-		dfi [h_nbr_coef] = sf2r [h_nbr_coef];
+		if (i_beg == 0)
+		{
+			dfr [0] = sf1r [0] + sf2r [0];
+			dfi [0] = sf1r [0] - sf2r [0];	// dfr [nbr_coef] =
+			dfr [h_nbr_coef] = sf1r [h_nbr_coef];
+			dfi [h_nbr_coef] = sf2r [h_nbr_coef];
+		}
 
 		// Others are conjugate complex numbers
 		const DataType * const	sf1i = sf1r + h_nbr_coef;
 		const DataType * const	sf2i = sf1i + nbr_coef;
-		for (long i = 1; i < h_nbr_coef; ++ i)
+		for (long i = i_loop; i < i_end; ++ i)
 		{
 			const DataType	c = cos_ptr [i];					// cos (i*PI/nbr_coef);
 			const DataType	s = cos_ptr [h_nbr_coef - i];	// sin (i*PI/nbr_coef);
@@ -597,13 +883,12 @@ void	FFTReal <DT>::compute_direct_pass_n_lut (DataType df [], const DataType sf
 
 		coef_index += d_nbr_coef;
 	}
-	while (coef_index < _length);
 }
 
 
 
 template <class DT>
-void	FFTReal <DT>::compute_direct_pass_n_osc (DataType df [], const DataType sf [], int pass) const
+void	FFTReal <DT>::compute_direct_pass_n_osc (DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const
 {
 	assert (df != 0);
 	assert (sf != 0);
@@ -614,27 +899,46 @@ void	FFTReal <DT>::compute_direct_pass_n_osc (DataType df [], const DataType sf
 	const long		nbr_coef = 1 << pass;
 	const long		h_nbr_coef = nbr_coef >> 1;
 	const long		d_nbr_coef = nbr_coef << 1;
-	long				coef_index = 0;
-	OscType &		osc = _trigo_osc [pass - (TRIGO_BD_LIMIT + 1)];
-	do
+	long				grp_beg;
+	long				grp_end;
+	long				i_beg;
+	long				i_end;
+	get_pass_range (grp_beg, grp_end, i_beg, i_end, pass, part, nbr_parts);
+	const long		i_loop = std::max (i_beg, 1L);
+	long				coef_index = grp_beg * d_nbr_coef;
+	const long		coef_end = grp_end * d_nbr_coef;
+	// Local oscillator: the object is not modified, see do_fft ()
+	OscType			osc;
+	osc.set_step (PI / nbr_coef);
+	while (coef_index < coef_end)
 	{
 		const DataType	* const	sf1r = sf + coef_index;
 		const DataType	* const	sf2r = sf1r + nbr_coef;
 		DataType			* const	dfr = df + coef_index;
 		DataType			* const	dfi = dfr + nbr_coef;
 
-		osc.clear_buffers ();
+		if (i_loop > 1)
+		{
+			osc.set_phase ((i_loop - 1) * PI / nbr_coef);
+		}
+		else
+		{
+			osc.clear_buffers ();
+		}
 
 		// Extreme coefficients are always real
-		dfr [0] = sf1r [0] + sf2r [0];
-		dfi [0] = sf1r [0] - sf2r [0];	// dfr [nbr_coef] =
-		dfr [h_nbr_coef] = sf1r [h_nbr_coef];
-		dfi [h_nbr_coef] = sf2r [h_nbr_coef];
+		if (i_beg == 0)
+		{
+			dfr [0] = sf1r [0] + sf2r [0];
+			dfi [0] = sf1r [0] - sf2r [0];	// dfr [nbr_coef] =
+			dfr [h_nbr_coef] = sf1r [h_nbr_coef];
+			dfi [h_nbr_coef] = sf2r [h_nbr_coef];
+		}
 
 		// Others are conjugate complex numbers
 		const DataType * const	sf1i = sf1r + h_nbr_coef;
 		const DataType * const	sf2i = sf1i + nbr_coef;
-		for (long i = 1; i < h_nbr_coef; ++ i)
+		for (long i = i_loop; i < i_end; ++ i)
 		{
 			osc.step ();
 			const DataType	c = osc.get_cos ();
@@ -652,19 +956,18 @@ void	FFTReal <DT>::compute_direct_pass_n_osc (DataType df [], const DataType sf
 
 		coef_index += d_nbr_coef;
 	}
-	while (coef_index < _length);
 }
 
 
 
 // Transform in several pass
 template <class DT>
-void	FFTReal <DT>::compute_ifft_general (const DataType f [], DataType x []) const
+void	FFTReal <DT>::compute_ifft_general (const DataType f [], DataType x [], DataType buffer []) const
 {
 	assert (f != 0);
-	assert (f != use_buffer ());
+	assert (f != buffer);
 	assert (x != 0);
-	assert (x != use_buffer ());
+	assert (x != buffer);
 	assert (x != f);
 
 	DataType *		sf = const_cast <DataType *> (f);
@@ -673,18 +976,18 @@ void	FFTReal <DT>::compute_ifft_general (const DataType f [], DataType x []) con
 
 	if (_nbr_bits & 1)
 	{
-		df = use_buffer ();
+		df = buffer;
 		df_temp = x;
 	}
 	else
 	{
 		df = x;
-		df_temp = use_buffer ();
+		df_temp = buffer;
 	}
 
 	for (int pass = _nbr_bits - 1; pass >= 3; -- pass)
 	{
-		compute_inverse_pass_n (df, sf, pass);
+		run_pass (PassType_INVERSE_N, df, sf, pass);
 
 		if (pass < _nbr_bits - 1)
 		{
@@ -699,14 +1002,14 @@ void	FFTReal <DT>::compute_ifft_general (const DataType f [], DataType x []) con
 		}
 	}
 
-	compute_inverse_pass_3 (df, sf);
-	compute_inverse_pass_1_2 (x, df);
+	run_pass (PassType_INVERSE_3, df, sf, 3);
+	run_pass (PassType_INVERSE_1_2, x, df, 2);
 }
 
 
 
 template <class DT>
-void	FFTReal <DT>::compute_inverse_pass_n (DataType df [], const DataType sf [], int pass) const
+void	FFTReal <DT>::compute_inverse_pass_n (DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const
 {
 	assert (df != 0);
 	assert (sf != 0);
@@ -716,18 +1019,18 @@ void	FFTReal <DT>::compute_inverse_pass_n (DataType df [], const DataType sf [],
 
 	if (pass <= TRIGO_BD_LIMIT)
 	{
-		compute_inverse_pass_n_lut (df, sf, pass);
+		compute_inverse_pass_n_lut (df, sf, pass, part, nbr_parts);
 	}
 	else
 	{
-		compute_inverse_pass_n_osc (df, sf, pass);
+		compute_inverse_pass_n_osc (df, sf, pass, part, nbr_parts);
 	}
 }
 
 
 
 template <class DT>
-void	FFTReal <DT>::compute_inverse_pass_n_lut (DataType df [], const DataType sf [], int pass) const
+void	FFTReal <DT>::compute_inverse_pass_n_lut (DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const
 {
 	assert (df != 0);
 	assert (sf != 0);
@@ -738,9 +1041,16 @@ void	FFTReal <DT>::compute_inverse_pass_n_lut (DataType df [], const DataType sf
 	const long		nbr_coef = 1 << pass;
 	const long		h_nbr_coef = nbr_coef >> 1;
 	const long		d_nbr_coef = nbr_coef << 1;
-	long				coef_index = 0;
+	long				grp_beg;
+	long				grp_end;
+	long				i_beg;
+	long				i_end;
+	get_pass_range (grp_beg, grp_end, i_beg, i_end, pass, part, nbr_parts);
+	const long		i_loop = std::max (i_beg, 1L);
+	long				coef_index = grp_beg * d_nbr_coef;
+	const long		coef_end = grp_end * d_nbr_coef;
 	const DataType * const	cos_ptr = get_trigo_ptr (pass);
-	do
+	while (coef_index < coef_end)
 	{
 		const DataType	* const	sfr = sf + coef_index;
 		const DataType	* const	sfi = sfr + nbr_coef;
@@ -748,15 +1058,18 @@ void	FFTReal <DT>::compute_inverse_pass_n_lut (DataType df [], const DataType sf
 		DataType			* const	df2r = df1r + nbr_coef;
 
 		// Extreme coefficients are always real
-		df1r [0] = sfr [0] + sfi [0];		// + sfr [nbr_coef]
-		df2r [0] = sfr [0] - sfi [0];		// - sfr [nbr_coef]
-		df1r [h_nbr_coef] = sfr [h_nbr_coef] * 2;
-		df2r [h_nbr_coef] = sfi [h_nbr_coef] * 2;
+		if (i_beg == 0)
+		{
+			df1r [0] = sfr [0] + sfi [0];		// + sfr [nbr_coef]
+			df2r [0] = sfr [0] - sfi [0];		// - sfr [nbr_coef]
+			df1r [h_nbr_coef] = sfr [h_nbr_coef] * 2;
+			df2r [h_nbr_coef] = sfi [h_nbr_coef] * 2;
+		}
 
 		// Others are conjugate complex numbers
 		DataType * const	df1i = df1r + h_nbr_coef;
 		DataType * const	df2i = df1i + nbr_coef;
-		for (long i = 1; i < h_nbr_coef; ++ i)
+		for (long i = i_loop; i < i_end; ++ i)
 		{
 			df1r [i] = sfr [i] + sfi [-i];		// + sfr [nbr_coef - i]
 			df1i [i] = sfi [i] - sfi [nbr_coef - i];
@@ -772,13 +1085,12 @@ void	FFTReal <DT>::compute_inverse_pass_n_lut (DataType df [], const DataType sf
 
 		coef_index += d_nbr_coef;
 	}
-	while (coef_index < _length);
 }
 
 
 
 template <class DT>
-void	FFTReal <DT>::compute_inverse_pass_n_osc (DataType df [], const DataType sf [], int pass) const
+void	FFTReal <DT>::compute_inverse_pass_n_osc (DataType df [], const DataType sf [], int pass, int part, int nbr_parts) const
 {
 	assert (df != 0);
 	assert (sf != 0);
@@ -789,27 +1101,46 @@ void	FFTReal <DT>::compute_inverse_pass_n_osc (DataType df [], const DataType sf
 	const long		nbr_coef = 1 << pass;
 	const long		h_nbr_coef = nbr_coef >> 1;
 	const long		d_nbr_coef = nbr_coef << 1;
-	long				coef_index = 0;
-	OscType &		osc = _trigo_osc [pass - (TRIGO_BD_LIMIT + 1)];
-	do
+	long				grp_beg;
+	long				grp_end;
+	long				i_beg;
+	long				i_end;
+	get_pass_range (grp_beg, grp_end, i_beg, i_end, pass, part, nbr_parts);
+	const long		i_loop = std::max (i_beg, 1L);
+	long				coef_index = grp_beg * d_nbr_coef;
+	const long		coef_end = grp_end * d_nbr_coef;
+	// Local oscillator: the object is not modified, see do_fft ()
+	OscType			osc;
+	osc.set_step (PI / nbr_coef);
+	while (coef_index < coef_end)
 	{
 		const DataType	* const	sfr = sf + coef_index;
 		const DataType	* const	sfi = sfr + nbr_coef;
 		DataType			* const	df1r = df + coef_index;
 		DataType			* const	df2r = df1r + nbr_coef;
 
-		osc.clear_buffers ();
+		if (i_loop > 1)
+		{
+			osc.set_phase ((i_loop - 1) * PI / nbr_coef);
+		}
+		else
+		{
+			osc.clear_buffers ();
+		}
 
 		// Extreme coefficients are always real
-		df1r [0] = sfr [0] + sfi [0];		// + sfr [nbr_coef]
-		df2r [0] = sfr [0] - sfi [0];		// - sfr [nbr_coef]
-		df1r [h_nbr_coef] = sfr [h_nbr_coef] * 2;
-		df2r [h_nbr_coef] = sfi [h_nbr_coef] * 2;
+		if (i_beg == 0)
+		{
+			df1r [0] = sfr [0] + sfi [0];		// + sfr [nbr_coef]
+			df2r [0] = sfr [0] - sfi [0];		// - sfr [nbr_coef]
+			df1r [h_nbr_coef] = sfr [h_nbr_coef] * 2;
+			df2r [h_nbr_coef] = sfi [h_nbr_coef] * 2;
+		}
 
 		// Others are conjugate complex numbers
 		DataType * const	df1i = df1r + h_nbr_coef;
 		DataType * const	df2i = df1i + nbr_coef;
-		for (long i = 1; i < h_nbr_coef; ++ i)
+		for (long i = i_loop; i < i_end; ++ i)
 		{
 			df1r [i] = sfr [i] + sfi [-i];		// + sfr [nbr_coef - i]
 			df1i [i] = sfi [i] - sfi [nbr_coef - i];
@@ -826,21 +1157,24 @@ void	FFTReal <DT>::compute_inverse_pass_n_osc (DataType df [], const DataType sf
 
 		coef_index += d_nbr_coef;
 	}
-	while (coef_index < _length);
 }
 
 
 
 template <class DT>
-void	FFTReal <DT>::compute_inverse_pass_3 (DataType df [], const DataType sf []) const
+void	FFTReal <DT>::compute_inverse_pass_3 (DataType df [], const DataType sf [], int part, int nbr_parts) const
 {
 	assert (df != 0);
 	assert (sf != 0);
 	assert (df != sf);
 
 	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
-	long				coef_index = 0;
-	do
+	long				coef_index;
+	long				coef_end;
+	get_part_range (coef_index, coef_end, _length >> 3, part, nbr_parts);
+	coef_index <<= 3;
+	coef_end <<= 3;
+	while (coef_index < coef_end)
 	{
 		df [coef_index] = sf [coef_index] + sf [coef_index + 4];
 		df [coef_index + 4] = sf [coef_index] - sf [coef_index + 4];
@@ -858,22 +1192,25 @@ void	FFTReal <DT>::compute_inverse_pass_3 (DataType df [], const DataType sf [])
 
 		coef_index += 8;
 	}
-	while (coef_index < _length);
 }
 
 
 
 template <class DT>
-void	FFTReal <DT>::compute_inverse_pass_1_2 (DataType x [], const DataType sf []) const
+void	FFTReal <DT>::compute_inverse_pass_1_2 (DataType x [], const DataType sf [], int part, int nbr_parts) const
 {
 	assert (x != 0);
 	assert (sf != 0);
 	assert (x != sf);
 
-	const long *	bit_rev_lut_ptr = get_br_ptr ();
-	const DataType *	sf2 = sf;
-	long				coef_index = 0;
-	do
+	long				coef_index;
+	long				coef_end;
+	get_part_range (coef_index, coef_end, _length >> 3, part, nbr_parts);
+	coef_index <<= 3;
+	coef_end <<= 3;
+	const long *	bit_rev_lut_ptr = get_br_ptr () + coef_index;
+	const DataType *	sf2 = sf + coef_index;
+	while (coef_index < coef_end)
 	{
 		{
 			const DataType	b_0 = sf2 [0] + sf2 [2];
@@ -902,7 +1239,6 @@ void	FFTReal <DT>::compute_inverse_pass_1_2 (DataType x [], const DataType sf []
 		coef_index += 8;
 		bit_rev_lut_ptr += 8;
 	}
-	while (coef_index < _length);
 }
 
 
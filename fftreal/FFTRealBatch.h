@@ -0,0 +1,168 @@
+/*****************************************************************************
+
+        FFTRealBatch.h
+
+Transforms several frames of the same length in one call. Frames are
+processed in groups of NBR_LANES, interleaved so that each vector lane holds
+one frame: the bit-reversal and twiddle tables are read once per group and
+every butterfly works on NBR_LANES frames at a time.
+
+The passes follow the same algorithm as FFTReal and give the same
+half-complex output layout.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealBatch_HEADER_INCLUDED)
+#define	FFTRealBatch_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"DynArray.h"
+#include	"FFTRealFixLenParam.h"
+#include	"FFTRealSimd.h"
+#include	"FFTRealTable.h"
+
+// The lanes are mapped on SSE2 registers only when the compiler may use
+// SSE2 everywhere (always the case on x86-64); otherwise plain arrays are
+// used and left to the optimiser.
+#if defined (FFTRealSimd_X86)
+	#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define	FFTRealBatch_SSE2
+	#endif
+#endif
+
+
+
+class FFTRealBatch
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	enum {			NBR_LANES		= 4	};
+	enum {			MIN_BIT_DEPTH	= 3	};
+	enum {			MAX_BIT_DEPTH	= 30	};	// So length can be represented as long int
+
+	typedef	FFTRealFixLenParam::DataType	DataType;
+
+	explicit inline	FFTRealBatch (long length);
+						~FFTRealBatch () {}
+
+	inline long		get_length () const;
+	inline void		do_fft (DataType f [], const DataType x [], long nbr_frames);
+	inline void		do_fft (DataType f [], long f_stride, const DataType x [], long x_stride, long nbr_frames);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+#if defined (FFTRealBatch_SSE2)
+	typedef	__m128	VecType;
+#else
+	struct VecType
+	{
+		DataType			_lane [NBR_LANES];
+	};
+#endif
+
+	FORCEINLINE static VecType
+						load (const DataType ptr []);
+	FORCEINLINE static void
+						store (DataType ptr [], VecType v);
+	FORCEINLINE static VecType
+						set1 (DataType a);
+	FORCEINLINE static VecType
+						add (VecType a, VecType b);
+	FORCEINLINE static VecType
+						sub (VecType a, VecType b);
+	FORCEINLINE static VecType
+						mul (VecType a, VecType b);
+	FORCEINLINE static VecType
+						gather (const DataType * const x_ptr_arr [NBR_LANES], long pos);
+
+	static inline int
+						compute_nbr_bits (long length);
+	static inline long
+						get_trigo_lut_size (int nbr_bits);
+	static inline void
+						init_br_lut (long table_ptr [], long size, long length);
+	static inline void
+						init_trigo_lut (DataType table_ptr [], long size, long length);
+
+	inline void		compute_group (DataType * const f_ptr_arr [NBR_LANES], const DataType * const x_ptr_arr [NBR_LANES]);
+	inline void		compute_direct_pass_1_2 (DataType df [], const DataType * const x_ptr_arr [NBR_LANES]) const;
+	inline void		compute_direct_pass_3 (DataType df [], const DataType sf []) const;
+	inline void		compute_direct_pass_n (DataType df [], const DataType sf [], int pass) const;
+	inline void		deinterleave (DataType * const f_ptr_arr [NBR_LANES], const DataType sf []) const;
+
+	const long		_length;
+	const int		_nbr_bits;
+	FFTRealTable <long>
+						_br_lut;
+	FFTRealTable <DataType>
+						_trigo_lut;
+	DynArray <DataType>
+						_buffer_1;
+	DynArray <DataType>
+						_buffer_2;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealBatch ();
+						FFTRealBatch (const FFTRealBatch &other);
+	FFTRealBatch &	operator = (const FFTRealBatch &other);
+	bool				operator == (const FFTRealBatch &other);
+	bool				operator != (const FFTRealBatch &other);
+
+};	// class FFTRealBatch
+
+
+
+#include	"FFTRealBatch.hpp"
+
+
+
+#endif	// FFTRealBatch_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,562 @@
+/*****************************************************************************
+
+        FFTRealBatch.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealBatch_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealBatch code header.
+#endif
+#define	FFTRealBatch_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealBatch_CODEHEADER_INCLUDED)
+#define	FFTRealBatch_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- length: length of each frame. Range: power of 2 only, >= 8.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+FFTRealBatch::FFTRealBatch (long length)
+:	_length (length)
+,	_nbr_bits (compute_nbr_bits (length))
+,	_br_lut (&init_br_lut, length, length)
+,	_trigo_lut (&init_trigo_lut, get_trigo_lut_size (_nbr_bits), length)
+,	_buffer_1 (length * NBR_LANES)
+,	_buffer_2 (length * NBR_LANES)
+{
+	assert (length > 0);
+	assert ((length & -length) == length);
+	assert (_nbr_bits >= MIN_BIT_DEPTH);
+	assert (_nbr_bits <= MAX_BIT_DEPTH);
+}
+
+
+
+/*
+==============================================================================
+Name: get_length
+Description:
+	Returns the number of points in each frame.
+Returns: The number of points, power of 2, >= 8.
+Throws: Nothing
+==============================================================================
+*/
+
+long	FFTRealBatch::get_length () const
+{
+	return (_length);
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Compute the FFT of nbr_frames contiguous frames. Each output frame has
+	the same layout as FFTReal::do_fft ().
+Input parameters:
+	- x: pointer on the source frames (time), nbr_frames * length values.
+	- nbr_frames: number of frames to transform, >= 0.
+Output parameters:
+	- f: pointer on the destination frames (frequencies), nbr_frames * length
+		values. Must not overlap x.
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealBatch::do_fft (DataType f [], const DataType x [], long nbr_frames)
+{
+	do_fft (f, _length, x, _length, nbr_frames);
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Compute the FFT of nbr_frames frames located at regular intervals in
+	memory. Source frames may overlap (for example frames taken with a hop
+	size smaller than the length).
+Input parameters:
+	- f_stride: distance between the first values of two consecutive
+		destination frames. Range: >= length.
+	- x: pointer on the first source frame (time).
+	- x_stride: distance between the first values of two consecutive source
+		frames.
+	- nbr_frames: number of frames to transform, >= 0.
+Output parameters:
+	- f: pointer on the first destination frame (frequencies). Must not
+		overlap the source frames.
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealBatch::do_fft (DataType f [], long f_stride, const DataType x [], long x_stride, long nbr_frames)
+{
+	assert (f != 0);
+	assert (f_stride >= _length);
+	assert (x != 0);
+	assert (nbr_frames >= 0);
+
+	for (long frame = 0; frame < nbr_frames; frame += NBR_LANES)
+	{
+		const DataType *	x_ptr_arr [NBR_LANES];
+		DataType *			f_ptr_arr [NBR_LANES];
+		for (int lane = 0; lane < NBR_LANES; ++lane)
+		{
+			const long		index = frame + lane;
+			if (index < nbr_frames)
+			{
+				x_ptr_arr [lane] = x + index * x_stride;
+				f_ptr_arr [lane] = f + index * f_stride;
+			}
+
+			// Incomplete group: unused lanes compute the first frame again,
+			// their result is dropped.
+			else
+			{
+				x_ptr_arr [lane] = x_ptr_arr [0];
+				f_ptr_arr [lane] = 0;
+			}
+		}
+
+		compute_group (f_ptr_arr, x_ptr_arr);
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+#if defined (FFTRealBatch_SSE2)
+
+FFTRealBatch::VecType	FFTRealBatch::load (const DataType ptr [])
+{
+	return (_mm_loadu_ps (ptr));
+}
+
+void	FFTRealBatch::store (DataType ptr [], VecType v)
+{
+	_mm_storeu_ps (ptr, v);
+}
+
+FFTRealBatch::VecType	FFTRealBatch::set1 (DataType a)
+{
+	return (_mm_set1_ps (a));
+}
+
+FFTRealBatch::VecType	FFTRealBatch::add (VecType a, VecType b)
+{
+	return (_mm_add_ps (a, b));
+}
+
+FFTRealBatch::VecType	FFTRealBatch::sub (VecType a, VecType b)
+{
+	return (_mm_sub_ps (a, b));
+}
+
+FFTRealBatch::VecType	FFTRealBatch::mul (VecType a, VecType b)
+{
+	return (_mm_mul_ps (a, b));
+}
+
+FFTRealBatch::VecType	FFTRealBatch::gather (const DataType * const x_ptr_arr [NBR_LANES], long pos)
+{
+	return (_mm_setr_ps (
+		x_ptr_arr [0] [pos],
+		x_ptr_arr [1] [pos],
+		x_ptr_arr [2] [pos],
+		x_ptr_arr [3] [pos]
+	));
+}
+
+#else	// FFTRealBatch_SSE2
+
+FFTRealBatch::VecType	FFTRealBatch::load (const DataType ptr [])
+{
+	VecType			v;
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		v._lane [lane] = ptr [lane];
+	}
+
+	return (v);
+}
+
+void	FFTRealBatch::store (DataType ptr [], VecType v)
+{
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		ptr [lane] = v._lane [lane];
+	}
+}
+
+FFTRealBatch::VecType	FFTRealBatch::set1 (DataType a)
+{
+	VecType			v;
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		v._lane [lane] = a;
+	}
+
+	return (v);
+}
+
+FFTRealBatch::VecType	FFTRealBatch::add (VecType a, VecType b)
+{
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		a._lane [lane] += b._lane [lane];
+	}
+
+	return (a);
+}
+
+FFTRealBatch::VecType	FFTRealBatch::sub (VecType a, VecType b)
+{
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		a._lane [lane] -= b._lane [lane];
+	}
+
+	return (a);
+}
+
+FFTRealBatch::VecType	FFTRealBatch::mul (VecType a, VecType b)
+{
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		a._lane [lane] *= b._lane [lane];
+	}
+
+	return (a);
+}
+
+FFTRealBatch::VecType	FFTRealBatch::gather (const DataType * const x_ptr_arr [NBR_LANES], long pos)
+{
+	VecType			v;
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		v._lane [lane] = x_ptr_arr [lane] [pos];
+	}
+
+	return (v);
+}
+
+#endif	// FFTRealBatch_SSE2
+
+
+
+int	FFTRealBatch::compute_nbr_bits (long length)
+{
+	int				nbr_bits = 0;
+	while ((1L << nbr_bits) < length)
+	{
+		++ nbr_bits;
+	}
+
+	return (nbr_bits);
+}
+
+
+
+long	FFTRealBatch::get_trigo_lut_size (int nbr_bits)
+{
+	return ((nbr_bits > 3) ? (1L << (nbr_bits - 1)) - 4 : 0);
+}
+
+
+
+// The tables are shared between all the objects of the same length, see
+// FFTRealTable.
+void	FFTRealBatch::init_br_lut (long table_ptr [], long size, long length)
+{
+	assert (size == length);
+
+	table_ptr [0] = 0;
+	long				br_index = 0;
+	for (long cnt = 1; cnt < length; ++cnt)
+	{
+		// ++br_index (bit reversed)
+		long				bit = length >> 1;
+		while (((br_index ^= bit) & bit) == 0)
+		{
+			bit >>= 1;
+		}
+
+		table_ptr [cnt] = br_index;
+	}
+}
+
+
+
+// Same layout as FFTReal, but all the passes use the table: there is no
+// accumulated error from oscillators, whatever the length.
+void	FFTRealBatch::init_trigo_lut (DataType table_ptr [], long size, long length)
+{
+	using namespace std;
+
+	const int		nbr_bits = compute_nbr_bits (length);
+	assert (size == get_trigo_lut_size (nbr_bits));
+
+	for (int level = 3; level < nbr_bits; ++level)
+	{
+		const long		level_len = 1L << (level - 1);
+		DataType	* const	level_ptr = table_ptr + (level_len - 4);
+		const double	mul = PI / (level_len << 1);
+
+		for (long i = 0; i < level_len; ++ i)
+		{
+			level_ptr [i] = static_cast <DataType> (cos (i * mul));
+		}
+	}
+}
+
+
+
+void	FFTRealBatch::compute_group (DataType * const f_ptr_arr [NBR_LANES], const DataType * const x_ptr_arr [NBR_LANES])
+{
+	DataType *		df = &_buffer_1 [0];
+	DataType *		sf = &_buffer_2 [0];
+
+	compute_direct_pass_1_2 (df, x_ptr_arr);
+	compute_direct_pass_3 (sf, df);
+
+	for (int pass = 3; pass < _nbr_bits; ++ pass)
+	{
+		compute_direct_pass_n (df, sf, pass);
+
+		DataType * const	temp_ptr = df;
+		df = sf;
+		sf = temp_ptr;
+	}
+
+	deinterleave (f_ptr_arr, sf);
+}
+
+
+
+void	FFTRealBatch::compute_direct_pass_1_2 (DataType df [], const DataType * const x_ptr_arr [NBR_LANES]) const
+{
+	assert (df != 0);
+
+	const long * const	bit_rev_lut_ptr = &_br_lut [0];
+	long				coef_index = 0;
+	do
+	{
+		const VecType	x_0 = gather (x_ptr_arr, bit_rev_lut_ptr [coef_index    ]);
+		const VecType	x_1 = gather (x_ptr_arr, bit_rev_lut_ptr [coef_index + 1]);
+		const VecType	x_2 = gather (x_ptr_arr, bit_rev_lut_ptr [coef_index + 2]);
+		const VecType	x_3 = gather (x_ptr_arr, bit_rev_lut_ptr [coef_index + 3]);
+
+		DataType	* const	df2 = df + coef_index * NBR_LANES;
+		store (df2 + 1 * NBR_LANES, sub (x_0, x_1));
+		store (df2 + 3 * NBR_LANES, sub (x_2, x_3));
+
+		const VecType	sf_0 = add (x_0, x_1);
+		const VecType	sf_2 = add (x_2, x_3);
+
+		store (df2                , add (sf_0, sf_2));
+		store (df2 + 2 * NBR_LANES, sub (sf_0, sf_2));
+
+		coef_index += 4;
+	}
+	while (coef_index < _length);
+}
+
+
+
+void	FFTRealBatch::compute_direct_pass_3 (DataType df [], const DataType sf []) const
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+
+	const VecType	sqrt2_2 = set1 (DataType (SQRT2 * 0.5));
+	long				coef_index = 0;
+	do
+	{
+		const DataType	* const	s = sf + coef_index * NBR_LANES;
+		DataType			* const	d = df + coef_index * NBR_LANES;
+
+		const VecType	s_0 = load (s                );
+		const VecType	s_1 = load (s + 1 * NBR_LANES);
+		const VecType	s_3 = load (s + 3 * NBR_LANES);
+		const VecType	s_4 = load (s + 4 * NBR_LANES);
+		const VecType	s_5 = load (s + 5 * NBR_LANES);
+		const VecType	s_7 = load (s + 7 * NBR_LANES);
+
+		store (d                , add (s_0, s_4));
+		store (d + 4 * NBR_LANES, sub (s_0, s_4));
+		store (d + 2 * NBR_LANES, load (s + 2 * NBR_LANES));
+		store (d + 6 * NBR_LANES, load (s + 6 * NBR_LANES));
+
+		VecType			v;
+
+		v = mul (sub (s_5, s_7), sqrt2_2);
+		store (d + 1 * NBR_LANES, add (s_1, v));
+		store (d + 3 * NBR_LANES, sub (s_1, v));
+
+		v = mul (add (s_5, s_7), sqrt2_2);
+		store (d + 5 * NBR_LANES, add (v, s_3));
+		store (d + 7 * NBR_LANES, sub (v, s_3));
+
+		coef_index += 8;
+	}
+	while (coef_index < _length);
+}
+
+
+
+void	FFTRealBatch::compute_direct_pass_n (DataType df [], const DataType sf [], int pass) const
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (pass >= 3);
+	assert (pass < _nbr_bits);
+
+	const long		nbr_coef = 1 << pass;
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	const long		nbr_coef_v = nbr_coef * NBR_LANES;
+	const long		h_nbr_coef_v = h_nbr_coef * NBR_LANES;
+	long				coef_index = 0;
+	const DataType	* const	cos_ptr = &_trigo_lut [(1L << (pass - 1)) - 4];
+	do
+	{
+		const DataType	* const	sf1r = sf + coef_index * NBR_LANES;
+		const DataType	* const	sf2r = sf1r + nbr_coef_v;
+		DataType			* const	dfr = df + coef_index * NBR_LANES;
+		DataType			* const	dfi = dfr + nbr_coef_v;
+
+		// Extreme coefficients are always real
+		const VecType	sf1r_0 = load (sf1r);
+		const VecType	sf2r_0 = load (sf2r);
+		store (dfr, add (sf1r_0, sf2r_0));
+		store (dfi, sub (sf1r_0, sf2r_0));
+		store (dfr + h_nbr_coef_v, load (sf1r + h_nbr_coef_v));
+		store (dfi + h_nbr_coef_v, load (sf2r + h_nbr_coef_v));
+
+		// Others are conjugate complex numbers
+		const DataType * const	sf1i = sf1r + h_nbr_coef_v;
+		const DataType * const	sf2i = sf1i + nbr_coef_v;
+		for (long i = 1; i < h_nbr_coef; ++ i)
+		{
+			const VecType	c = set1 (cos_ptr [i]);					// cos (i*PI/nbr_coef);
+			const VecType	s = set1 (cos_ptr [h_nbr_coef - i]);	// sin (i*PI/nbr_coef);
+			const long		iv = i * NBR_LANES;
+
+			const VecType	s1r = load (sf1r + iv);
+			const VecType	s1i = load (sf1i + iv);
+			const VecType	s2r = load (sf2r + iv);
+			const VecType	s2i = load (sf2i + iv);
+			VecType			v;
+
+			v = sub (mul (s2r, c), mul (s2i, s));
+			store (dfr + iv, add (s1r, v));
+			store (dfi - iv, sub (s1r, v));
+
+			v = add (mul (s2r, s), mul (s2i, c));
+			store (dfi + iv, add (v, s1i));
+			store (dfi + nbr_coef_v - iv, sub (v, s1i));
+		}
+
+		coef_index += d_nbr_coef;
+	}
+	while (coef_index < _length);
+}
+
+
+
+void	FFTRealBatch::deinterleave (DataType * const f_ptr_arr [NBR_LANES], const DataType sf []) const
+{
+	assert (sf != 0);
+
+#if defined (FFTRealBatch_SSE2)
+
+	for (long pos = 0; pos < _length; pos += 4)
+	{
+		const DataType	* const	s = sf + pos * NBR_LANES;
+		__m128			v_0 = load (s                );
+		__m128			v_1 = load (s + 1 * NBR_LANES);
+		__m128			v_2 = load (s + 2 * NBR_LANES);
+		__m128			v_3 = load (s + 3 * NBR_LANES);
+		_MM_TRANSPOSE4_PS (v_0, v_1, v_2, v_3);
+
+		if (f_ptr_arr [0] != 0) { store (f_ptr_arr [0] + pos, v_0); }
+		if (f_ptr_arr [1] != 0) { store (f_ptr_arr [1] + pos, v_1); }
+		if (f_ptr_arr [2] != 0) { store (f_ptr_arr [2] + pos, v_2); }
+		if (f_ptr_arr [3] != 0) { store (f_ptr_arr [3] + pos, v_3); }
+	}
+
+#else	// FFTRealBatch_SSE2
+
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		DataType * const	f = f_ptr_arr [lane];
+		if (f != 0)
+		{
+			for (long pos = 0; pos < _length; ++pos)
+			{
+				f [pos] = sf [pos * NBR_LANES + lane];
+			}
+		}
+	}
+
+#endif	// FFTRealBatch_SSE2
+}
+
+
+
+#endif	// FFTRealBatch_CODEHEADER_INCLUDED
+
+#undef FFTRealBatch_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,101 @@
+/*****************************************************************************
+
+        FFTRealBitRev.h
+
+First and second passes of the direct FFT with a blocked bit-reversal
+(COBRA-like), for large lengths. Reading the source in bit-reversed order
+touches a new cache line, and quickly a new page, for nearly every sample.
+Here the index is split into 3 fields, a | b | c, the first and last ones
+being BLOCK_L2 bits wide. For each value of b, a square tile is filled from
+1 << BLOCK_L2 contiguous runs of the source, then written to as many
+contiguous runs of the destination. The butterflies of the first two passes
+are done while the tile is written.
+
+direct_pass_spread () replaces the first passes when the source is zero-
+padded: in bit-reversed order, each block then holds a single non-zero
+sample, whose spectrum is flat.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealBitRev_HEADER_INCLUDED)
+#define	FFTRealBitRev_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+
+
+
+class FFTRealBitRev
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	// Tile side. The tile takes (1 << BLOCK_L2) ^ 2 elements on the stack.
+	enum {			BLOCK_L2			= 5	};
+
+	// Under this length, the source fits in the cache and the table-based
+	// pass is faster.
+	enum {			MIN_NBR_BITS	= 16	};
+
+	template <class DT, class XR>
+	static void		direct_pass_1_2 (long len, DT df [], XR x, int part = 0, int nbr_parts = 1);
+	template <class DT, class XR>
+	static void		direct_pass_spread (long len, DT df [], XR x, int blk_bits, int part = 0, int nbr_parts = 1);
+
+	static inline long
+						reverse (long index, int nbr_bits);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealBitRev ();
+						~FFTRealBitRev ();
+						FFTRealBitRev (const FFTRealBitRev &other);
+	FFTRealBitRev &
+						operator = (const FFTRealBitRev &other);
+	bool				operator == (const FFTRealBitRev &other);
+	bool				operator != (const FFTRealBitRev &other);
+
+};	// class FFTRealBitRev
+
+
+
+#include	"FFTRealBitRev.hpp"
+
+
+
+#endif	// FFTRealBitRev_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
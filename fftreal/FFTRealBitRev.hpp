@@ -0,0 +1,237 @@
+/*****************************************************************************
+
+        FFTRealBitRev.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealBitRev_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealBitRev code header.
+#endif
+#define	FFTRealBitRev_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealBitRev_CODEHEADER_INCLUDED)
+#define	FFTRealBitRev_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<algorithm>
+#include	<cassert>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: direct_pass_1_2
+Description:
+	Same result as the first two passes of the direct FFT with a bit-reversal
+	lookup table: the source is read in bit-reversed order and the radix-2
+	butterflies of passes 1 and 2 are applied on each group of 4 values.
+Input parameters:
+	- len: FFT length, a power of 2, >= 1 << (BLOCK_L2 * 2).
+	- x: source (time), anything accepting x [pos] for pos in [0 ; len[.
+	- part, nbr_parts: the work can be split in nbr_parts independent parts
+		of about the same size. Only the part-th one is done here.
+Output parameters:
+	- df: destination array, len values. Must not overlap the source.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT, class XR>
+void	FFTRealBitRev::direct_pass_1_2 (long len, DT df [], XR x, int part, int nbr_parts)
+{
+	assert (df != 0);
+	assert (len >= 1L << (BLOCK_L2 * 2));
+	assert (part >= 0);
+	assert (part < nbr_parts);
+
+	int				nbr_bits = 0;
+	while ((1L << nbr_bits) < len)
+	{
+		++ nbr_bits;
+	}
+	assert (len == 1L << nbr_bits);
+
+	const long		blk_len = 1L << BLOCK_L2;
+	const int		mid_bits = nbr_bits - BLOCK_L2 * 2;
+	const int		hi_shift = nbr_bits - BLOCK_L2;
+	const long		nbr_mid = 1L << mid_bits;
+	const long		b_beg = nbr_mid *  part      / nbr_parts;
+	const long		b_end = nbr_mid * (part + 1) / nbr_parts;
+
+	long				br_blk [1 << BLOCK_L2];
+	for (long i = 0; i < blk_len; ++i)
+	{
+		br_blk [i] = reverse (i, BLOCK_L2);
+	}
+
+	// tile [a * blk_len + c] is the source of destination a | b | c
+	DT					tile [1 << (BLOCK_L2 * 2)];
+
+	for (long b = b_beg; b < b_end; ++b)
+	{
+		const long		src_mid = reverse (b, mid_bits) << BLOCK_L2;
+		const long		dst_mid = b << BLOCK_L2;
+
+		// Source a | b | c is at rev (c) | rev (b) | rev (a)
+		for (long c = 0; c < blk_len; ++c)
+		{
+			const long		src_pos = (br_blk [c] << hi_shift) + src_mid;
+			for (long j = 0; j < blk_len; ++j)
+			{
+				tile [br_blk [j] * blk_len + c] = x [src_pos + j];
+			}
+		}
+
+		for (long a = 0; a < blk_len; ++a)
+		{
+			const DT	* const	sf = tile + a * blk_len;
+			DT			* const	df2 = df + (a << hi_shift) + dst_mid;
+			for (long c = 0; c < blk_len; c += 4)
+			{
+				df2 [c + 1] = sf [c    ] - sf [c + 1];
+				df2 [c + 3] = sf [c + 2] - sf [c + 3];
+
+				const DT			sf_0 = sf [c    ] + sf [c + 1];
+				const DT			sf_2 = sf [c + 2] + sf [c + 3];
+
+				df2 [c    ] = sf_0 + sf_2;
+				df2 [c + 2] = sf_0 - sf_2;
+			}
+		}
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: direct_pass_spread
+Description:
+	Same result as the first blk_bits passes of the direct FFT, when only the
+	first len >> blk_bits samples of the source can be non-zero. Each block
+	of 1 << blk_bits values in bit-reversed order then holds a single non-
+	zero sample, the first one. Its spectrum is real and flat: the real part
+	of each bin is the sample value, the imaginary parts are null.
+Input parameters:
+	- len: FFT length, a power of 2.
+	- x: source (time), anything accepting x [pos] for pos in
+		[0 ; len >> blk_bits[.
+	- blk_bits: base-2 logarithm of the block length, in [1 ; log2 (len)].
+	- part, nbr_parts: the work can be split in nbr_parts independent parts
+		of about the same size. Only the part-th one is done here.
+Output parameters:
+	- df: destination array, len values, laid out like the output of pass
+		blk_bits. Must not overlap the source.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT, class XR>
+void	FFTRealBitRev::direct_pass_spread (long len, DT df [], XR x, int blk_bits, int part, int nbr_parts)
+{
+	assert (df != 0);
+	assert (blk_bits > 0);
+	assert ((len >> blk_bits) > 0);
+	assert (part >= 0);
+	assert (part < nbr_parts);
+
+	int				nbr_bits = 0;
+	while ((1L << nbr_bits) < len)
+	{
+		++ nbr_bits;
+	}
+	assert (len == 1L << nbr_bits);
+
+	const long		blk_len = 1L << blk_bits;
+	const long		h_blk_len = blk_len >> 1;
+	const int		grp_bits = nbr_bits - blk_bits;
+	const long		nbr_blk = 1L << grp_bits;
+	const long		part_len = nbr_blk / nbr_parts;
+	const long		rem = nbr_blk % nbr_parts;
+	const long		blk_beg = part_len *  part      + std::min (long (part    ), rem);
+	const long		blk_end = part_len * (part + 1) + std::min (long (part + 1), rem);
+
+	long				br_blk = (blk_beg < blk_end) ? reverse (blk_beg, grp_bits) : 0;
+	for (long blk = blk_beg; blk < blk_end; ++blk)
+	{
+		const DT			val = x [br_blk];
+		DT			* const	df2 = df + (blk << blk_bits);
+
+		for (long k = 0; k <= h_blk_len; ++k)
+		{
+			df2 [k] = val;
+		}
+		for (long k = h_blk_len + 1; k < blk_len; ++k)
+		{
+			df2 [k] = 0;
+		}
+
+		// ++br_blk (bit reversed)
+		long				bit = nbr_blk >> 1;
+		while (bit > 0 && ((br_blk ^= bit) & bit) == 0)
+		{
+			bit >>= 1;
+		}
+	}
+}
+
+
+
+long	FFTRealBitRev::reverse (long index, int nbr_bits)
+{
+	assert (index >= 0);
+	assert (index < (1L << nbr_bits));
+
+	long				br_index = 0;
+	for (int bit_cnt = 0; bit_cnt < nbr_bits; ++bit_cnt)
+	{
+		br_index <<= 1;
+		br_index += (index & 1);
+		index >>= 1;
+	}
+
+	return (br_index);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+#endif	// FFTRealBitRev_CODEHEADER_INCLUDED
+
+#undef FFTRealBitRev_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
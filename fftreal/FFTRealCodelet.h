@@ -0,0 +1,127 @@
+/*****************************************************************************
+
+        FFTRealCodelet.h
+
+Straight-line FFT and IFFT for 2^LL2 points, 8 to 64 points. There are no
+loops, no lookup tables and no bit-reversal indirection: the code in
+FFTRealCodelet.hpp is generated by gen_codelets.py from the passes of the
+general case, and gives the same results with the same output layout.
+For other lengths, AVAILABLE is 0 and the functions are not defined: calling
+them fails at link time. FFTRealCodeletUse dispatches on AVAILABLE at
+compile-time, so generic code only refers to the codelets which exist.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealCodelet_HEADER_INCLUDED)
+#define	FFTRealCodelet_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+
+
+
+template <int LL2>
+class FFTRealCodelet
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	enum {			MIN_BIT_DEPTH	= 3	};
+	enum {			MAX_BIT_DEPTH	= 6	};
+	enum {			AVAILABLE		= (LL2 >= MIN_BIT_DEPTH && LL2 <= MAX_BIT_DEPTH) ? 1 : 0	};
+
+	template <class DT>
+	static inline void
+						do_fft (DT f [], const DT x []);
+	template <class DT>
+	static inline void
+						do_ifft (const DT f [], DT x []);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealCodelet ();
+						~FFTRealCodelet ();
+						FFTRealCodelet (const FFTRealCodelet &other);
+	FFTRealCodelet &
+						operator = (const FFTRealCodelet &other);
+	bool				operator == (const FFTRealCodelet &other);
+	bool				operator != (const FFTRealCodelet &other);
+
+};	// class FFTRealCodelet
+
+
+
+template <int AVAIL>
+class FFTRealCodeletUse
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	// Return true if the codelet for 2^LL2 points was used
+	template <int LL2, class DT>
+	FORCEINLINE static bool
+						do_fft (DT f [], const DT x []);
+	template <int LL2, class DT>
+	FORCEINLINE static bool
+						do_ifft (const DT f [], DT x []);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealCodeletUse ();
+						~FFTRealCodeletUse ();
+						FFTRealCodeletUse (const FFTRealCodeletUse &other);
+	FFTRealCodeletUse &
+						operator = (const FFTRealCodeletUse &other);
+	bool				operator == (const FFTRealCodeletUse &other);
+	bool				operator != (const FFTRealCodeletUse &other);
+
+};	// class FFTRealCodeletUse
+
+
+
+#include	"FFTRealCodelet.hpp"
+
+
+
+#endif	// FFTRealCodelet_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,2366 @@
+/*****************************************************************************
+
+        FFTRealCodelet.hpp
+
+Generated by gen_codelets.py, do not edit.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealCodelet_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealCodelet code header.
+#endif
+#define	FFTRealCodelet_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealCodelet_CODEHEADER_INCLUDED)
+#define	FFTRealCodelet_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// No codelet for this length
+template <>
+template <int LL2, class DT>
+bool	FFTRealCodeletUse <0>::do_fft (DT /*f*/ [], const DT /*x*/ [])
+{
+	return (false);
+}
+
+
+
+template <>
+template <int LL2, class DT>
+bool	FFTRealCodeletUse <0>::do_ifft (const DT /*f*/ [], DT /*x*/ [])
+{
+	return (false);
+}
+
+
+
+template <>
+template <int LL2, class DT>
+bool	FFTRealCodeletUse <1>::do_fft (DT f [], const DT x [])
+{
+	FFTRealCodelet <LL2>::do_fft (f, x);
+
+	return (true);
+}
+
+
+
+template <>
+template <int LL2, class DT>
+bool	FFTRealCodeletUse <1>::do_ifft (const DT f [], DT x [])
+{
+	FFTRealCodelet <LL2>::do_ifft (f, x);
+
+	return (true);
+}
+
+
+
+// 8-point FFT
+template <>
+template <class DT>
+void	FFTRealCodelet <3>::do_fft (DT f [], const DT x [])
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+
+	const DT		t_0 = x [0] - x [4];
+	const DT		t_1 = x [2] - x [6];
+	const DT		t_2 = x [0] + x [4];
+	const DT		t_3 = x [2] + x [6];
+	const DT		t_4 = t_2 + t_3;
+	const DT		t_5 = t_2 - t_3;
+	const DT		t_6 = x [1] - x [5];
+	const DT		t_7 = x [3] - x [7];
+	const DT		t_8 = x [1] + x [5];
+	const DT		t_9 = x [3] + x [7];
+	const DT		t_10 = t_8 + t_9;
+	const DT		t_11 = t_8 - t_9;
+	const DT		t_12 = t_10 + t_4;
+	const DT		t_13 = t_4 - t_10;
+	const DT		t_14 = t_6 - t_7;
+	const DT		t_15 = t_14 * DT (0.70710678118654757274);
+	const DT		t_16 = t_0 + t_15;
+	const DT		t_17 = t_0 - t_15;
+	const DT		t_18 = t_6 + t_7;
+	const DT		t_19 = t_18 * DT (0.70710678118654757274);
+	const DT		t_20 = t_1 + t_19;
+	const DT		t_21 = t_19 - t_1;
+
+	f [0] = t_12;
+	f [1] = t_16;
+	f [2] = t_5;
+	f [3] = t_17;
+	f [4] = t_13;
+	f [5] = t_20;
+	f [6] = t_11;
+	f [7] = t_21;
+}
+
+
+
+// 8-point IFFT
+template <>
+template <class DT>
+void	FFTRealCodelet <3>::do_ifft (const DT f [], DT x [])
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+
+	const DT		t_0 = f [0] + f [4];
+	const DT		t_1 = f [0] - f [4];
+	const DT		t_2 = f [2] * 2;
+	const DT		t_3 = f [6] * 2;
+	const DT		t_4 = f [1] + f [3];
+	const DT		t_5 = f [5] - f [7];
+	const DT		t_6 = f [1] - f [3];
+	const DT		t_7 = f [5] + f [7];
+	const DT		t_8 = t_6 + t_7;
+	const DT		t_9 = t_8 * DT (0.70710678118654757274);
+	const DT		t_10 = t_7 - t_6;
+	const DT		t_11 = t_10 * DT (0.70710678118654757274);
+	const DT		t_12 = t_0 + t_2;
+	const DT		t_13 = t_0 - t_2;
+	const DT		t_14 = t_4 * 2;
+	const DT		t_15 = t_5 * 2;
+	const DT		t_16 = t_12 + t_14;
+	const DT		t_17 = t_12 - t_14;
+	const DT		t_18 = t_13 + t_15;
+	const DT		t_19 = t_13 - t_15;
+	const DT		t_20 = t_1 + t_3;
+	const DT		t_21 = t_1 - t_3;
+	const DT		t_22 = t_9 * 2;
+	const DT		t_23 = t_11 * 2;
+	const DT		t_24 = t_20 + t_22;
+	const DT		t_25 = t_20 - t_22;
+	const DT		t_26 = t_21 + t_23;
+	const DT		t_27 = t_21 - t_23;
+
+	x [0] = t_16;
+	x [1] = t_24;
+	x [2] = t_18;
+	x [3] = t_26;
+	x [4] = t_17;
+	x [5] = t_25;
+	x [6] = t_19;
+	x [7] = t_27;
+}
+
+
+
+// 16-point FFT
+template <>
+template <class DT>
+void	FFTRealCodelet <4>::do_fft (DT f [], const DT x [])
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+
+	const DT		t_0 = x [0] - x [8];
+	const DT		t_1 = x [4] - x [12];
+	const DT		t_2 = x [0] + x [8];
+	const DT		t_3 = x [12] + x [4];
+	const DT		t_4 = t_2 + t_3;
+	const DT		t_5 = t_2 - t_3;
+	const DT		t_6 = x [2] - x [10];
+	const DT		t_7 = x [6] - x [14];
+	const DT		t_8 = x [10] + x [2];
+	const DT		t_9 = x [14] + x [6];
+	const DT		t_10 = t_8 + t_9;
+	const DT		t_11 = t_8 - t_9;
+	const DT		t_12 = x [1] - x [9];
+	const DT		t_13 = x [5] - x [13];
+	const DT		t_14 = x [1] + x [9];
+	const DT		t_15 = x [13] + x [5];
+	const DT		t_16 = t_14 + t_15;
+	const DT		t_17 = t_14 - t_15;
+	const DT		t_18 = x [3] - x [11];
+	const DT		t_19 = x [7] - x [15];
+	const DT		t_20 = x [11] + x [3];
+	const DT		t_21 = x [15] + x [7];
+	const DT		t_22 = t_20 + t_21;
+	const DT		t_23 = t_20 - t_21;
+	const DT		t_24 = t_10 + t_4;
+	const DT		t_25 = t_4 - t_10;
+	const DT		t_26 = t_6 - t_7;
+	const DT		t_27 = t_26 * DT (0.70710678118654757274);
+	const DT		t_28 = t_0 + t_27;
+	const DT		t_29 = t_0 - t_27;
+	const DT		t_30 = t_6 + t_7;
+	const DT		t_31 = t_30 * DT (0.70710678118654757274);
+	const DT		t_32 = t_1 + t_31;
+	const DT		t_33 = t_31 - t_1;
+	const DT		t_34 = t_16 + t_22;
+	const DT		t_35 = t_16 - t_22;
+	const DT		t_36 = t_18 - t_19;
+	const DT		t_37 = t_36 * DT (0.70710678118654757274);
+	const DT		t_38 = t_12 + t_37;
+	const DT		t_39 = t_12 - t_37;
+	const DT		t_40 = t_18 + t_19;
+	const DT		t_41 = t_40 * DT (0.70710678118654757274);
+	const DT		t_42 = t_13 + t_41;
+	const DT		t_43 = t_41 - t_13;
+	const DT		t_44 = t_24 + t_34;
+	const DT		t_45 = t_24 - t_34;
+	const DT		t_46 = t_38 * DT (0.92387953251128673848);
+	const DT		t_47 = t_42 * DT (0.38268343236508978178);
+	const DT		t_48 = t_46 - t_47;
+	const DT		t_49 = t_38 * DT (0.38268343236508978178);
+	const DT		t_50 = t_42 * DT (0.92387953251128673848);
+	const DT		t_51 = t_49 + t_50;
+	const DT		t_52 = t_28 + t_48;
+	const DT		t_53 = t_28 - t_48;
+	const DT		t_54 = t_32 + t_51;
+	const DT		t_55 = t_51 - t_32;
+	const DT		t_56 = t_17 - t_23;
+	const DT		t_57 = t_56 * DT (0.70710678118654757274);
+	const DT		t_58 = t_17 + t_23;
+	const DT		t_59 = t_58 * DT (0.70710678118654757274);
+	const DT		t_60 = t_5 + t_57;
+	const DT		t_61 = t_5 - t_57;
+	const DT		t_62 = t_11 + t_59;
+	const DT		t_63 = t_59 - t_11;
+	const DT		t_64 = t_39 * DT (0.38268343236508983729);
+	const DT		t_65 = t_43 * DT (0.92387953251128673848);
+	const DT		t_66 = t_64 - t_65;
+	const DT		t_67 = t_39 * DT (0.92387953251128673848);
+	const DT		t_68 = t_43 * DT (0.38268343236508983729);
+	const DT		t_69 = t_67 + t_68;
+	const DT		t_70 = t_29 + t_66;
+	const DT		t_71 = t_29 - t_66;
+	const DT		t_72 = t_33 + t_69;
+	const DT		t_73 = t_69 - t_33;
+
+	f [0] = t_44;
+	f [1] = t_52;
+	f [2] = t_60;
+	f [3] = t_70;
+	f [4] = t_25;
+	f [5] = t_71;
+	f [6] = t_61;
+	f [7] = t_53;
+	f [8] = t_45;
+	f [9] = t_54;
+	f [10] = t_62;
+	f [11] = t_72;
+	f [12] = t_35;
+	f [13] = t_73;
+	f [14] = t_63;
+	f [15] = t_55;
+}
+
+
+
+// 16-point IFFT
+template <>
+template <class DT>
+void	FFTRealCodelet <4>::do_ifft (const DT f [], DT x [])
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+
+	const DT		t_0 = f [0] + f [8];
+	const DT		t_1 = f [0] - f [8];
+	const DT		t_2 = f [4] * 2;
+	const DT		t_3 = f [12] * 2;
+	const DT		t_4 = f [1] + f [7];
+	const DT		t_5 = f [9] - f [15];
+	const DT		t_6 = f [1] - f [7];
+	const DT		t_7 = f [15] + f [9];
+	const DT		t_8 = t_7 * DT (0.92387953251128673848);
+	const DT		t_9 = t_6 * DT (0.38268343236508978178);
+	const DT		t_10 = t_8 - t_9;
+	const DT		t_11 = t_7 * DT (0.38268343236508978178);
+	const DT		t_12 = t_6 * DT (0.92387953251128673848);
+	const DT		t_13 = t_11 + t_12;
+	const DT		t_14 = f [2] + f [6];
+	const DT		t_15 = f [10] - f [14];
+	const DT		t_16 = f [2] - f [6];
+	const DT		t_17 = f [10] + f [14];
+	const DT		t_18 = t_17 - t_16;
+	const DT		t_19 = t_18 * DT (0.70710678118654757274);
+	const DT		t_20 = t_16 + t_17;
+	const DT		t_21 = t_20 * DT (0.70710678118654757274);
+	const DT		t_22 = f [3] + f [5];
+	const DT		t_23 = f [11] - f [13];
+	const DT		t_24 = f [3] - f [5];
+	const DT		t_25 = f [11] + f [13];
+	const DT		t_26 = t_25 * DT (0.38268343236508983729);
+	const DT		t_27 = t_24 * DT (0.92387953251128673848);
+	const DT		t_28 = t_26 - t_27;
+	const DT		t_29 = t_25 * DT (0.92387953251128673848);
+	const DT		t_30 = t_24 * DT (0.38268343236508983729);
+	const DT		t_31 = t_29 + t_30;
+	const DT		t_32 = t_0 + t_2;
+	const DT		t_33 = t_0 - t_2;
+	const DT		t_34 = t_14 * 2;
+	const DT		t_35 = t_15 * 2;
+	const DT		t_36 = t_22 + t_4;
+	const DT		t_37 = t_5 - t_23;
+	const DT		t_38 = t_4 - t_22;
+	const DT		t_39 = t_23 + t_5;
+	const DT		t_40 = t_38 + t_39;
+	const DT		t_41 = t_40 * DT (0.70710678118654757274);
+	const DT		t_42 = t_39 - t_38;
+	const DT		t_43 = t_42 * DT (0.70710678118654757274);
+	const DT		t_44 = t_1 + t_3;
+	const DT		t_45 = t_1 - t_3;
+	const DT		t_46 = t_21 * 2;
+	const DT		t_47 = t_19 * 2;
+	const DT		t_48 = t_13 + t_31;
+	const DT		t_49 = t_10 - t_28;
+	const DT		t_50 = t_13 - t_31;
+	const DT		t_51 = t_10 + t_28;
+	const DT		t_52 = t_50 + t_51;
+	const DT		t_53 = t_52 * DT (0.70710678118654757274);
+	const DT		t_54 = t_51 - t_50;
+	const DT		t_55 = t_54 * DT (0.70710678118654757274);
+	const DT		t_56 = t_32 + t_34;
+	const DT		t_57 = t_32 - t_34;
+	const DT		t_58 = t_36 * 2;
+	const DT		t_59 = t_37 * 2;
+	const DT		t_60 = t_56 + t_58;
+	const DT		t_61 = t_56 - t_58;
+	const DT		t_62 = t_57 + t_59;
+	const DT		t_63 = t_57 - t_59;
+	const DT		t_64 = t_33 + t_35;
+	const DT		t_65 = t_33 - t_35;
+	const DT		t_66 = t_41 * 2;
+	const DT		t_67 = t_43 * 2;
+	const DT		t_68 = t_64 + t_66;
+	const DT		t_69 = t_64 - t_66;
+	const DT		t_70 = t_65 + t_67;
+	const DT		t_71 = t_65 - t_67;
+	const DT		t_72 = t_44 + t_46;
+	const DT		t_73 = t_44 - t_46;
+	const DT		t_74 = t_48 * 2;
+	const DT		t_75 = t_49 * 2;
+	const DT		t_76 = t_72 + t_74;
+	const DT		t_77 = t_72 - t_74;
+	const DT		t_78 = t_73 + t_75;
+	const DT		t_79 = t_73 - t_75;
+	const DT		t_80 = t_45 + t_47;
+	const DT		t_81 = t_45 - t_47;
+	const DT		t_82 = t_53 * 2;
+	const DT		t_83 = t_55 * 2;
+	const DT		t_84 = t_80 + t_82;
+	const DT		t_85 = t_80 - t_82;
+	const DT		t_86 = t_81 + t_83;
+	const DT		t_87 = t_81 - t_83;
+
+	x [0] = t_60;
+	x [1] = t_76;
+	x [2] = t_68;
+	x [3] = t_84;
+	x [4] = t_62;
+	x [5] = t_78;
+	x [6] = t_70;
+	x [7] = t_86;
+	x [8] = t_61;
+	x [9] = t_77;
+	x [10] = t_69;
+	x [11] = t_85;
+	x [12] = t_63;
+	x [13] = t_79;
+	x [14] = t_71;
+	x [15] = t_87;
+}
+
+
+
+// 32-point FFT
+template <>
+template <class DT>
+void	FFTRealCodelet <5>::do_fft (DT f [], const DT x [])
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+
+	const DT		t_0 = x [0] - x [16];
+	const DT		t_1 = x [8] - x [24];
+	const DT		t_2 = x [0] + x [16];
+	const DT		t_3 = x [24] + x [8];
+	const DT		t_4 = t_2 + t_3;
+	const DT		t_5 = t_2 - t_3;
+	const DT		t_6 = x [4] - x [20];
+	const DT		t_7 = x [12] - x [28];
+	const DT		t_8 = x [20] + x [4];
+	const DT		t_9 = x [12] + x [28];
+	const DT		t_10 = t_8 + t_9;
+	const DT		t_11 = t_8 - t_9;
+	const DT		t_12 = x [2] - x [18];
+	const DT		t_13 = x [10] - x [26];
+	const DT		t_14 = x [18] + x [2];
+	const DT		t_15 = x [10] + x [26];
+	const DT		t_16 = t_14 + t_15;
+	const DT		t_17 = t_14 - t_15;
+	const DT		t_18 = x [6] - x [22];
+	const DT		t_19 = x [14] - x [30];
+	const DT		t_20 = x [22] + x [6];
+	const DT		t_21 = x [14] + x [30];
+	const DT		t_22 = t_20 + t_21;
+	const DT		t_23 = t_20 - t_21;
+	const DT		t_24 = x [1] - x [17];
+	const DT		t_25 = x [9] - x [25];
+	const DT		t_26 = x [17] + x [1];
+	const DT		t_27 = x [25] + x [9];
+	const DT		t_28 = t_26 + t_27;
+	const DT		t_29 = t_26 - t_27;
+	const DT		t_30 = x [5] - x [21];
+	const DT		t_31 = x [13] - x [29];
+	const DT		t_32 = x [21] + x [5];
+	const DT		t_33 = x [13] + x [29];
+	const DT		t_34 = t_32 + t_33;
+	const DT		t_35 = t_32 - t_33;
+	const DT		t_36 = x [3] - x [19];
+	const DT		t_37 = x [11] - x [27];
+	const DT		t_38 = x [19] + x [3];
+	const DT		t_39 = x [11] + x [27];
+	const DT		t_40 = t_38 + t_39;
+	const DT		t_41 = t_38 - t_39;
+	const DT		t_42 = x [7] - x [23];
+	const DT		t_43 = x [15] - x [31];
+	const DT		t_44 = x [23] + x [7];
+	const DT		t_45 = x [15] + x [31];
+	const DT		t_46 = t_44 + t_45;
+	const DT		t_47 = t_44 - t_45;
+	const DT		t_48 = t_10 + t_4;
+	const DT		t_49 = t_4 - t_10;
+	const DT		t_50 = t_6 - t_7;
+	const DT		t_51 = t_50 * DT (0.70710678118654757274);
+	const DT		t_52 = t_0 + t_51;
+	const DT		t_53 = t_0 - t_51;
+	const DT		t_54 = t_6 + t_7;
+	const DT		t_55 = t_54 * DT (0.70710678118654757274);
+	const DT		t_56 = t_1 + t_55;
+	const DT		t_57 = t_55 - t_1;
+	const DT		t_58 = t_16 + t_22;
+	const DT		t_59 = t_16 - t_22;
+	const DT		t_60 = t_18 - t_19;
+	const DT		t_61 = t_60 * DT (0.70710678118654757274);
+	const DT		t_62 = t_12 + t_61;
+	const DT		t_63 = t_12 - t_61;
+	const DT		t_64 = t_18 + t_19;
+	const DT		t_65 = t_64 * DT (0.70710678118654757274);
+	const DT		t_66 = t_13 + t_65;
+	const DT		t_67 = t_65 - t_13;
+	const DT		t_68 = t_28 + t_34;
+	const DT		t_69 = t_28 - t_34;
+	const DT		t_70 = t_30 - t_31;
+	const DT		t_71 = t_70 * DT (0.70710678118654757274);
+	const DT		t_72 = t_24 + t_71;
+	const DT		t_73 = t_24 - t_71;
+	const DT		t_74 = t_30 + t_31;
+	const DT		t_75 = t_74 * DT (0.70710678118654757274);
+	const DT		t_76 = t_25 + t_75;
+	const DT		t_77 = t_75 - t_25;
+	const DT		t_78 = t_40 + t_46;
+	const DT		t_79 = t_40 - t_46;
+	const DT		t_80 = t_42 - t_43;
+	const DT		t_81 = t_80 * DT (0.70710678118654757274);
+	const DT		t_82 = t_36 + t_81;
+	const DT		t_83 = t_36 - t_81;
+	const DT		t_84 = t_42 + t_43;
+	const DT		t_85 = t_84 * DT (0.70710678118654757274);
+	const DT		t_86 = t_37 + t_85;
+	const DT		t_87 = t_85 - t_37;
+	const DT		t_88 = t_48 + t_58;
+	const DT		t_89 = t_48 - t_58;
+	const DT		t_90 = t_62 * DT (0.92387953251128673848);
+	const DT		t_91 = t_66 * DT (0.38268343236508978178);
+	const DT		t_92 = t_90 - t_91;
+	const DT		t_93 = t_62 * DT (0.38268343236508978178);
+	const DT		t_94 = t_66 * DT (0.92387953251128673848);
+	const DT		t_95 = t_93 + t_94;
+	const DT		t_96 = t_52 + t_92;
+	const DT		t_97 = t_52 - t_92;
+	const DT		t_98 = t_56 + t_95;
+	const DT		t_99 = t_95 - t_56;
+	const DT		t_100 = t_17 - t_23;
+	const DT		t_101 = t_100 * DT (0.70710678118654757274);
+	const DT		t_102 = t_17 + t_23;
+	const DT		t_103 = t_102 * DT (0.70710678118654757274);
+	const DT		t_104 = t_101 + t_5;
+	const DT		t_105 = t_5 - t_101;
+	const DT		t_106 = t_103 + t_11;
+	const DT		t_107 = t_103 - t_11;
+	const DT		t_108 = t_63 * DT (0.38268343236508983729);
+	const DT		t_109 = t_67 * DT (0.92387953251128673848);
+	const DT		t_110 = t_108 - t_109;
+	const DT		t_111 = t_63 * DT (0.92387953251128673848);
+	const DT		t_112 = t_67 * DT (0.38268343236508983729);
+	const DT		t_113 = t_111 + t_112;
+	const DT		t_114 = t_110 + t_53;
+	const DT		t_115 = t_53 - t_110;
+	const DT		t_116 = t_113 + t_57;
+	const DT		t_117 = t_113 - t_57;
+	const DT		t_118 = t_68 + t_78;
+	const DT		t_119 = t_68 - t_78;
+	const DT		t_120 = t_82 * DT (0.92387953251128673848);
+	const DT		t_121 = t_86 * DT (0.38268343236508978178);
+	const DT		t_122 = t_120 - t_121;
+	const DT		t_123 = t_82 * DT (0.38268343236508978178);
+	const DT		t_124 = t_86 * DT (0.92387953251128673848);
+	const DT		t_125 = t_123 + t_124;
+	const DT		t_126 = t_122 + t_72;
+	const DT		t_127 = t_72 - t_122;
+	const DT		t_128 = t_125 + t_76;
+	const DT		t_129 = t_125 - t_76;
+	const DT		t_130 = t_41 - t_47;
+	const DT		t_131 = t_130 * DT (0.70710678118654757274);
+	const DT		t_132 = t_41 + t_47;
+	const DT		t_133 = t_132 * DT (0.70710678118654757274);
+	const DT		t_134 = t_131 + t_29;
+	const DT		t_135 = t_29 - t_131;
+	const DT		t_136 = t_133 + t_35;
+	const DT		t_137 = t_133 - t_35;
+	const DT		t_138 = t_83 * DT (0.38268343236508983729);
+	const DT		t_139 = t_87 * DT (0.92387953251128673848);
+	const DT		t_140 = t_138 - t_139;
+	const DT		t_141 = t_83 * DT (0.92387953251128673848);
+	const DT		t_142 = t_87 * DT (0.38268343236508983729);
+	const DT		t_143 = t_141 + t_142;
+	const DT		t_144 = t_140 + t_73;
+	const DT		t_145 = t_73 - t_140;
+	const DT		t_146 = t_143 + t_77;
+	const DT		t_147 = t_143 - t_77;
+	const DT		t_148 = t_118 + t_88;
+	const DT		t_149 = t_88 - t_118;
+	const DT		t_150 = t_126 * DT (0.98078528040323043058);
+	const DT		t_151 = t_128 * DT (0.19509032201612824808);
+	const DT		t_152 = t_150 - t_151;
+	const DT		t_153 = t_126 * DT (0.19509032201612824808);
+	const DT		t_154 = t_128 * DT (0.98078528040323043058);
+	const DT		t_155 = t_153 + t_154;
+	const DT		t_156 = t_152 + t_96;
+	const DT		t_157 = t_96 - t_152;
+	const DT		t_158 = t_155 + t_98;
+	const DT		t_159 = t_155 - t_98;
+	const DT		t_160 = t_134 * DT (0.92387953251128673848);
+	const DT		t_161 = t_136 * DT (0.38268343236508978178);
+	const DT		t_162 = t_160 - t_161;
+	const DT		t_163 = t_134 * DT (0.38268343236508978178);
+	const DT		t_164 = t_136 * DT (0.92387953251128673848);
+	const DT		t_165 = t_163 + t_164;
+	const DT		t_166 = t_104 + t_162;
+	const DT		t_167 = t_104 - t_162;
+	const DT		t_168 = t_106 + t_165;
+	const DT		t_169 = t_165 - t_106;
+	const DT		t_170 = t_144 * DT (0.83146961230254523567);
+	const DT		t_171 = t_146 * DT (0.55557023301960217765);
+	const DT		t_172 = t_170 - t_171;
+	const DT		t_173 = t_144 * DT (0.55557023301960217765);
+	const DT		t_174 = t_146 * DT (0.83146961230254523567);
+	const DT		t_175 = t_173 + t_174;
+	const DT		t_176 = t_114 + t_172;
+	const DT		t_177 = t_114 - t_172;
+	const DT		t_178 = t_116 + t_175;
+	const DT		t_179 = t_175 - t_116;
+	const DT		t_180 = t_69 - t_79;
+	const DT		t_181 = t_180 * DT (0.70710678118654757274);
+	const DT		t_182 = t_69 + t_79;
+	const DT		t_183 = t_182 * DT (0.70710678118654757274);
+	const DT		t_184 = t_181 + t_49;
+	const DT		t_185 = t_49 - t_181;
+	const DT		t_186 = t_183 + t_59;
+	const DT		t_187 = t_183 - t_59;
+	const DT		t_188 = t_145 * DT (0.55557023301960228867);
+	const DT		t_189 = t_147 * DT (0.83146961230254523567);
+	const DT		t_190 = t_188 - t_189;
+	const DT		t_191 = t_145 * DT (0.83146961230254523567);
+	const DT		t_192 = t_147 * DT (0.55557023301960228867);
+	const DT		t_193 = t_191 + t_192;
+	const DT		t_194 = t_115 + t_190;
+	const DT		t_195 = t_115 - t_190;
+	const DT		t_196 = t_117 + t_193;
+	const DT		t_197 = t_193 - t_117;
+	const DT		t_198 = t_135 * DT (0.38268343236508983729);
+	const DT		t_199 = t_137 * DT (0.92387953251128673848);
+	const DT		t_200 = t_198 - t_199;
+	const DT		t_201 = t_135 * DT (0.92387953251128673848);
+	const DT		t_202 = t_137 * DT (0.38268343236508983729);
+	const DT		t_203 = t_201 + t_202;
+	const DT		t_204 = t_105 + t_200;
+	const DT		t_205 = t_105 - t_200;
+	const DT		t_206 = t_107 + t_203;
+	const DT		t_207 = t_203 - t_107;
+	const DT		t_208 = t_127 * DT (0.19509032201612833135);
+	const DT		t_209 = t_129 * DT (0.98078528040323043058);
+	const DT		t_210 = t_208 - t_209;
+	const DT		t_211 = t_127 * DT (0.98078528040323043058);
+	const DT		t_212 = t_129 * DT (0.19509032201612833135);
+	const DT		t_213 = t_211 + t_212;
+	const DT		t_214 = t_210 + t_97;
+	const DT		t_215 = t_97 - t_210;
+	const DT		t_216 = t_213 + t_99;
+	const DT		t_217 = t_213 - t_99;
+
+	f [0] = t_148;
+	f [1] = t_156;
+	f [2] = t_166;
+	f [3] = t_176;
+	f [4] = t_184;
+	f [5] = t_194;
+	f [6] = t_204;
+	f [7] = t_214;
+	f [8] = t_89;
+	f [9] = t_215;
+	f [10] = t_205;
+	f [11] = t_195;
+	f [12] = t_185;
+	f [13] = t_177;
+	f [14] = t_167;
+	f [15] = t_157;
+	f [16] = t_149;
+	f [17] = t_158;
+	f [18] = t_168;
+	f [19] = t_178;
+	f [20] = t_186;
+	f [21] = t_196;
+	f [22] = t_206;
+	f [23] = t_216;
+	f [24] = t_119;
+	f [25] = t_217;
+	f [26] = t_207;
+	f [27] = t_197;
+	f [28] = t_187;
+	f [29] = t_179;
+	f [30] = t_169;
+	f [31] = t_159;
+}
+
+
+
+// 32-point IFFT
+template <>
+template <class DT>
+void	FFTRealCodelet <5>::do_ifft (const DT f [], DT x [])
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+
+	const DT		t_0 = f [0] + f [16];
+	const DT		t_1 = f [0] - f [16];
+	const DT		t_2 = f [8] * 2;
+	const DT		t_3 = f [24] * 2;
+	const DT		t_4 = f [15] + f [1];
+	const DT		t_5 = f [17] - f [31];
+	const DT		t_6 = f [1] - f [15];
+	const DT		t_7 = f [17] + f [31];
+	const DT		t_8 = t_7 * DT (0.98078528040323043058);
+	const DT		t_9 = t_6 * DT (0.19509032201612824808);
+	const DT		t_10 = t_8 - t_9;
+	const DT		t_11 = t_7 * DT (0.19509032201612824808);
+	const DT		t_12 = t_6 * DT (0.98078528040323043058);
+	const DT		t_13 = t_11 + t_12;
+	const DT		t_14 = f [14] + f [2];
+	const DT		t_15 = f [18] - f [30];
+	const DT		t_16 = f [2] - f [14];
+	const DT		t_17 = f [18] + f [30];
+	const DT		t_18 = t_17 * DT (0.92387953251128673848);
+	const DT		t_19 = t_16 * DT (0.38268343236508978178);
+	const DT		t_20 = t_18 - t_19;
+	const DT		t_21 = t_17 * DT (0.38268343236508978178);
+	const DT		t_22 = t_16 * DT (0.92387953251128673848);
+	const DT		t_23 = t_21 + t_22;
+	const DT		t_24 = f [13] + f [3];
+	const DT		t_25 = f [19] - f [29];
+	const DT		t_26 = f [3] - f [13];
+	const DT		t_27 = f [19] + f [29];
+	const DT		t_28 = t_27 * DT (0.83146961230254523567);
+	const DT		t_29 = t_26 * DT (0.55557023301960217765);
+	const DT		t_30 = t_28 - t_29;
+	const DT		t_31 = t_27 * DT (0.55557023301960217765);
+	const DT		t_32 = t_26 * DT (0.83146961230254523567);
+	const DT		t_33 = t_31 + t_32;
+	const DT		t_34 = f [12] + f [4];
+	const DT		t_35 = f [20] - f [28];
+	const DT		t_36 = f [4] - f [12];
+	const DT		t_37 = f [20] + f [28];
+	const DT		t_38 = t_37 - t_36;
+	const DT		t_39 = t_38 * DT (0.70710678118654757274);
+	const DT		t_40 = t_36 + t_37;
+	const DT		t_41 = t_40 * DT (0.70710678118654757274);
+	const DT		t_42 = f [11] + f [5];
+	const DT		t_43 = f [21] - f [27];
+	const DT		t_44 = f [5] - f [11];
+	const DT		t_45 = f [21] + f [27];
+	const DT		t_46 = t_45 * DT (0.55557023301960228867);
+	const DT		t_47 = t_44 * DT (0.83146961230254523567);
+	const DT		t_48 = t_46 - t_47;
+	const DT		t_49 = t_45 * DT (0.83146961230254523567);
+	const DT		t_50 = t_44 * DT (0.55557023301960228867);
+	const DT		t_51 = t_49 + t_50;
+	const DT		t_52 = f [10] + f [6];
+	const DT		t_53 = f [22] - f [26];
+	const DT		t_54 = f [6] - f [10];
+	const DT		t_55 = f [22] + f [26];
+	const DT		t_56 = t_55 * DT (0.38268343236508983729);
+	const DT		t_57 = t_54 * DT (0.92387953251128673848);
+	const DT		t_58 = t_56 - t_57;
+	const DT		t_59 = t_55 * DT (0.92387953251128673848);
+	const DT		t_60 = t_54 * DT (0.38268343236508983729);
+	const DT		t_61 = t_59 + t_60;
+	const DT		t_62 = f [7] + f [9];
+	const DT		t_63 = f [23] - f [25];
+	const DT		t_64 = f [7] - f [9];
+	const DT		t_65 = f [23] + f [25];
+	const DT		t_66 = t_65 * DT (0.19509032201612833135);
+	const DT		t_67 = t_64 * DT (0.98078528040323043058);
+	const DT		t_68 = t_66 - t_67;
+	const DT		t_69 = t_65 * DT (0.98078528040323043058);
+	const DT		t_70 = t_64 * DT (0.19509032201612833135);
+	const DT		t_71 = t_69 + t_70;
+	const DT		t_72 = t_0 + t_2;
+	const DT		t_73 = t_0 - t_2;
+	const DT		t_74 = t_34 * 2;
+	const DT		t_75 = t_35 * 2;
+	const DT		t_76 = t_4 + t_62;
+	const DT		t_77 = t_5 - t_63;
+	const DT		t_78 = t_4 - t_62;
+	const DT		t_79 = t_5 + t_63;
+	const DT		t_80 = t_79 * DT (0.92387953251128673848);
+	const DT		t_81 = t_78 * DT (0.38268343236508978178);
+	const DT		t_82 = t_80 - t_81;
+	const DT		t_83 = t_79 * DT (0.38268343236508978178);
+	const DT		t_84 = t_78 * DT (0.92387953251128673848);
+	const DT		t_85 = t_83 + t_84;
+	const DT		t_86 = t_14 + t_52;
+	const DT		t_87 = t_15 - t_53;
+	const DT		t_88 = t_14 - t_52;
+	const DT		t_89 = t_15 + t_53;
+	const DT		t_90 = t_89 - t_88;
+	const DT		t_91 = t_90 * DT (0.70710678118654757274);
+	const DT		t_92 = t_88 + t_89;
+	const DT		t_93 = t_92 * DT (0.70710678118654757274);
+	const DT		t_94 = t_24 + t_42;
+	const DT		t_95 = t_25 - t_43;
+	const DT		t_96 = t_24 - t_42;
+	const DT		t_97 = t_25 + t_43;
+	const DT		t_98 = t_97 * DT (0.38268343236508983729);
+	const DT		t_99 = t_96 * DT (0.92387953251128673848);
+	const DT		t_100 = t_98 - t_99;
+	const DT		t_101 = t_97 * DT (0.92387953251128673848);
+	const DT		t_102 = t_96 * DT (0.38268343236508983729);
+	const DT		t_103 = t_101 + t_102;
+	const DT		t_104 = t_1 + t_3;
+	const DT		t_105 = t_1 - t_3;
+	const DT		t_106 = t_41 * 2;
+	const DT		t_107 = t_39 * 2;
+	const DT		t_108 = t_13 + t_71;
+	const DT		t_109 = t_10 - t_68;
+	const DT		t_110 = t_13 - t_71;
+	const DT		t_111 = t_10 + t_68;
+	const DT		t_112 = t_111 * DT (0.92387953251128673848);
+	const DT		t_113 = t_110 * DT (0.38268343236508978178);
+	const DT		t_114 = t_112 - t_113;
+	const DT		t_115 = t_111 * DT (0.38268343236508978178);
+	const DT		t_116 = t_110 * DT (0.92387953251128673848);
+	const DT		t_117 = t_115 + t_116;
+	const DT		t_118 = t_23 + t_61;
+	const DT		t_119 = t_20 - t_58;
+	const DT		t_120 = t_23 - t_61;
+	const DT		t_121 = t_20 + t_58;
+	const DT		t_122 = t_121 - t_120;
+	const DT		t_123 = t_122 * DT (0.70710678118654757274);
+	const DT		t_124 = t_120 + t_121;
+	const DT		t_125 = t_124 * DT (0.70710678118654757274);
+	const DT		t_126 = t_33 + t_51;
+	const DT		t_127 = t_30 - t_48;
+	const DT		t_128 = t_33 - t_51;
+	const DT		t_129 = t_30 + t_48;
+	const DT		t_130 = t_129 * DT (0.38268343236508983729);
+	const DT		t_131 = t_128 * DT (0.92387953251128673848);
+	const DT		t_132 = t_130 - t_131;
+	const DT		t_133 = t_129 * DT (0.92387953251128673848);
+	const DT		t_134 = t_128 * DT (0.38268343236508983729);
+	const DT		t_135 = t_133 + t_134;
+	const DT		t_136 = t_72 + t_74;
+	const DT		t_137 = t_72 - t_74;
+	const DT		t_138 = t_86 * 2;
+	const DT		t_139 = t_87 * 2;
+	const DT		t_140 = t_76 + t_94;
+	const DT		t_141 = t_77 - t_95;
+	const DT		t_142 = t_76 - t_94;
+	const DT		t_143 = t_77 + t_95;
+	const DT		t_144 = t_142 + t_143;
+	const DT		t_145 = t_144 * DT (0.70710678118654757274);
+	const DT		t_146 = t_143 - t_142;
+	const DT		t_147 = t_146 * DT (0.70710678118654757274);
+	const DT		t_148 = t_73 + t_75;
+	const DT		t_149 = t_73 - t_75;
+	const DT		t_150 = t_93 * 2;
+	const DT		t_151 = t_91 * 2;
+	const DT		t_152 = t_103 + t_85;
+	const DT		t_153 = t_82 - t_100;
+	const DT		t_154 = t_85 - t_103;
+	const DT		t_155 = t_100 + t_82;
+	const DT		t_156 = t_154 + t_155;
+	const DT		t_157 = t_156 * DT (0.70710678118654757274);
+	const DT		t_158 = t_155 - t_154;
+	const DT		t_159 = t_158 * DT (0.70710678118654757274);
+	const DT		t_160 = t_104 + t_106;
+	const DT		t_161 = t_104 - t_106;
+	const DT		t_162 = t_118 * 2;
+	const DT		t_163 = t_119 * 2;
+	const DT		t_164 = t_108 + t_126;
+	const DT		t_165 = t_109 - t_127;
+	const DT		t_166 = t_108 - t_126;
+	const DT		t_167 = t_109 + t_127;
+	const DT		t_168 = t_166 + t_167;
+	const DT		t_169 = t_168 * DT (0.70710678118654757274);
+	const DT		t_170 = t_167 - t_166;
+	const DT		t_171 = t_170 * DT (0.70710678118654757274);
+	const DT		t_172 = t_105 + t_107;
+	const DT		t_173 = t_105 - t_107;
+	const DT		t_174 = t_125 * 2;
+	const DT		t_175 = t_123 * 2;
+	const DT		t_176 = t_117 + t_135;
+	const DT		t_177 = t_114 - t_132;
+	const DT		t_178 = t_117 - t_135;
+	const DT		t_179 = t_114 + t_132;
+	const DT		t_180 = t_178 + t_179;
+	const DT		t_181 = t_180 * DT (0.70710678118654757274);
+	const DT		t_182 = t_179 - t_178;
+	const DT		t_183 = t_182 * DT (0.70710678118654757274);
+	const DT		t_184 = t_136 + t_138;
+	const DT		t_185 = t_136 - t_138;
+	const DT		t_186 = t_140 * 2;
+	const DT		t_187 = t_141 * 2;
+	const DT		t_188 = t_184 + t_186;
+	const DT		t_189 = t_184 - t_186;
+	const DT		t_190 = t_185 + t_187;
+	const DT		t_191 = t_185 - t_187;
+	const DT		t_192 = t_137 + t_139;
+	const DT		t_193 = t_137 - t_139;
+	const DT		t_194 = t_145 * 2;
+	const DT		t_195 = t_147 * 2;
+	const DT		t_196 = t_192 + t_194;
+	const DT		t_197 = t_192 - t_194;
+	const DT		t_198 = t_193 + t_195;
+	const DT		t_199 = t_193 - t_195;
+	const DT		t_200 = t_148 + t_150;
+	const DT		t_201 = t_148 - t_150;
+	const DT		t_202 = t_152 * 2;
+	const DT		t_203 = t_153 * 2;
+	const DT		t_204 = t_200 + t_202;
+	const DT		t_205 = t_200 - t_202;
+	const DT		t_206 = t_201 + t_203;
+	const DT		t_207 = t_201 - t_203;
+	const DT		t_208 = t_149 + t_151;
+	const DT		t_209 = t_149 - t_151;
+	const DT		t_210 = t_157 * 2;
+	const DT		t_211 = t_159 * 2;
+	const DT		t_212 = t_208 + t_210;
+	const DT		t_213 = t_208 - t_210;
+	const DT		t_214 = t_209 + t_211;
+	const DT		t_215 = t_209 - t_211;
+	const DT		t_216 = t_160 + t_162;
+	const DT		t_217 = t_160 - t_162;
+	const DT		t_218 = t_164 * 2;
+	const DT		t_219 = t_165 * 2;
+	const DT		t_220 = t_216 + t_218;
+	const DT		t_221 = t_216 - t_218;
+	const DT		t_222 = t_217 + t_219;
+	const DT		t_223 = t_217 - t_219;
+	const DT		t_224 = t_161 + t_163;
+	const DT		t_225 = t_161 - t_163;
+	const DT		t_226 = t_169 * 2;
+	const DT		t_227 = t_171 * 2;
+	const DT		t_228 = t_224 + t_226;
+	const DT		t_229 = t_224 - t_226;
+	const DT		t_230 = t_225 + t_227;
+	const DT		t_231 = t_225 - t_227;
+	const DT		t_232 = t_172 + t_174;
+	const DT		t_233 = t_172 - t_174;
+	const DT		t_234 = t_176 * 2;
+	const DT		t_235 = t_177 * 2;
+	const DT		t_236 = t_232 + t_234;
+	const DT		t_237 = t_232 - t_234;
+	const DT		t_238 = t_233 + t_235;
+	const DT		t_239 = t_233 - t_235;
+	const DT		t_240 = t_173 + t_175;
+	const DT		t_241 = t_173 - t_175;
+	const DT		t_242 = t_181 * 2;
+	const DT		t_243 = t_183 * 2;
+	const DT		t_244 = t_240 + t_242;
+	const DT		t_245 = t_240 - t_242;
+	const DT		t_246 = t_241 + t_243;
+	const DT		t_247 = t_241 - t_243;
+
+	x [0] = t_188;
+	x [1] = t_220;
+	x [2] = t_204;
+	x [3] = t_236;
+	x [4] = t_196;
+	x [5] = t_228;
+	x [6] = t_212;
+	x [7] = t_244;
+	x [8] = t_190;
+	x [9] = t_222;
+	x [10] = t_206;
+	x [11] = t_238;
+	x [12] = t_198;
+	x [13] = t_230;
+	x [14] = t_214;
+	x [15] = t_246;
+	x [16] = t_189;
+	x [17] = t_221;
+	x [18] = t_205;
+	x [19] = t_237;
+	x [20] = t_197;
+	x [21] = t_229;
+	x [22] = t_213;
+	x [23] = t_245;
+	x [24] = t_191;
+	x [25] = t_223;
+	x [26] = t_207;
+	x [27] = t_239;
+	x [28] = t_199;
+	x [29] = t_231;
+	x [30] = t_215;
+	x [31] = t_247;
+}
+
+
+
+// 64-point FFT
+template <>
+template <class DT>
+void	FFTRealCodelet <6>::do_fft (DT f [], const DT x [])
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+
+	const DT		t_0 = x [0] - x [32];
+	const DT		t_1 = x [16] - x [48];
+	const DT		t_2 = x [0] + x [32];
+	const DT		t_3 = x [16] + x [48];
+	const DT		t_4 = t_2 + t_3;
+	const DT		t_5 = t_2 - t_3;
+	const DT		t_6 = x [8] - x [40];
+	const DT		t_7 = x [24] - x [56];
+	const DT		t_8 = x [40] + x [8];
+	const DT		t_9 = x [24] + x [56];
+	const DT		t_10 = t_8 + t_9;
+	const DT		t_11 = t_8 - t_9;
+	const DT		t_12 = x [4] - x [36];
+	const DT		t_13 = x [20] - x [52];
+	const DT		t_14 = x [36] + x [4];
+	const DT		t_15 = x [20] + x [52];
+	const DT		t_16 = t_14 + t_15;
+	const DT		t_17 = t_14 - t_15;
+	const DT		t_18 = x [12] - x [44];
+	const DT		t_19 = x [28] - x [60];
+	const DT		t_20 = x [12] + x [44];
+	const DT		t_21 = x [28] + x [60];
+	const DT		t_22 = t_20 + t_21;
+	const DT		t_23 = t_20 - t_21;
+	const DT		t_24 = x [2] - x [34];
+	const DT		t_25 = x [18] - x [50];
+	const DT		t_26 = x [2] + x [34];
+	const DT		t_27 = x [18] + x [50];
+	const DT		t_28 = t_26 + t_27;
+	const DT		t_29 = t_26 - t_27;
+	const DT		t_30 = x [10] - x [42];
+	const DT		t_31 = x [26] - x [58];
+	const DT		t_32 = x [10] + x [42];
+	const DT		t_33 = x [26] + x [58];
+	const DT		t_34 = t_32 + t_33;
+	const DT		t_35 = t_32 - t_33;
+	const DT		t_36 = x [6] - x [38];
+	const DT		t_37 = x [22] - x [54];
+	const DT		t_38 = x [38] + x [6];
+	const DT		t_39 = x [22] + x [54];
+	const DT		t_40 = t_38 + t_39;
+	const DT		t_41 = t_38 - t_39;
+	const DT		t_42 = x [14] - x [46];
+	const DT		t_43 = x [30] - x [62];
+	const DT		t_44 = x [14] + x [46];
+	const DT		t_45 = x [30] + x [62];
+	const DT		t_46 = t_44 + t_45;
+	const DT		t_47 = t_44 - t_45;
+	const DT		t_48 = x [1] - x [33];
+	const DT		t_49 = x [17] - x [49];
+	const DT		t_50 = x [1] + x [33];
+	const DT		t_51 = x [17] + x [49];
+	const DT		t_52 = t_50 + t_51;
+	const DT		t_53 = t_50 - t_51;
+	const DT		t_54 = x [9] - x [41];
+	const DT		t_55 = x [25] - x [57];
+	const DT		t_56 = x [41] + x [9];
+	const DT		t_57 = x [25] + x [57];
+	const DT		t_58 = t_56 + t_57;
+	const DT		t_59 = t_56 - t_57;
+	const DT		t_60 = x [5] - x [37];
+	const DT		t_61 = x [21] - x [53];
+	const DT		t_62 = x [37] + x [5];
+	const DT		t_63 = x [21] + x [53];
+	const DT		t_64 = t_62 + t_63;
+	const DT		t_65 = t_62 - t_63;
+	const DT		t_66 = x [13] - x [45];
+	const DT		t_67 = x [29] - x [61];
+	const DT		t_68 = x [13] + x [45];
+	const DT		t_69 = x [29] + x [61];
+	const DT		t_70 = t_68 + t_69;
+	const DT		t_71 = t_68 - t_69;
+	const DT		t_72 = x [3] - x [35];
+	const DT		t_73 = x [19] - x [51];
+	const DT		t_74 = x [35] + x [3];
+	const DT		t_75 = x [19] + x [51];
+	const DT		t_76 = t_74 + t_75;
+	const DT		t_77 = t_74 - t_75;
+	const DT		t_78 = x [11] - x [43];
+	const DT		t_79 = x [27] - x [59];
+	const DT		t_80 = x [11] + x [43];
+	const DT		t_81 = x [27] + x [59];
+	const DT		t_82 = t_80 + t_81;
+	const DT		t_83 = t_80 - t_81;
+	const DT		t_84 = x [7] - x [39];
+	const DT		t_85 = x [23] - x [55];
+	const DT		t_86 = x [39] + x [7];
+	const DT		t_87 = x [23] + x [55];
+	const DT		t_88 = t_86 + t_87;
+	const DT		t_89 = t_86 - t_87;
+	const DT		t_90 = x [15] - x [47];
+	const DT		t_91 = x [31] - x [63];
+	const DT		t_92 = x [15] + x [47];
+	const DT		t_93 = x [31] + x [63];
+	const DT		t_94 = t_92 + t_93;
+	const DT		t_95 = t_92 - t_93;
+	const DT		t_96 = t_10 + t_4;
+	const DT		t_97 = t_4 - t_10;
+	const DT		t_98 = t_6 - t_7;
+	const DT		t_99 = t_98 * DT (0.70710678118654757274);
+	const DT		t_100 = t_0 + t_99;
+	const DT		t_101 = t_0 - t_99;
+	const DT		t_102 = t_6 + t_7;
+	const DT		t_103 = t_102 * DT (0.70710678118654757274);
+	const DT		t_104 = t_1 + t_103;
+	const DT		t_105 = t_103 - t_1;
+	const DT		t_106 = t_16 + t_22;
+	const DT		t_107 = t_16 - t_22;
+	const DT		t_108 = t_18 - t_19;
+	const DT		t_109 = t_108 * DT (0.70710678118654757274);
+	const DT		t_110 = t_109 + t_12;
+	const DT		t_111 = t_12 - t_109;
+	const DT		t_112 = t_18 + t_19;
+	const DT		t_113 = t_112 * DT (0.70710678118654757274);
+	const DT		t_114 = t_113 + t_13;
+	const DT		t_115 = t_113 - t_13;
+	const DT		t_116 = t_28 + t_34;
+	const DT		t_117 = t_28 - t_34;
+	const DT		t_118 = t_30 - t_31;
+	const DT		t_119 = t_118 * DT (0.70710678118654757274);
+	const DT		t_120 = t_119 + t_24;
+	const DT		t_121 = t_24 - t_119;
+	const DT		t_122 = t_30 + t_31;
+	const DT		t_123 = t_122 * DT (0.70710678118654757274);
+	const DT		t_124 = t_123 + t_25;
+	const DT		t_125 = t_123 - t_25;
+	const DT		t_126 = t_40 + t_46;
+	const DT		t_127 = t_40 - t_46;
+	const DT		t_128 = t_42 - t_43;
+	const DT		t_129 = t_128 * DT (0.70710678118654757274);
+	const DT		t_130 = t_129 + t_36;
+	const DT		t_131 = t_36 - t_129;
+	const DT		t_132 = t_42 + t_43;
+	const DT		t_133 = t_132 * DT (0.70710678118654757274);
+	const DT		t_134 = t_133 + t_37;
+	const DT		t_135 = t_133 - t_37;
+	const DT		t_136 = t_52 + t_58;
+	const DT		t_137 = t_52 - t_58;
+	const DT		t_138 = t_54 - t_55;
+	const DT		t_139 = t_138 * DT (0.70710678118654757274);
+	const DT		t_140 = t_139 + t_48;
+	const DT		t_141 = t_48 - t_139;
+	const DT		t_142 = t_54 + t_55;
+	const DT		t_143 = t_142 * DT (0.70710678118654757274);
+	const DT		t_144 = t_143 + t_49;
+	const DT		t_145 = t_143 - t_49;
+	const DT		t_146 = t_64 + t_70;
+	const DT		t_147 = t_64 - t_70;
+	const DT		t_148 = t_66 - t_67;
+	const DT		t_149 = t_148 * DT (0.70710678118654757274);
+	const DT		t_150 = t_149 + t_60;
+	const DT		t_151 = t_60 - t_149;
+	const DT		t_152 = t_66 + t_67;
+	const DT		t_153 = t_152 * DT (0.70710678118654757274);
+	const DT		t_154 = t_153 + t_61;
+	const DT		t_155 = t_153 - t_61;
+	const DT		t_156 = t_76 + t_82;
+	const DT		t_157 = t_76 - t_82;
+	const DT		t_158 = t_78 - t_79;
+	const DT		t_159 = t_158 * DT (0.70710678118654757274);
+	const DT		t_160 = t_159 + t_72;
+	const DT		t_161 = t_72 - t_159;
+	const DT		t_162 = t_78 + t_79;
+	const DT		t_163 = t_162 * DT (0.70710678118654757274);
+	const DT		t_164 = t_163 + t_73;
+	const DT		t_165 = t_163 - t_73;
+	const DT		t_166 = t_88 + t_94;
+	const DT		t_167 = t_88 - t_94;
+	const DT		t_168 = t_90 - t_91;
+	const DT		t_169 = t_168 * DT (0.70710678118654757274);
+	const DT		t_170 = t_169 + t_84;
+	const DT		t_171 = t_84 - t_169;
+	const DT		t_172 = t_90 + t_91;
+	const DT		t_173 = t_172 * DT (0.70710678118654757274);
+	const DT		t_174 = t_173 + t_85;
+	const DT		t_175 = t_173 - t_85;
+	const DT		t_176 = t_106 + t_96;
+	const DT		t_177 = t_96 - t_106;
+	const DT		t_178 = t_110 * DT (0.92387953251128673848);
+	const DT		t_179 = t_114 * DT (0.38268343236508978178);
+	const DT		t_180 = t_178 - t_179;
+	const DT		t_181 = t_110 * DT (0.38268343236508978178);
+	const DT		t_182 = t_114 * DT (0.92387953251128673848);
+	const DT		t_183 = t_181 + t_182;
+	const DT		t_184 = t_100 + t_180;
+	const DT		t_185 = t_100 - t_180;
+	const DT		t_186 = t_104 + t_183;
+	const DT		t_187 = t_183 - t_104;
+	const DT		t_188 = t_17 - t_23;
+	const DT		t_189 = t_188 * DT (0.70710678118654757274);
+	const DT		t_190 = t_17 + t_23;
+	const DT		t_191 = t_190 * DT (0.70710678118654757274);
+	const DT		t_192 = t_189 + t_5;
+	const DT		t_193 = t_5 - t_189;
+	const DT		t_194 = t_11 + t_191;
+	const DT		t_195 = t_191 - t_11;
+	const DT		t_196 = t_111 * DT (0.38268343236508983729);
+	const DT		t_197 = t_115 * DT (0.92387953251128673848);
+	const DT		t_198 = t_196 - t_197;
+	const DT		t_199 = t_111 * DT (0.92387953251128673848);
+	const DT		t_200 = t_115 * DT (0.38268343236508983729);
+	const DT		t_201 = t_199 + t_200;
+	const DT		t_202 = t_101 + t_198;
+	const DT		t_203 = t_101 - t_198;
+	const DT		t_204 = t_105 + t_201;
+	const DT		t_205 = t_201 - t_105;
+	const DT		t_206 = t_116 + t_126;
+	const DT		t_207 = t_116 - t_126;
+	const DT		t_208 = t_130 * DT (0.92387953251128673848);
+	const DT		t_209 = t_134 * DT (0.38268343236508978178);
+	const DT		t_210 = t_208 - t_209;
+	const DT		t_211 = t_130 * DT (0.38268343236508978178);
+	const DT		t_212 = t_134 * DT (0.92387953251128673848);
+	const DT		t_213 = t_211 + t_212;
+	const DT		t_214 = t_120 + t_210;
+	const DT		t_215 = t_120 - t_210;
+	const DT		t_216 = t_124 + t_213;
+	const DT		t_217 = t_213 - t_124;
+	const DT		t_218 = t_41 - t_47;
+	const DT		t_219 = t_218 * DT (0.70710678118654757274);
+	const DT		t_220 = t_41 + t_47;
+	const DT		t_221 = t_220 * DT (0.70710678118654757274);
+	const DT		t_222 = t_219 + t_29;
+	const DT		t_223 = t_29 - t_219;
+	const DT		t_224 = t_221 + t_35;
+	const DT		t_225 = t_221 - t_35;
+	const DT		t_226 = t_131 * DT (0.38268343236508983729);
+	const DT		t_227 = t_135 * DT (0.92387953251128673848);
+	const DT		t_228 = t_226 - t_227;
+	const DT		t_229 = t_131 * DT (0.92387953251128673848);
+	const DT		t_230 = t_135 * DT (0.38268343236508983729);
+	const DT		t_231 = t_229 + t_230;
+	const DT		t_232 = t_121 + t_228;
+	const DT		t_233 = t_121 - t_228;
+	const DT		t_234 = t_125 + t_231;
+	const DT		t_235 = t_231 - t_125;
+	const DT		t_236 = t_136 + t_146;
+	const DT		t_237 = t_136 - t_146;
+	const DT		t_238 = t_150 * DT (0.92387953251128673848);
+	const DT		t_239 = t_154 * DT (0.38268343236508978178);
+	const DT		t_240 = t_238 - t_239;
+	const DT		t_241 = t_150 * DT (0.38268343236508978178);
+	const DT		t_242 = t_154 * DT (0.92387953251128673848);
+	const DT		t_243 = t_241 + t_242;
+	const DT		t_244 = t_140 + t_240;
+	const DT		t_245 = t_140 - t_240;
+	const DT		t_246 = t_144 + t_243;
+	const DT		t_247 = t_243 - t_144;
+	const DT		t_248 = t_65 - t_71;
+	const DT		t_249 = t_248 * DT (0.70710678118654757274);
+	const DT		t_250 = t_65 + t_71;
+	const DT		t_251 = t_250 * DT (0.70710678118654757274);
+	const DT		t_252 = t_249 + t_53;
+	const DT		t_253 = t_53 - t_249;
+	const DT		t_254 = t_251 + t_59;
+	const DT		t_255 = t_251 - t_59;
+	const DT		t_256 = t_151 * DT (0.38268343236508983729);
+	const DT		t_257 = t_155 * DT (0.92387953251128673848);
+	const DT		t_258 = t_256 - t_257;
+	const DT		t_259 = t_151 * DT (0.92387953251128673848);
+	const DT		t_260 = t_155 * DT (0.38268343236508983729);
+	const DT		t_261 = t_259 + t_260;
+	const DT		t_262 = t_141 + t_258;
+	const DT		t_263 = t_141 - t_258;
+	const DT		t_264 = t_145 + t_261;
+	const DT		t_265 = t_261 - t_145;
+	const DT		t_266 = t_156 + t_166;
+	const DT		t_267 = t_156 - t_166;
+	const DT		t_268 = t_170 * DT (0.92387953251128673848);
+	const DT		t_269 = t_174 * DT (0.38268343236508978178);
+	const DT		t_270 = t_268 - t_269;
+	const DT		t_271 = t_170 * DT (0.38268343236508978178);
+	const DT		t_272 = t_174 * DT (0.92387953251128673848);
+	const DT		t_273 = t_271 + t_272;
+	const DT		t_274 = t_160 + t_270;
+	const DT		t_275 = t_160 - t_270;
+	const DT		t_276 = t_164 + t_273;
+	const DT		t_277 = t_273 - t_164;
+	const DT		t_278 = t_89 - t_95;
+	const DT		t_279 = t_278 * DT (0.70710678118654757274);
+	const DT		t_280 = t_89 + t_95;
+	const DT		t_281 = t_280 * DT (0.70710678118654757274);
+	const DT		t_282 = t_279 + t_77;
+	const DT		t_283 = t_77 - t_279;
+	const DT		t_284 = t_281 + t_83;
+	const DT		t_285 = t_281 - t_83;
+	const DT		t_286 = t_171 * DT (0.38268343236508983729);
+	const DT		t_287 = t_175 * DT (0.92387953251128673848);
+	const DT		t_288 = t_286 - t_287;
+	const DT		t_289 = t_171 * DT (0.92387953251128673848);
+	const DT		t_290 = t_175 * DT (0.38268343236508983729);
+	const DT		t_291 = t_289 + t_290;
+	const DT		t_292 = t_161 + t_288;
+	const DT		t_293 = t_161 - t_288;
+	const DT		t_294 = t_165 + t_291;
+	const DT		t_295 = t_291 - t_165;
+	const DT		t_296 = t_176 + t_206;
+	const DT		t_297 = t_176 - t_206;
+	const DT		t_298 = t_214 * DT (0.98078528040323043058);
+	const DT		t_299 = t_216 * DT (0.19509032201612824808);
+	const DT		t_300 = t_298 - t_299;
+	const DT		t_301 = t_214 * DT (0.19509032201612824808);
+	const DT		t_302 = t_216 * DT (0.98078528040323043058);
+	const DT		t_303 = t_301 + t_302;
+	const DT		t_304 = t_184 + t_300;
+	const DT		t_305 = t_184 - t_300;
+	const DT		t_306 = t_186 + t_303;
+	const DT		t_307 = t_303 - t_186;
+	const DT		t_308 = t_222 * DT (0.92387953251128673848);
+	const DT		t_309 = t_224 * DT (0.38268343236508978178);
+	const DT		t_310 = t_308 - t_309;
+	const DT		t_311 = t_222 * DT (0.38268343236508978178);
+	const DT		t_312 = t_224 * DT (0.92387953251128673848);
+	const DT		t_313 = t_311 + t_312;
+	const DT		t_314 = t_192 + t_310;
+	const DT		t_315 = t_192 - t_310;
+	const DT		t_316 = t_194 + t_313;
+	const DT		t_317 = t_313 - t_194;
+	const DT		t_318 = t_232 * DT (0.83146961230254523567);
+	const DT		t_319 = t_234 * DT (0.55557023301960217765);
+	const DT		t_320 = t_318 - t_319;
+	const DT		t_321 = t_232 * DT (0.55557023301960217765);
+	const DT		t_322 = t_234 * DT (0.83146961230254523567);
+	const DT		t_323 = t_321 + t_322;
+	const DT		t_324 = t_202 + t_320;
+	const DT		t_325 = t_202 - t_320;
+	const DT		t_326 = t_204 + t_323;
+	const DT		t_327 = t_323 - t_204;
+	const DT		t_328 = t_117 - t_127;
+	const DT		t_329 = t_328 * DT (0.70710678118654757274);
+	const DT		t_330 = t_117 + t_127;
+	const DT		t_331 = t_330 * DT (0.70710678118654757274);
+	const DT		t_332 = t_329 + t_97;
+	const DT		t_333 = t_97 - t_329;
+	const DT		t_334 = t_107 + t_331;
+	const DT		t_335 = t_331 - t_107;
+	const DT		t_336 = t_233 * DT (0.55557023301960228867);
+	const DT		t_337 = t_235 * DT (0.83146961230254523567);
+	const DT		t_338 = t_336 - t_337;
+	const DT		t_339 = t_233 * DT (0.83146961230254523567);
+	const DT		t_340 = t_235 * DT (0.55557023301960228867);
+	const DT		t_341 = t_339 + t_340;
+	const DT		t_342 = t_203 + t_338;
+	const DT		t_343 = t_203 - t_338;
+	const DT		t_344 = t_205 + t_341;
+	const DT		t_345 = t_341 - t_205;
+	const DT		t_346 = t_223 * DT (0.38268343236508983729);
+	const DT		t_347 = t_225 * DT (0.92387953251128673848);
+	const DT		t_348 = t_346 - t_347;
+	const DT		t_349 = t_223 * DT (0.92387953251128673848);
+	const DT		t_350 = t_225 * DT (0.38268343236508983729);
+	const DT		t_351 = t_349 + t_350;
+	const DT		t_352 = t_193 + t_348;
+	const DT		t_353 = t_193 - t_348;
+	const DT		t_354 = t_195 + t_351;
+	const DT		t_355 = t_351 - t_195;
+	const DT		t_356 = t_215 * DT (0.19509032201612833135);
+	const DT		t_357 = t_217 * DT (0.98078528040323043058);
+	const DT		t_358 = t_356 - t_357;
+	const DT		t_359 = t_215 * DT (0.98078528040323043058);
+	const DT		t_360 = t_217 * DT (0.19509032201612833135);
+	const DT		t_361 = t_359 + t_360;
+	const DT		t_362 = t_185 + t_358;
+	const DT		t_363 = t_185 - t_358;
+	const DT		t_364 = t_187 + t_361;
+	const DT		t_365 = t_361 - t_187;
+	const DT		t_366 = t_236 + t_266;
+	const DT		t_367 = t_236 - t_266;
+	const DT		t_368 = t_274 * DT (0.98078528040323043058);
+	const DT		t_369 = t_276 * DT (0.19509032201612824808);
+	const DT		t_370 = t_368 - t_369;
+	const DT		t_371 = t_274 * DT (0.19509032201612824808);
+	const DT		t_372 = t_276 * DT (0.98078528040323043058);
+	const DT		t_373 = t_371 + t_372;
+	const DT		t_374 = t_244 + t_370;
+	const DT		t_375 = t_244 - t_370;
+	const DT		t_376 = t_246 + t_373;
+	const DT		t_377 = t_373 - t_246;
+	const DT		t_378 = t_282 * DT (0.92387953251128673848);
+	const DT		t_379 = t_284 * DT (0.38268343236508978178);
+	const DT		t_380 = t_378 - t_379;
+	const DT		t_381 = t_282 * DT (0.38268343236508978178);
+	const DT		t_382 = t_284 * DT (0.92387953251128673848);
+	const DT		t_383 = t_381 + t_382;
+	const DT		t_384 = t_252 + t_380;
+	const DT		t_385 = t_252 - t_380;
+	const DT		t_386 = t_254 + t_383;
+	const DT		t_387 = t_383 - t_254;
+	const DT		t_388 = t_292 * DT (0.83146961230254523567);
+	const DT		t_389 = t_294 * DT (0.55557023301960217765);
+	const DT		t_390 = t_388 - t_389;
+	const DT		t_391 = t_292 * DT (0.55557023301960217765);
+	const DT		t_392 = t_294 * DT (0.83146961230254523567);
+	const DT		t_393 = t_391 + t_392;
+	const DT		t_394 = t_262 + t_390;
+	const DT		t_395 = t_262 - t_390;
+	const DT		t_396 = t_264 + t_393;
+	const DT		t_397 = t_393 - t_264;
+	const DT		t_398 = t_157 - t_167;
+	const DT		t_399 = t_398 * DT (0.70710678118654757274);
+	const DT		t_400 = t_157 + t_167;
+	const DT		t_401 = t_400 * DT (0.70710678118654757274);
+	const DT		t_402 = t_137 + t_399;
+	const DT		t_403 = t_137 - t_399;
+	const DT		t_404 = t_147 + t_401;
+	const DT		t_405 = t_401 - t_147;
+	const DT		t_406 = t_293 * DT (0.55557023301960228867);
+	const DT		t_407 = t_295 * DT (0.83146961230254523567);
+	const DT		t_408 = t_406 - t_407;
+	const DT		t_409 = t_293 * DT (0.83146961230254523567);
+	const DT		t_410 = t_295 * DT (0.55557023301960228867);
+	const DT		t_411 = t_409 + t_410;
+	const DT		t_412 = t_263 + t_408;
+	const DT		t_413 = t_263 - t_408;
+	const DT		t_414 = t_265 + t_411;
+	const DT		t_415 = t_411 - t_265;
+	const DT		t_416 = t_283 * DT (0.38268343236508983729);
+	const DT		t_417 = t_285 * DT (0.92387953251128673848);
+	const DT		t_418 = t_416 - t_417;
+	const DT		t_419 = t_283 * DT (0.92387953251128673848);
+	const DT		t_420 = t_285 * DT (0.38268343236508983729);
+	const DT		t_421 = t_419 + t_420;
+	const DT		t_422 = t_253 + t_418;
+	const DT		t_423 = t_253 - t_418;
+	const DT		t_424 = t_255 + t_421;
+	const DT		t_425 = t_421 - t_255;
+	const DT		t_426 = t_275 * DT (0.19509032201612833135);
+	const DT		t_427 = t_277 * DT (0.98078528040323043058);
+	const DT		t_428 = t_426 - t_427;
+	const DT		t_429 = t_275 * DT (0.98078528040323043058);
+	const DT		t_430 = t_277 * DT (0.19509032201612833135);
+	const DT		t_431 = t_429 + t_430;
+	const DT		t_432 = t_245 + t_428;
+	const DT		t_433 = t_245 - t_428;
+	const DT		t_434 = t_247 + t_431;
+	const DT		t_435 = t_431 - t_247;
+	const DT		t_436 = t_296 + t_366;
+	const DT		t_437 = t_296 - t_366;
+	const DT		t_438 = t_374 * DT (0.99518472667219692873);
+	const DT		t_439 = t_376 * DT (0.09801714032956060363);
+	const DT		t_440 = t_438 - t_439;
+	const DT		t_441 = t_374 * DT (0.09801714032956060363);
+	const DT		t_442 = t_376 * DT (0.99518472667219692873);
+	const DT		t_443 = t_441 + t_442;
+	const DT		t_444 = t_304 + t_440;
+	const DT		t_445 = t_304 - t_440;
+	const DT		t_446 = t_306 + t_443;
+	const DT		t_447 = t_443 - t_306;
+	const DT		t_448 = t_384 * DT (0.98078528040323043058);
+	const DT		t_449 = t_386 * DT (0.19509032201612824808);
+	const DT		t_450 = t_448 - t_449;
+	const DT		t_451 = t_384 * DT (0.19509032201612824808);
+	const DT		t_452 = t_386 * DT (0.98078528040323043058);
+	const DT		t_453 = t_451 + t_452;
+	const DT		t_454 = t_314 + t_450;
+	const DT		t_455 = t_314 - t_450;
+	const DT		t_456 = t_316 + t_453;
+	const DT		t_457 = t_453 - t_316;
+	const DT		t_458 = t_394 * DT (0.95694033573220882438);
+	const DT		t_459 = t_396 * DT (0.29028467725446233105);
+	const DT		t_460 = t_458 - t_459;
+	const DT		t_461 = t_394 * DT (0.29028467725446233105);
+	const DT		t_462 = t_396 * DT (0.95694033573220882438);
+	const DT		t_463 = t_461 + t_462;
+	const DT		t_464 = t_324 + t_460;
+	const DT		t_465 = t_324 - t_460;
+	const DT		t_466 = t_326 + t_463;
+	const DT		t_467 = t_463 - t_326;
+	const DT		t_468 = t_402 * DT (0.92387953251128673848);
+	const DT		t_469 = t_404 * DT (0.38268343236508978178);
+	const DT		t_470 = t_468 - t_469;
+	const DT		t_471 = t_402 * DT (0.38268343236508978178);
+	const DT		t_472 = t_404 * DT (0.92387953251128673848);
+	const DT		t_473 = t_471 + t_472;
+	const DT		t_474 = t_332 + t_470;
+	const DT		t_475 = t_332 - t_470;
+	const DT		t_476 = t_334 + t_473;
+	const DT		t_477 = t_473 - t_334;
+	const DT		t_478 = t_412 * DT (0.88192126434835504956);
+	const DT		t_479 = t_414 * DT (0.47139673682599764204);
+	const DT		t_480 = t_478 - t_479;
+	const DT		t_481 = t_412 * DT (0.47139673682599764204);
+	const DT		t_482 = t_414 * DT (0.88192126434835504956);
+	const DT		t_483 = t_481 + t_482;
+	const DT		t_484 = t_342 + t_480;
+	const DT		t_485 = t_342 - t_480;
+	const DT		t_486 = t_344 + t_483;
+	const DT		t_487 = t_483 - t_344;
+	const DT		t_488 = t_422 * DT (0.83146961230254523567);
+	const DT		t_489 = t_424 * DT (0.55557023301960217765);
+	const DT		t_490 = t_488 - t_489;
+	const DT		t_491 = t_422 * DT (0.55557023301960217765);
+	const DT		t_492 = t_424 * DT (0.83146961230254523567);
+	const DT		t_493 = t_491 + t_492;
+	const DT		t_494 = t_352 + t_490;
+	const DT		t_495 = t_352 - t_490;
+	const DT		t_496 = t_354 + t_493;
+	const DT		t_497 = t_493 - t_354;
+	const DT		t_498 = t_432 * DT (0.77301045336273699338);
+	const DT		t_499 = t_434 * DT (0.63439328416364548779);
+	const DT		t_500 = t_498 - t_499;
+	const DT		t_501 = t_432 * DT (0.63439328416364548779);
+	const DT		t_502 = t_434 * DT (0.77301045336273699338);
+	const DT		t_503 = t_501 + t_502;
+	const DT		t_504 = t_362 + t_500;
+	const DT		t_505 = t_362 - t_500;
+	const DT		t_506 = t_364 + t_503;
+	const DT		t_507 = t_503 - t_364;
+	const DT		t_508 = t_237 - t_267;
+	const DT		t_509 = t_508 * DT (0.70710678118654757274);
+	const DT		t_510 = t_237 + t_267;
+	const DT		t_511 = t_510 * DT (0.70710678118654757274);
+	const DT		t_512 = t_177 + t_509;
+	const DT		t_513 = t_177 - t_509;
+	const DT		t_514 = t_207 + t_511;
+	const DT		t_515 = t_511 - t_207;
+	const DT		t_516 = t_433 * DT (0.63439328416364548779);
+	const DT		t_517 = t_435 * DT (0.77301045336273699338);
+	const DT		t_518 = t_516 - t_517;
+	const DT		t_519 = t_433 * DT (0.77301045336273699338);
+	const DT		t_520 = t_435 * DT (0.63439328416364548779);
+	const DT		t_521 = t_519 + t_520;
+	const DT		t_522 = t_363 + t_518;
+	const DT		t_523 = t_363 - t_518;
+	const DT		t_524 = t_365 + t_521;
+	const DT		t_525 = t_521 - t_365;
+	const DT		t_526 = t_423 * DT (0.55557023301960228867);
+	const DT		t_527 = t_425 * DT (0.83146961230254523567);
+	const DT		t_528 = t_526 - t_527;
+	const DT		t_529 = t_423 * DT (0.83146961230254523567);
+	const DT		t_530 = t_425 * DT (0.55557023301960228867);
+	const DT		t_531 = t_529 + t_530;
+	const DT		t_532 = t_353 + t_528;
+	const DT		t_533 = t_353 - t_528;
+	const DT		t_534 = t_355 + t_531;
+	const DT		t_535 = t_531 - t_355;
+	const DT		t_536 = t_413 * DT (0.47139673682599780857);
+	const DT		t_537 = t_415 * DT (0.88192126434835493853);
+	const DT		t_538 = t_536 - t_537;
+	const DT		t_539 = t_413 * DT (0.88192126434835493853);
+	const DT		t_540 = t_415 * DT (0.47139673682599780857);
+	const DT		t_541 = t_539 + t_540;
+	const DT		t_542 = t_343 + t_538;
+	const DT		t_543 = t_343 - t_538;
+	const DT		t_544 = t_345 + t_541;
+	const DT		t_545 = t_541 - t_345;
+	const DT		t_546 = t_403 * DT (0.38268343236508983729);
+	const DT		t_547 = t_405 * DT (0.92387953251128673848);
+	const DT		t_548 = t_546 - t_547;
+	const DT		t_549 = t_403 * DT (0.92387953251128673848);
+	const DT		t_550 = t_405 * DT (0.38268343236508983729);
+	const DT		t_551 = t_549 + t_550;
+	const DT		t_552 = t_333 + t_548;
+	const DT		t_553 = t_333 - t_548;
+	const DT		t_554 = t_335 + t_551;
+	const DT		t_555 = t_551 - t_335;
+	const DT		t_556 = t_395 * DT (0.29028467725446233105);
+	const DT		t_557 = t_397 * DT (0.95694033573220893540);
+	const DT		t_558 = t_556 - t_557;
+	const DT		t_559 = t_395 * DT (0.95694033573220893540);
+	const DT		t_560 = t_397 * DT (0.29028467725446233105);
+	const DT		t_561 = t_559 + t_560;
+	const DT		t_562 = t_325 + t_558;
+	const DT		t_563 = t_325 - t_558;
+	const DT		t_564 = t_327 + t_561;
+	const DT		t_565 = t_561 - t_327;
+	const DT		t_566 = t_385 * DT (0.19509032201612833135);
+	const DT		t_567 = t_387 * DT (0.98078528040323043058);
+	const DT		t_568 = t_566 - t_567;
+	const DT		t_569 = t_385 * DT (0.98078528040323043058);
+	const DT		t_570 = t_387 * DT (0.19509032201612833135);
+	const DT		t_571 = t_569 + t_570;
+	const DT		t_572 = t_315 + t_568;
+	const DT		t_573 = t_315 - t_568;
+	const DT		t_574 = t_317 + t_571;
+	const DT		t_575 = t_571 - t_317;
+	const DT		t_576 = t_375 * DT (0.09801714032956077016);
+	const DT		t_577 = t_377 * DT (0.99518472667219681771);
+	const DT		t_578 = t_576 - t_577;
+	const DT		t_579 = t_375 * DT (0.99518472667219681771);
+	const DT		t_580 = t_377 * DT (0.09801714032956077016);
+	const DT		t_581 = t_579 + t_580;
+	const DT		t_582 = t_305 + t_578;
+	const DT		t_583 = t_305 - t_578;
+	const DT		t_584 = t_307 + t_581;
+	const DT		t_585 = t_581 - t_307;
+
+	f [0] = t_436;
+	f [1] = t_444;
+	f [2] = t_454;
+	f [3] = t_464;
+	f [4] = t_474;
+	f [5] = t_484;
+	f [6] = t_494;
+	f [7] = t_504;
+	f [8] = t_512;
+	f [9] = t_522;
+	f [10] = t_532;
+	f [11] = t_542;
+	f [12] = t_552;
+	f [13] = t_562;
+	f [14] = t_572;
+	f [15] = t_582;
+	f [16] = t_297;
+	f [17] = t_583;
+	f [18] = t_573;
+	f [19] = t_563;
+	f [20] = t_553;
+	f [21] = t_543;
+	f [22] = t_533;
+	f [23] = t_523;
+	f [24] = t_513;
+	f [25] = t_505;
+	f [26] = t_495;
+	f [27] = t_485;
+	f [28] = t_475;
+	f [29] = t_465;
+	f [30] = t_455;
+	f [31] = t_445;
+	f [32] = t_437;
+	f [33] = t_446;
+	f [34] = t_456;
+	f [35] = t_466;
+	f [36] = t_476;
+	f [37] = t_486;
+	f [38] = t_496;
+	f [39] = t_506;
+	f [40] = t_514;
+	f [41] = t_524;
+	f [42] = t_534;
+	f [43] = t_544;
+	f [44] = t_554;
+	f [45] = t_564;
+	f [46] = t_574;
+	f [47] = t_584;
+	f [48] = t_367;
+	f [49] = t_585;
+	f [50] = t_575;
+	f [51] = t_565;
+	f [52] = t_555;
+	f [53] = t_545;
+	f [54] = t_535;
+	f [55] = t_525;
+	f [56] = t_515;
+	f [57] = t_507;
+	f [58] = t_497;
+	f [59] = t_487;
+	f [60] = t_477;
+	f [61] = t_467;
+	f [62] = t_457;
+	f [63] = t_447;
+}
+
+
+
+// 64-point IFFT
+template <>
+template <class DT>
+void	FFTRealCodelet <6>::do_ifft (const DT f [], DT x [])
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+
+	const DT		t_0 = f [0] + f [32];
+	const DT		t_1 = f [0] - f [32];
+	const DT		t_2 = f [16] * 2;
+	const DT		t_3 = f [48] * 2;
+	const DT		t_4 = f [1] + f [31];
+	const DT		t_5 = f [33] - f [63];
+	const DT		t_6 = f [1] - f [31];
+	const DT		t_7 = f [33] + f [63];
+	const DT		t_8 = t_7 * DT (0.99518472667219692873);
+	const DT		t_9 = t_6 * DT (0.09801714032956060363);
+	const DT		t_10 = t_8 - t_9;
+	const DT		t_11 = t_7 * DT (0.09801714032956060363);
+	const DT		t_12 = t_6 * DT (0.99518472667219692873);
+	const DT		t_13 = t_11 + t_12;
+	const DT		t_14 = f [2] + f [30];
+	const DT		t_15 = f [34] - f [62];
+	const DT		t_16 = f [2] - f [30];
+	const DT		t_17 = f [34] + f [62];
+	const DT		t_18 = t_17 * DT (0.98078528040323043058);
+	const DT		t_19 = t_16 * DT (0.19509032201612824808);
+	const DT		t_20 = t_18 - t_19;
+	const DT		t_21 = t_17 * DT (0.19509032201612824808);
+	const DT		t_22 = t_16 * DT (0.98078528040323043058);
+	const DT		t_23 = t_21 + t_22;
+	const DT		t_24 = f [29] + f [3];
+	const DT		t_25 = f [35] - f [61];
+	const DT		t_26 = f [3] - f [29];
+	const DT		t_27 = f [35] + f [61];
+	const DT		t_28 = t_27 * DT (0.95694033573220882438);
+	const DT		t_29 = t_26 * DT (0.29028467725446233105);
+	const DT		t_30 = t_28 - t_29;
+	const DT		t_31 = t_27 * DT (0.29028467725446233105);
+	const DT		t_32 = t_26 * DT (0.95694033573220882438);
+	const DT		t_33 = t_31 + t_32;
+	const DT		t_34 = f [28] + f [4];
+	const DT		t_35 = f [36] - f [60];
+	const DT		t_36 = f [4] - f [28];
+	const DT		t_37 = f [36] + f [60];
+	const DT		t_38 = t_37 * DT (0.92387953251128673848);
+	const DT		t_39 = t_36 * DT (0.38268343236508978178);
+	const DT		t_40 = t_38 - t_39;
+	const DT		t_41 = t_37 * DT (0.38268343236508978178);
+	const DT		t_42 = t_36 * DT (0.92387953251128673848);
+	const DT		t_43 = t_41 + t_42;
+	const DT		t_44 = f [27] + f [5];
+	const DT		t_45 = f [37] - f [59];
+	const DT		t_46 = f [5] - f [27];
+	const DT		t_47 = f [37] + f [59];
+	const DT		t_48 = t_47 * DT (0.88192126434835504956);
+	const DT		t_49 = t_46 * DT (0.47139673682599764204);
+	const DT		t_50 = t_48 - t_49;
+	const DT		t_51 = t_47 * DT (0.47139673682599764204);
+	const DT		t_52 = t_46 * DT (0.88192126434835504956);
+	const DT		t_53 = t_51 + t_52;
+	const DT		t_54 = f [26] + f [6];
+	const DT		t_55 = f [38] - f [58];
+	const DT		t_56 = f [6] - f [26];
+	const DT		t_57 = f [38] + f [58];
+	const DT		t_58 = t_57 * DT (0.83146961230254523567);
+	const DT		t_59 = t_56 * DT (0.55557023301960217765);
+	const DT		t_60 = t_58 - t_59;
+	const DT		t_61 = t_57 * DT (0.55557023301960217765);
+	const DT		t_62 = t_56 * DT (0.83146961230254523567);
+	const DT		t_63 = t_61 + t_62;
+	const DT		t_64 = f [25] + f [7];
+	const DT		t_65 = f [39] - f [57];
+	const DT		t_66 = f [7] - f [25];
+	const DT		t_67 = f [39] + f [57];
+	const DT		t_68 = t_67 * DT (0.77301045336273699338);
+	const DT		t_69 = t_66 * DT (0.63439328416364548779);
+	const DT		t_70 = t_68 - t_69;
+	const DT		t_71 = t_67 * DT (0.63439328416364548779);
+	const DT		t_72 = t_66 * DT (0.77301045336273699338);
+	const DT		t_73 = t_71 + t_72;
+	const DT		t_74 = f [24] + f [8];
+	const DT		t_75 = f [40] - f [56];
+	const DT		t_76 = f [8] - f [24];
+	const DT		t_77 = f [40] + f [56];
+	const DT		t_78 = t_77 - t_76;
+	const DT		t_79 = t_78 * DT (0.70710678118654757274);
+	const DT		t_80 = t_76 + t_77;
+	const DT		t_81 = t_80 * DT (0.70710678118654757274);
+	const DT		t_82 = f [23] + f [9];
+	const DT		t_83 = f [41] - f [55];
+	const DT		t_84 = f [9] - f [23];
+	const DT		t_85 = f [41] + f [55];
+	const DT		t_86 = t_85 * DT (0.63439328416364548779);
+	const DT		t_87 = t_84 * DT (0.77301045336273699338);
+	const DT		t_88 = t_86 - t_87;
+	const DT		t_89 = t_85 * DT (0.77301045336273699338);
+	const DT		t_90 = t_84 * DT (0.63439328416364548779);
+	const DT		t_91 = t_89 + t_90;
+	const DT		t_92 = f [10] + f [22];
+	const DT		t_93 = f [42] - f [54];
+	const DT		t_94 = f [10] - f [22];
+	const DT		t_95 = f [42] + f [54];
+	const DT		t_96 = t_95 * DT (0.55557023301960228867);
+	const DT		t_97 = t_94 * DT (0.83146961230254523567);
+	const DT		t_98 = t_96 - t_97;
+	const DT		t_99 = t_95 * DT (0.83146961230254523567);
+	const DT		t_100 = t_94 * DT (0.55557023301960228867);
+	const DT		t_101 = t_100 + t_99;
+	const DT		t_102 = f [11] + f [21];
+	const DT		t_103 = f [43] - f [53];
+	const DT		t_104 = f [11] - f [21];
+	const DT		t_105 = f [43] + f [53];
+	const DT		t_106 = t_105 * DT (0.47139673682599780857);
+	const DT		t_107 = t_104 * DT (0.88192126434835493853);
+	const DT		t_108 = t_106 - t_107;
+	const DT		t_109 = t_105 * DT (0.88192126434835493853);
+	const DT		t_110 = t_104 * DT (0.47139673682599780857);
+	const DT		t_111 = t_109 + t_110;
+	const DT		t_112 = f [12] + f [20];
+	const DT		t_113 = f [44] - f [52];
+	const DT		t_114 = f [12] - f [20];
+	const DT		t_115 = f [44] + f [52];
+	const DT		t_116 = t_115 * DT (0.38268343236508983729);
+	const DT		t_117 = t_114 * DT (0.92387953251128673848);
+	const DT		t_118 = t_116 - t_117;
+	const DT		t_119 = t_115 * DT (0.92387953251128673848);
+	const DT		t_120 = t_114 * DT (0.38268343236508983729);
+	const DT		t_121 = t_119 + t_120;
+	const DT		t_122 = f [13] + f [19];
+	const DT		t_123 = f [45] - f [51];
+	const DT		t_124 = f [13] - f [19];
+	const DT		t_125 = f [45] + f [51];
+	const DT		t_126 = t_125 * DT (0.29028467725446233105);
+	const DT		t_127 = t_124 * DT (0.95694033573220893540);
+	const DT		t_128 = t_126 - t_127;
+	const DT		t_129 = t_125 * DT (0.95694033573220893540);
+	const DT		t_130 = t_124 * DT (0.29028467725446233105);
+	const DT		t_131 = t_129 + t_130;
+	const DT		t_132 = f [14] + f [18];
+	const DT		t_133 = f [46] - f [50];
+	const DT		t_134 = f [14] - f [18];
+	const DT		t_135 = f [46] + f [50];
+	const DT		t_136 = t_135 * DT (0.19509032201612833135);
+	const DT		t_137 = t_134 * DT (0.98078528040323043058);
+	const DT		t_138 = t_136 - t_137;
+	const DT		t_139 = t_135 * DT (0.98078528040323043058);
+	const DT		t_140 = t_134 * DT (0.19509032201612833135);
+	const DT		t_141 = t_139 + t_140;
+	const DT		t_142 = f [15] + f [17];
+	const DT		t_143 = f [47] - f [49];
+	const DT		t_144 = f [15] - f [17];
+	const DT		t_145 = f [47] + f [49];
+	const DT		t_146 = t_145 * DT (0.09801714032956077016);
+	const DT		t_147 = t_144 * DT (0.99518472667219681771);
+	const DT		t_148 = t_146 - t_147;
+	const DT		t_149 = t_145 * DT (0.99518472667219681771);
+	const DT		t_150 = t_144 * DT (0.09801714032956077016);
+	const DT		t_151 = t_149 + t_150;
+	const DT		t_152 = t_0 + t_2;
+	const DT		t_153 = t_0 - t_2;
+	const DT		t_154 = t_74 * 2;
+	const DT		t_155 = t_75 * 2;
+	const DT		t_156 = t_142 + t_4;
+	const DT		t_157 = t_5 - t_143;
+	const DT		t_158 = t_4 - t_142;
+	const DT		t_159 = t_143 + t_5;
+	const DT		t_160 = t_159 * DT (0.98078528040323043058);
+	const DT		t_161 = t_158 * DT (0.19509032201612824808);
+	const DT		t_162 = t_160 - t_161;
+	const DT		t_163 = t_159 * DT (0.19509032201612824808);
+	const DT		t_164 = t_158 * DT (0.98078528040323043058);
+	const DT		t_165 = t_163 + t_164;
+	const DT		t_166 = t_132 + t_14;
+	const DT		t_167 = t_15 - t_133;
+	const DT		t_168 = t_14 - t_132;
+	const DT		t_169 = t_133 + t_15;
+	const DT		t_170 = t_169 * DT (0.92387953251128673848);
+	const DT		t_171 = t_168 * DT (0.38268343236508978178);
+	const DT		t_172 = t_170 - t_171;
+	const DT		t_173 = t_169 * DT (0.38268343236508978178);
+	const DT		t_174 = t_168 * DT (0.92387953251128673848);
+	const DT		t_175 = t_173 + t_174;
+	const DT		t_176 = t_122 + t_24;
+	const DT		t_177 = t_25 - t_123;
+	const DT		t_178 = t_24 - t_122;
+	const DT		t_179 = t_123 + t_25;
+	const DT		t_180 = t_179 * DT (0.83146961230254523567);
+	const DT		t_181 = t_178 * DT (0.55557023301960217765);
+	const DT		t_182 = t_180 - t_181;
+	const DT		t_183 = t_179 * DT (0.55557023301960217765);
+	const DT		t_184 = t_178 * DT (0.83146961230254523567);
+	const DT		t_185 = t_183 + t_184;
+	const DT		t_186 = t_112 + t_34;
+	const DT		t_187 = t_35 - t_113;
+	const DT		t_188 = t_34 - t_112;
+	const DT		t_189 = t_113 + t_35;
+	const DT		t_190 = t_189 - t_188;
+	const DT		t_191 = t_190 * DT (0.70710678118654757274);
+	const DT		t_192 = t_188 + t_189;
+	const DT		t_193 = t_192 * DT (0.70710678118654757274);
+	const DT		t_194 = t_102 + t_44;
+	const DT		t_195 = t_45 - t_103;
+	const DT		t_196 = t_44 - t_102;
+	const DT		t_197 = t_103 + t_45;
+	const DT		t_198 = t_197 * DT (0.55557023301960228867);
+	const DT		t_199 = t_196 * DT (0.83146961230254523567);
+	const DT		t_200 = t_198 - t_199;
+	const DT		t_201 = t_197 * DT (0.83146961230254523567);
+	const DT		t_202 = t_196 * DT (0.55557023301960228867);
+	const DT		t_203 = t_201 + t_202;
+	const DT		t_204 = t_54 + t_92;
+	const DT		t_205 = t_55 - t_93;
+	const DT		t_206 = t_54 - t_92;
+	const DT		t_207 = t_55 + t_93;
+	const DT		t_208 = t_207 * DT (0.38268343236508983729);
+	const DT		t_209 = t_206 * DT (0.92387953251128673848);
+	const DT		t_210 = t_208 - t_209;
+	const DT		t_211 = t_207 * DT (0.92387953251128673848);
+	const DT		t_212 = t_206 * DT (0.38268343236508983729);
+	const DT		t_213 = t_211 + t_212;
+	const DT		t_214 = t_64 + t_82;
+	const DT		t_215 = t_65 - t_83;
+	const DT		t_216 = t_64 - t_82;
+	const DT		t_217 = t_65 + t_83;
+	const DT		t_218 = t_217 * DT (0.19509032201612833135);
+	const DT		t_219 = t_216 * DT (0.98078528040323043058);
+	const DT		t_220 = t_218 - t_219;
+	const DT		t_221 = t_217 * DT (0.98078528040323043058);
+	const DT		t_222 = t_216 * DT (0.19509032201612833135);
+	const DT		t_223 = t_221 + t_222;
+	const DT		t_224 = t_1 + t_3;
+	const DT		t_225 = t_1 - t_3;
+	const DT		t_226 = t_81 * 2;
+	const DT		t_227 = t_79 * 2;
+	const DT		t_228 = t_13 + t_151;
+	const DT		t_229 = t_10 - t_148;
+	const DT		t_230 = t_13 - t_151;
+	const DT		t_231 = t_10 + t_148;
+	const DT		t_232 = t_231 * DT (0.98078528040323043058);
+	const DT		t_233 = t_230 * DT (0.19509032201612824808);
+	const DT		t_234 = t_232 - t_233;
+	const DT		t_235 = t_231 * DT (0.19509032201612824808);
+	const DT		t_236 = t_230 * DT (0.98078528040323043058);
+	const DT		t_237 = t_235 + t_236;
+	const DT		t_238 = t_141 + t_23;
+	const DT		t_239 = t_20 - t_138;
+	const DT		t_240 = t_23 - t_141;
+	const DT		t_241 = t_138 + t_20;
+	const DT		t_242 = t_241 * DT (0.92387953251128673848);
+	const DT		t_243 = t_240 * DT (0.38268343236508978178);
+	const DT		t_244 = t_242 - t_243;
+	const DT		t_245 = t_241 * DT (0.38268343236508978178);
+	const DT		t_246 = t_240 * DT (0.92387953251128673848);
+	const DT		t_247 = t_245 + t_246;
+	const DT		t_248 = t_131 + t_33;
+	const DT		t_249 = t_30 - t_128;
+	const DT		t_250 = t_33 - t_131;
+	const DT		t_251 = t_128 + t_30;
+	const DT		t_252 = t_251 * DT (0.83146961230254523567);
+	const DT		t_253 = t_250 * DT (0.55557023301960217765);
+	const DT		t_254 = t_252 - t_253;
+	const DT		t_255 = t_251 * DT (0.55557023301960217765);
+	const DT		t_256 = t_250 * DT (0.83146961230254523567);
+	const DT		t_257 = t_255 + t_256;
+	const DT		t_258 = t_121 + t_43;
+	const DT		t_259 = t_40 - t_118;
+	const DT		t_260 = t_43 - t_121;
+	const DT		t_261 = t_118 + t_40;
+	const DT		t_262 = t_261 - t_260;
+	const DT		t_263 = t_262 * DT (0.70710678118654757274);
+	const DT		t_264 = t_260 + t_261;
+	const DT		t_265 = t_264 * DT (0.70710678118654757274);
+	const DT		t_266 = t_111 + t_53;
+	const DT		t_267 = t_50 - t_108;
+	const DT		t_268 = t_53 - t_111;
+	const DT		t_269 = t_108 + t_50;
+	const DT		t_270 = t_269 * DT (0.55557023301960228867);
+	const DT		t_271 = t_268 * DT (0.83146961230254523567);
+	const DT		t_272 = t_270 - t_271;
+	const DT		t_273 = t_269 * DT (0.83146961230254523567);
+	const DT		t_274 = t_268 * DT (0.55557023301960228867);
+	const DT		t_275 = t_273 + t_274;
+	const DT		t_276 = t_101 + t_63;
+	const DT		t_277 = t_60 - t_98;
+	const DT		t_278 = t_63 - t_101;
+	const DT		t_279 = t_60 + t_98;
+	const DT		t_280 = t_279 * DT (0.38268343236508983729);
+	const DT		t_281 = t_278 * DT (0.92387953251128673848);
+	const DT		t_282 = t_280 - t_281;
+	const DT		t_283 = t_279 * DT (0.92387953251128673848);
+	const DT		t_284 = t_278 * DT (0.38268343236508983729);
+	const DT		t_285 = t_283 + t_284;
+	const DT		t_286 = t_73 + t_91;
+	const DT		t_287 = t_70 - t_88;
+	const DT		t_288 = t_73 - t_91;
+	const DT		t_289 = t_70 + t_88;
+	const DT		t_290 = t_289 * DT (0.19509032201612833135);
+	const DT		t_291 = t_288 * DT (0.98078528040323043058);
+	const DT		t_292 = t_290 - t_291;
+	const DT		t_293 = t_289 * DT (0.98078528040323043058);
+	const DT		t_294 = t_288 * DT (0.19509032201612833135);
+	const DT		t_295 = t_293 + t_294;
+	const DT		t_296 = t_152 + t_154;
+	const DT		t_297 = t_152 - t_154;
+	const DT		t_298 = t_186 * 2;
+	const DT		t_299 = t_187 * 2;
+	const DT		t_300 = t_156 + t_214;
+	const DT		t_301 = t_157 - t_215;
+	const DT		t_302 = t_156 - t_214;
+	const DT		t_303 = t_157 + t_215;
+	const DT		t_304 = t_303 * DT (0.92387953251128673848);
+	const DT		t_305 = t_302 * DT (0.38268343236508978178);
+	const DT		t_306 = t_304 - t_305;
+	const DT		t_307 = t_303 * DT (0.38268343236508978178);
+	const DT		t_308 = t_302 * DT (0.92387953251128673848);
+	const DT		t_309 = t_307 + t_308;
+	const DT		t_310 = t_166 + t_204;
+	const DT		t_311 = t_167 - t_205;
+	const DT		t_312 = t_166 - t_204;
+	const DT		t_313 = t_167 + t_205;
+	const DT		t_314 = t_313 - t_312;
+	const DT		t_315 = t_314 * DT (0.70710678118654757274);
+	const DT		t_316 = t_312 + t_313;
+	const DT		t_317 = t_316 * DT (0.70710678118654757274);
+	const DT		t_318 = t_176 + t_194;
+	const DT		t_319 = t_177 - t_195;
+	const DT		t_320 = t_176 - t_194;
+	const DT		t_321 = t_177 + t_195;
+	const DT		t_322 = t_321 * DT (0.38268343236508983729);
+	const DT		t_323 = t_320 * DT (0.92387953251128673848);
+	const DT		t_324 = t_322 - t_323;
+	const DT		t_325 = t_321 * DT (0.92387953251128673848);
+	const DT		t_326 = t_320 * DT (0.38268343236508983729);
+	const DT		t_327 = t_325 + t_326;
+	const DT		t_328 = t_153 + t_155;
+	const DT		t_329 = t_153 - t_155;
+	const DT		t_330 = t_193 * 2;
+	const DT		t_331 = t_191 * 2;
+	const DT		t_332 = t_165 + t_223;
+	const DT		t_333 = t_162 - t_220;
+	const DT		t_334 = t_165 - t_223;
+	const DT		t_335 = t_162 + t_220;
+	const DT		t_336 = t_335 * DT (0.92387953251128673848);
+	const DT		t_337 = t_334 * DT (0.38268343236508978178);
+	const DT		t_338 = t_336 - t_337;
+	const DT		t_339 = t_335 * DT (0.38268343236508978178);
+	const DT		t_340 = t_334 * DT (0.92387953251128673848);
+	const DT		t_341 = t_339 + t_340;
+	const DT		t_342 = t_175 + t_213;
+	const DT		t_343 = t_172 - t_210;
+	const DT		t_344 = t_175 - t_213;
+	const DT		t_345 = t_172 + t_210;
+	const DT		t_346 = t_345 - t_344;
+	const DT		t_347 = t_346 * DT (0.70710678118654757274);
+	const DT		t_348 = t_344 + t_345;
+	const DT		t_349 = t_348 * DT (0.70710678118654757274);
+	const DT		t_350 = t_185 + t_203;
+	const DT		t_351 = t_182 - t_200;
+	const DT		t_352 = t_185 - t_203;
+	const DT		t_353 = t_182 + t_200;
+	const DT		t_354 = t_353 * DT (0.38268343236508983729);
+	const DT		t_355 = t_352 * DT (0.92387953251128673848);
+	const DT		t_356 = t_354 - t_355;
+	const DT		t_357 = t_353 * DT (0.92387953251128673848);
+	const DT		t_358 = t_352 * DT (0.38268343236508983729);
+	const DT		t_359 = t_357 + t_358;
+	const DT		t_360 = t_224 + t_226;
+	const DT		t_361 = t_224 - t_226;
+	const DT		t_362 = t_258 * 2;
+	const DT		t_363 = t_259 * 2;
+	const DT		t_364 = t_228 + t_286;
+	const DT		t_365 = t_229 - t_287;
+	const DT		t_366 = t_228 - t_286;
+	const DT		t_367 = t_229 + t_287;
+	const DT		t_368 = t_367 * DT (0.92387953251128673848);
+	const DT		t_369 = t_366 * DT (0.38268343236508978178);
+	const DT		t_370 = t_368 - t_369;
+	const DT		t_371 = t_367 * DT (0.38268343236508978178);
+	const DT		t_372 = t_366 * DT (0.92387953251128673848);
+	const DT		t_373 = t_371 + t_372;
+	const DT		t_374 = t_238 + t_276;
+	const DT		t_375 = t_239 - t_277;
+	const DT		t_376 = t_238 - t_276;
+	const DT		t_377 = t_239 + t_277;
+	const DT		t_378 = t_377 - t_376;
+	const DT		t_379 = t_378 * DT (0.70710678118654757274);
+	const DT		t_380 = t_376 + t_377;
+	const DT		t_381 = t_380 * DT (0.70710678118654757274);
+	const DT		t_382 = t_248 + t_266;
+	const DT		t_383 = t_249 - t_267;
+	const DT		t_384 = t_248 - t_266;
+	const DT		t_385 = t_249 + t_267;
+	const DT		t_386 = t_385 * DT (0.38268343236508983729);
+	const DT		t_387 = t_384 * DT (0.92387953251128673848);
+	const DT		t_388 = t_386 - t_387;
+	const DT		t_389 = t_385 * DT (0.92387953251128673848);
+	const DT		t_390 = t_384 * DT (0.38268343236508983729);
+	const DT		t_391 = t_389 + t_390;
+	const DT		t_392 = t_225 + t_227;
+	const DT		t_393 = t_225 - t_227;
+	const DT		t_394 = t_265 * 2;
+	const DT		t_395 = t_263 * 2;
+	const DT		t_396 = t_237 + t_295;
+	const DT		t_397 = t_234 - t_292;
+	const DT		t_398 = t_237 - t_295;
+	const DT		t_399 = t_234 + t_292;
+	const DT		t_400 = t_399 * DT (0.92387953251128673848);
+	const DT		t_401 = t_398 * DT (0.38268343236508978178);
+	const DT		t_402 = t_400 - t_401;
+	const DT		t_403 = t_399 * DT (0.38268343236508978178);
+	const DT		t_404 = t_398 * DT (0.92387953251128673848);
+	const DT		t_405 = t_403 + t_404;
+	const DT		t_406 = t_247 + t_285;
+	const DT		t_407 = t_244 - t_282;
+	const DT		t_408 = t_247 - t_285;
+	const DT		t_409 = t_244 + t_282;
+	const DT		t_410 = t_409 - t_408;
+	const DT		t_411 = t_410 * DT (0.70710678118654757274);
+	const DT		t_412 = t_408 + t_409;
+	const DT		t_413 = t_412 * DT (0.70710678118654757274);
+	const DT		t_414 = t_257 + t_275;
+	const DT		t_415 = t_254 - t_272;
+	const DT		t_416 = t_257 - t_275;
+	const DT		t_417 = t_254 + t_272;
+	const DT		t_418 = t_417 * DT (0.38268343236508983729);
+	const DT		t_419 = t_416 * DT (0.92387953251128673848);
+	const DT		t_420 = t_418 - t_419;
+	const DT		t_421 = t_417 * DT (0.92387953251128673848);
+	const DT		t_422 = t_416 * DT (0.38268343236508983729);
+	const DT		t_423 = t_421 + t_422;
+	const DT		t_424 = t_296 + t_298;
+	const DT		t_425 = t_296 - t_298;
+	const DT		t_426 = t_310 * 2;
+	const DT		t_427 = t_311 * 2;
+	const DT		t_428 = t_300 + t_318;
+	const DT		t_429 = t_301 - t_319;
+	const DT		t_430 = t_300 - t_318;
+	const DT		t_431 = t_301 + t_319;
+	const DT		t_432 = t_430 + t_431;
+	const DT		t_433 = t_432 * DT (0.70710678118654757274);
+	const DT		t_434 = t_431 - t_430;
+	const DT		t_435 = t_434 * DT (0.70710678118654757274);
+	const DT		t_436 = t_297 + t_299;
+	const DT		t_437 = t_297 - t_299;
+	const DT		t_438 = t_317 * 2;
+	const DT		t_439 = t_315 * 2;
+	const DT		t_440 = t_309 + t_327;
+	const DT		t_441 = t_306 - t_324;
+	const DT		t_442 = t_309 - t_327;
+	const DT		t_443 = t_306 + t_324;
+	const DT		t_444 = t_442 + t_443;
+	const DT		t_445 = t_444 * DT (0.70710678118654757274);
+	const DT		t_446 = t_443 - t_442;
+	const DT		t_447 = t_446 * DT (0.70710678118654757274);
+	const DT		t_448 = t_328 + t_330;
+	const DT		t_449 = t_328 - t_330;
+	const DT		t_450 = t_342 * 2;
+	const DT		t_451 = t_343 * 2;
+	const DT		t_452 = t_332 + t_350;
+	const DT		t_453 = t_333 - t_351;
+	const DT		t_454 = t_332 - t_350;
+	const DT		t_455 = t_333 + t_351;
+	const DT		t_456 = t_454 + t_455;
+	const DT		t_457 = t_456 * DT (0.70710678118654757274);
+	const DT		t_458 = t_455 - t_454;
+	const DT		t_459 = t_458 * DT (0.70710678118654757274);
+	const DT		t_460 = t_329 + t_331;
+	const DT		t_461 = t_329 - t_331;
+	const DT		t_462 = t_349 * 2;
+	const DT		t_463 = t_347 * 2;
+	const DT		t_464 = t_341 + t_359;
+	const DT		t_465 = t_338 - t_356;
+	const DT		t_466 = t_341 - t_359;
+	const DT		t_467 = t_338 + t_356;
+	const DT		t_468 = t_466 + t_467;
+	const DT		t_469 = t_468 * DT (0.70710678118654757274);
+	const DT		t_470 = t_467 - t_466;
+	const DT		t_471 = t_470 * DT (0.70710678118654757274);
+	const DT		t_472 = t_360 + t_362;
+	const DT		t_473 = t_360 - t_362;
+	const DT		t_474 = t_374 * 2;
+	const DT		t_475 = t_375 * 2;
+	const DT		t_476 = t_364 + t_382;
+	const DT		t_477 = t_365 - t_383;
+	const DT		t_478 = t_364 - t_382;
+	const DT		t_479 = t_365 + t_383;
+	const DT		t_480 = t_478 + t_479;
+	const DT		t_481 = t_480 * DT (0.70710678118654757274);
+	const DT		t_482 = t_479 - t_478;
+	const DT		t_483 = t_482 * DT (0.70710678118654757274);
+	const DT		t_484 = t_361 + t_363;
+	const DT		t_485 = t_361 - t_363;
+	const DT		t_486 = t_381 * 2;
+	const DT		t_487 = t_379 * 2;
+	const DT		t_488 = t_373 + t_391;
+	const DT		t_489 = t_370 - t_388;
+	const DT		t_490 = t_373 - t_391;
+	const DT		t_491 = t_370 + t_388;
+	const DT		t_492 = t_490 + t_491;
+	const DT		t_493 = t_492 * DT (0.70710678118654757274);
+	const DT		t_494 = t_491 - t_490;
+	const DT		t_495 = t_494 * DT (0.70710678118654757274);
+	const DT		t_496 = t_392 + t_394;
+	const DT		t_497 = t_392 - t_394;
+	const DT		t_498 = t_406 * 2;
+	const DT		t_499 = t_407 * 2;
+	const DT		t_500 = t_396 + t_414;
+	const DT		t_501 = t_397 - t_415;
+	const DT		t_502 = t_396 - t_414;
+	const DT		t_503 = t_397 + t_415;
+	const DT		t_504 = t_502 + t_503;
+	const DT		t_505 = t_504 * DT (0.70710678118654757274);
+	const DT		t_506 = t_503 - t_502;
+	const DT		t_507 = t_506 * DT (0.70710678118654757274);
+	const DT		t_508 = t_393 + t_395;
+	const DT		t_509 = t_393 - t_395;
+	const DT		t_510 = t_413 * 2;
+	const DT		t_511 = t_411 * 2;
+	const DT		t_512 = t_405 + t_423;
+	const DT		t_513 = t_402 - t_420;
+	const DT		t_514 = t_405 - t_423;
+	const DT		t_515 = t_402 + t_420;
+	const DT		t_516 = t_514 + t_515;
+	const DT		t_517 = t_516 * DT (0.70710678118654757274);
+	const DT		t_518 = t_515 - t_514;
+	const DT		t_519 = t_518 * DT (0.70710678118654757274);
+	const DT		t_520 = t_424 + t_426;
+	const DT		t_521 = t_424 - t_426;
+	const DT		t_522 = t_428 * 2;
+	const DT		t_523 = t_429 * 2;
+	const DT		t_524 = t_520 + t_522;
+	const DT		t_525 = t_520 - t_522;
+	const DT		t_526 = t_521 + t_523;
+	const DT		t_527 = t_521 - t_523;
+	const DT		t_528 = t_425 + t_427;
+	const DT		t_529 = t_425 - t_427;
+	const DT		t_530 = t_433 * 2;
+	const DT		t_531 = t_435 * 2;
+	const DT		t_532 = t_528 + t_530;
+	const DT		t_533 = t_528 - t_530;
+	const DT		t_534 = t_529 + t_531;
+	const DT		t_535 = t_529 - t_531;
+	const DT		t_536 = t_436 + t_438;
+	const DT		t_537 = t_436 - t_438;
+	const DT		t_538 = t_440 * 2;
+	const DT		t_539 = t_441 * 2;
+	const DT		t_540 = t_536 + t_538;
+	const DT		t_541 = t_536 - t_538;
+	const DT		t_542 = t_537 + t_539;
+	const DT		t_543 = t_537 - t_539;
+	const DT		t_544 = t_437 + t_439;
+	const DT		t_545 = t_437 - t_439;
+	const DT		t_546 = t_445 * 2;
+	const DT		t_547 = t_447 * 2;
+	const DT		t_548 = t_544 + t_546;
+	const DT		t_549 = t_544 - t_546;
+	const DT		t_550 = t_545 + t_547;
+	const DT		t_551 = t_545 - t_547;
+	const DT		t_552 = t_448 + t_450;
+	const DT		t_553 = t_448 - t_450;
+	const DT		t_554 = t_452 * 2;
+	const DT		t_555 = t_453 * 2;
+	const DT		t_556 = t_552 + t_554;
+	const DT		t_557 = t_552 - t_554;
+	const DT		t_558 = t_553 + t_555;
+	const DT		t_559 = t_553 - t_555;
+	const DT		t_560 = t_449 + t_451;
+	const DT		t_561 = t_449 - t_451;
+	const DT		t_562 = t_457 * 2;
+	const DT		t_563 = t_459 * 2;
+	const DT		t_564 = t_560 + t_562;
+	const DT		t_565 = t_560 - t_562;
+	const DT		t_566 = t_561 + t_563;
+	const DT		t_567 = t_561 - t_563;
+	const DT		t_568 = t_460 + t_462;
+	const DT		t_569 = t_460 - t_462;
+	const DT		t_570 = t_464 * 2;
+	const DT		t_571 = t_465 * 2;
+	const DT		t_572 = t_568 + t_570;
+	const DT		t_573 = t_568 - t_570;
+	const DT		t_574 = t_569 + t_571;
+	const DT		t_575 = t_569 - t_571;
+	const DT		t_576 = t_461 + t_463;
+	const DT		t_577 = t_461 - t_463;
+	const DT		t_578 = t_469 * 2;
+	const DT		t_579 = t_471 * 2;
+	const DT		t_580 = t_576 + t_578;
+	const DT		t_581 = t_576 - t_578;
+	const DT		t_582 = t_577 + t_579;
+	const DT		t_583 = t_577 - t_579;
+	const DT		t_584 = t_472 + t_474;
+	const DT		t_585 = t_472 - t_474;
+	const DT		t_586 = t_476 * 2;
+	const DT		t_587 = t_477 * 2;
+	const DT		t_588 = t_584 + t_586;
+	const DT		t_589 = t_584 - t_586;
+	const DT		t_590 = t_585 + t_587;
+	const DT		t_591 = t_585 - t_587;
+	const DT		t_592 = t_473 + t_475;
+	const DT		t_593 = t_473 - t_475;
+	const DT		t_594 = t_481 * 2;
+	const DT		t_595 = t_483 * 2;
+	const DT		t_596 = t_592 + t_594;
+	const DT		t_597 = t_592 - t_594;
+	const DT		t_598 = t_593 + t_595;
+	const DT		t_599 = t_593 - t_595;
+	const DT		t_600 = t_484 + t_486;
+	const DT		t_601 = t_484 - t_486;
+	const DT		t_602 = t_488 * 2;
+	const DT		t_603 = t_489 * 2;
+	const DT		t_604 = t_600 + t_602;
+	const DT		t_605 = t_600 - t_602;
+	const DT		t_606 = t_601 + t_603;
+	const DT		t_607 = t_601 - t_603;
+	const DT		t_608 = t_485 + t_487;
+	const DT		t_609 = t_485 - t_487;
+	const DT		t_610 = t_493 * 2;
+	const DT		t_611 = t_495 * 2;
+	const DT		t_612 = t_608 + t_610;
+	const DT		t_613 = t_608 - t_610;
+	const DT		t_614 = t_609 + t_611;
+	const DT		t_615 = t_609 - t_611;
+	const DT		t_616 = t_496 + t_498;
+	const DT		t_617 = t_496 - t_498;
+	const DT		t_618 = t_500 * 2;
+	const DT		t_619 = t_501 * 2;
+	const DT		t_620 = t_616 + t_618;
+	const DT		t_621 = t_616 - t_618;
+	const DT		t_622 = t_617 + t_619;
+	const DT		t_623 = t_617 - t_619;
+	const DT		t_624 = t_497 + t_499;
+	const DT		t_625 = t_497 - t_499;
+	const DT		t_626 = t_505 * 2;
+	const DT		t_627 = t_507 * 2;
+	const DT		t_628 = t_624 + t_626;
+	const DT		t_629 = t_624 - t_626;
+	const DT		t_630 = t_625 + t_627;
+	const DT		t_631 = t_625 - t_627;
+	const DT		t_632 = t_508 + t_510;
+	const DT		t_633 = t_508 - t_510;
+	const DT		t_634 = t_512 * 2;
+	const DT		t_635 = t_513 * 2;
+	const DT		t_636 = t_632 + t_634;
+	const DT		t_637 = t_632 - t_634;
+	const DT		t_638 = t_633 + t_635;
+	const DT		t_639 = t_633 - t_635;
+	const DT		t_640 = t_509 + t_511;
+	const DT		t_641 = t_509 - t_511;
+	const DT		t_642 = t_517 * 2;
+	const DT		t_643 = t_519 * 2;
+	const DT		t_644 = t_640 + t_642;
+	const DT		t_645 = t_640 - t_642;
+	const DT		t_646 = t_641 + t_643;
+	const DT		t_647 = t_641 - t_643;
+
+	x [0] = t_524;
+	x [1] = t_588;
+	x [2] = t_556;
+	x [3] = t_620;
+	x [4] = t_540;
+	x [5] = t_604;
+	x [6] = t_572;
+	x [7] = t_636;
+	x [8] = t_532;
+	x [9] = t_596;
+	x [10] = t_564;
+	x [11] = t_628;
+	x [12] = t_548;
+	x [13] = t_612;
+	x [14] = t_580;
+	x [15] = t_644;
+	x [16] = t_526;
+	x [17] = t_590;
+	x [18] = t_558;
+	x [19] = t_622;
+	x [20] = t_542;
+	x [21] = t_606;
+	x [22] = t_574;
+	x [23] = t_638;
+	x [24] = t_534;
+	x [25] = t_598;
+	x [26] = t_566;
+	x [27] = t_630;
+	x [28] = t_550;
+	x [29] = t_614;
+	x [30] = t_582;
+	x [31] = t_646;
+	x [32] = t_525;
+	x [33] = t_589;
+	x [34] = t_557;
+	x [35] = t_621;
+	x [36] = t_541;
+	x [37] = t_605;
+	x [38] = t_573;
+	x [39] = t_637;
+	x [40] = t_533;
+	x [41] = t_597;
+	x [42] = t_565;
+	x [43] = t_629;
+	x [44] = t_549;
+	x [45] = t_613;
+	x [46] = t_581;
+	x [47] = t_645;
+	x [48] = t_527;
+	x [49] = t_591;
+	x [50] = t_559;
+	x [51] = t_623;
+	x [52] = t_543;
+	x [53] = t_607;
+	x [54] = t_575;
+	x [55] = t_639;
+	x [56] = t_535;
+	x [57] = t_599;
+	x [58] = t_567;
+	x [59] = t_631;
+	x [60] = t_551;
+	x [61] = t_615;
+	x [62] = t_583;
+	x [63] = t_647;
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+#endif	// FFTRealCodelet_CODEHEADER_INCLUDED
+
+#undef FFTRealCodelet_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
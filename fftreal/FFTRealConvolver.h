@@ -0,0 +1,151 @@
+/*****************************************************************************
+
+        FFTRealConvolver.h
+
+Uniformly partitioned overlap-save convolution, for long FIR filters on a
+stream. The signal is processed by blocks of BLOCK_LEN samples, with a
+latency of one block. The impulse response is cut into partitions of
+BLOCK_LEN taps whose spectra (FFT length 2 * BLOCK_LEN) are computed once.
+For each block:
+
+	1. The FFT of the last two input blocks is stored in a frequency-domain
+		delay line, which keeps the spectra of the last nbr_parts frames,
+	2. The spectrum of the output is the sum of the products of each
+		partition spectrum with the frame of the same age,
+	3. Its IFFT gives the output block in its second half.
+
+Each block costs two FFTs of 2 * BLOCK_LEN points, whatever the filter
+length, plus one spectrum multiply-add per partition.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealConvolver_HEADER_INCLUDED)
+#define	FFTRealConvolver_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"DynArray.h"
+#include	"FFTRealFixLen.h"
+#include	"FFTRealFixLenParam.h"
+#include	"FFTRealSimd.h"
+
+// Same rule as FFTRealBatch: SSE2 registers only when the compiler may use
+// SSE2 everywhere.
+#if defined (FFTRealSimd_X86)
+	#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define	FFTRealConvolver_SSE2
+	#endif
+#endif
+
+
+
+template <int LL2>
+class FFTRealConvolver
+{
+	typedef	int	CompileTimeCheck1 [(LL2 >=  2) ? 1 : -1];
+	typedef	int	CompileTimeCheck2 [(LL2 <= 29) ? 1 : -1];
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	FFTRealFixLenParam::DataType	DataType;
+
+	enum {			BLOCK_LEN_L2	= LL2	};
+	enum {			BLOCK_LEN		= 1 << BLOCK_LEN_L2	};
+	enum {			FFT_LEN			= BLOCK_LEN * 2	};
+
+						FFTRealConvolver (const DataType h [], long len);
+	virtual			~FFTRealConvolver () {}
+
+	long				get_filter_len () const;
+	long				get_nbr_parts () const;
+
+	void				clear ();
+	void				process_block (DataType dst [], const DataType src []);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	static inline void
+						mul_add_spectrum (DataType dst [], const DataType x [], const DataType h []);
+	FORCEINLINE static void
+						mul_add_bin (DataType dst [], const DataType x [], const DataType h [], long i);
+
+	const long		_filter_len;
+	const long		_nbr_parts;
+	FFTRealFixLen <LL2 + 1>
+						_fft;
+	DynArray <DataType>
+						_filter_spec;	// Partition spectra, scaled by 1 / FFT_LEN
+	DynArray <DataType>
+						_fdl;				// Frequency-domain delay line, circular
+	long				_fdl_pos;		// Most recent frame
+	DynArray <DataType>
+						_in_buf;			// Previous block, then current block
+	DynArray <DataType>
+						_out_spec;
+	DynArray <DataType>
+						_out_buf;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealConvolver ();
+						FFTRealConvolver (const FFTRealConvolver &other);
+	FFTRealConvolver &
+						operator = (const FFTRealConvolver &other);
+	bool				operator == (const FFTRealConvolver &other);
+	bool				operator != (const FFTRealConvolver &other);
+
+};	// class FFTRealConvolver
+
+
+
+#include	"FFTRealConvolver.hpp"
+
+
+
+#endif	// FFTRealConvolver_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,279 @@
+/*****************************************************************************
+
+        FFTRealConvolver.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealConvolver_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealConvolver code header.
+#endif
+#define	FFTRealConvolver_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealConvolver_CODEHEADER_INCLUDED)
+#define	FFTRealConvolver_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<algorithm>
+#include	<cassert>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Description:
+	Computes the spectra of the filter partitions. The delay line starts
+	with null samples.
+Input parameters:
+	- h: impulse response of the filter.
+	- len: number of taps. Range: > 0.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <int LL2>
+FFTRealConvolver <LL2>::FFTRealConvolver (const DataType h [], long len)
+:	_filter_len (len)
+,	_nbr_parts ((len + BLOCK_LEN - 1) >> BLOCK_LEN_L2)
+,	_fft ()
+,	_filter_spec (_nbr_parts * FFT_LEN)
+,	_fdl (_nbr_parts * FFT_LEN)
+,	_fdl_pos (0)
+,	_in_buf (FFT_LEN)
+,	_out_spec (FFT_LEN)
+,	_out_buf (FFT_LEN)
+{
+	assert (h != 0);
+	assert (len > 0);
+
+	const DataType	mul = DataType (1) / DataType (FFT_LEN);
+
+	for (long part = 0; part < _nbr_parts; ++part)
+	{
+		const long		beg = part * BLOCK_LEN;
+		const long		nbr_taps = std::min (len - beg, long (BLOCK_LEN));
+		for (long pos = 0; pos < FFT_LEN; ++pos)
+		{
+			_in_buf [pos] = (pos < nbr_taps) ? h [beg + pos] : DataType (0);
+		}
+
+		DataType * const	spec_ptr = &_filter_spec [part * FFT_LEN];
+		_fft.do_fft (spec_ptr, &_in_buf [0]);
+		for (long pos = 0; pos < FFT_LEN; ++pos)
+		{
+			spec_ptr [pos] *= mul;
+		}
+	}
+
+	clear ();
+}
+
+
+
+template <int LL2>
+long	FFTRealConvolver <LL2>::get_filter_len () const
+{
+	return (_filter_len);
+}
+
+
+
+/*
+==============================================================================
+Name: get_nbr_parts
+Description:
+	Returns the number of filter partitions, which sets the cost of the
+	multiply-add step.
+Returns: ceil (get_filter_len () / BLOCK_LEN)
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2>
+long	FFTRealConvolver <LL2>::get_nbr_parts () const
+{
+	return (_nbr_parts);
+}
+
+
+
+/*
+==============================================================================
+Name: clear
+Description:
+	Fills the delay line with null samples.
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2>
+void	FFTRealConvolver <LL2>::clear ()
+{
+	const long		fdl_len = _nbr_parts * FFT_LEN;
+	for (long pos = 0; pos < fdl_len; ++pos)
+	{
+		_fdl [pos] = 0;
+	}
+	for (long pos = 0; pos < FFT_LEN; ++pos)
+	{
+		_in_buf [pos] = 0;
+	}
+	_fdl_pos = 0;
+}
+
+
+
+/*
+==============================================================================
+Name: process_block
+Description:
+	Filters the next block of the stream. Output sample n of the stream is
+	sum (h [k] * x [n - k], k = 0 ... get_filter_len () - 1).
+Input parameters:
+	- src: next BLOCK_LEN input samples.
+Output parameters:
+	- dst: next BLOCK_LEN output samples. Can be src.
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2>
+void	FFTRealConvolver <LL2>::process_block (DataType dst [], const DataType src [])
+{
+	assert (dst != 0);
+	assert (src != 0);
+
+	// Previous block to the first half, new block to the second half
+	for (long pos = 0; pos < BLOCK_LEN; ++pos)
+	{
+		_in_buf [pos] = _in_buf [BLOCK_LEN + pos];
+		_in_buf [BLOCK_LEN + pos] = src [pos];
+	}
+
+	_fdl_pos = (_fdl_pos == 0) ? _nbr_parts - 1 : _fdl_pos - 1;
+	_fft.do_fft (&_fdl [_fdl_pos * FFT_LEN], &_in_buf [0]);
+
+	// Partition part goes with the frame part blocks old, at
+	// (_fdl_pos + part) % _nbr_parts.
+	for (long pos = 0; pos < FFT_LEN; ++pos)
+	{
+		_out_spec [pos] = 0;
+	}
+	for (long part = 0; part < _nbr_parts; ++part)
+	{
+		long				slot = _fdl_pos + part;
+		if (slot >= _nbr_parts)
+		{
+			slot -= _nbr_parts;
+		}
+		mul_add_spectrum (
+			&_out_spec [0],
+			&_fdl [slot * FFT_LEN],
+			&_filter_spec [part * FFT_LEN]
+		);
+	}
+
+	// The first half is the circular alias, only the second one is kept
+	_fft.do_ifft (&_out_spec [0], &_out_buf [0]);
+	for (long pos = 0; pos < BLOCK_LEN; ++pos)
+	{
+		dst [pos] = _out_buf [BLOCK_LEN + pos];
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// dst += x * h, complex products in the half-complex layout. FFTReal stores
+// the opposite of the imaginary parts, which gives the same formulas on the
+// stored values.
+template <int LL2>
+void	FFTRealConvolver <LL2>::mul_add_spectrum (DataType dst [], const DataType x [], const DataType h [])
+{
+	// Bin 0 and BLOCK_LEN are real
+	dst [0] += x [0] * h [0];
+	dst [BLOCK_LEN] += x [BLOCK_LEN] * h [BLOCK_LEN];
+
+	long				i = 1;
+
+#if defined (FFTRealConvolver_SSE2)
+	for ( ; i < 4; ++i)
+	{
+		mul_add_bin (dst, x, h, i);
+	}
+	for ( ; i < BLOCK_LEN; i += 4)
+	{
+		const __m128	x_re = _mm_loadu_ps (x + i);
+		const __m128	x_im = _mm_loadu_ps (x + BLOCK_LEN + i);
+		const __m128	h_re = _mm_loadu_ps (h + i);
+		const __m128	h_im = _mm_loadu_ps (h + BLOCK_LEN + i);
+		const __m128	y_re = _mm_sub_ps (_mm_mul_ps (x_re, h_re), _mm_mul_ps (x_im, h_im));
+		const __m128	y_im = _mm_add_ps (_mm_mul_ps (x_re, h_im), _mm_mul_ps (x_im, h_re));
+		_mm_storeu_ps (dst + i, _mm_add_ps (_mm_loadu_ps (dst + i), y_re));
+		_mm_storeu_ps (
+			dst + BLOCK_LEN + i,
+			_mm_add_ps (_mm_loadu_ps (dst + BLOCK_LEN + i), y_im)
+		);
+	}
+#endif	// FFTRealConvolver_SSE2
+
+	for ( ; i < BLOCK_LEN; ++i)
+	{
+		mul_add_bin (dst, x, h, i);
+	}
+}
+
+
+
+template <int LL2>
+void	FFTRealConvolver <LL2>::mul_add_bin (DataType dst [], const DataType x [], const DataType h [], long i)
+{
+	const DataType	x_re = x [i];
+	const DataType	x_im = x [BLOCK_LEN + i];
+	const DataType	h_re = h [i];
+	const DataType	h_im = h [BLOCK_LEN + i];
+	dst [i]             += x_re * h_re - x_im * h_im;
+	dst [BLOCK_LEN + i] += x_re * h_im + x_im * h_re;
+}
+
+
+
+#endif	// FFTRealConvolver_CODEHEADER_INCLUDED
+
+#undef FFTRealConvolver_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,89 @@
+/*****************************************************************************
+
+        FFTRealCorrelation.h
+
+Spectrum products for the correlations computed with FFTReal. Both
+functions work on the half-complex layout of FFTReal and fold the 1/length
+scaling of the inverse FFT, so a correlation costs two or three FFTs and a
+single pass over the spectra:
+
+	autocorrelation:    r = IFFT (|X|^2 / length)
+	cross-correlation:  c = IFFT (X * conj (Y) / length)
+
+The result is circular. To get the linear correlation of count samples for
+all the lags, pad them with zeros to a length >= 2 * count - 1.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealCorrelation_HEADER_INCLUDED)
+#define	FFTRealCorrelation_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+
+
+
+class FFTRealCorrelation
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	template <class DT>
+	static void		mul_power (long len, DT dst [], const DT f []);
+	template <class DT>
+	static void		mul_conj (long len, DT dst [], const DT f [], const DT g []);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealCorrelation ();
+						~FFTRealCorrelation ();
+						FFTRealCorrelation (const FFTRealCorrelation &other);
+	FFTRealCorrelation &
+						operator = (const FFTRealCorrelation &other);
+	bool				operator == (const FFTRealCorrelation &other);
+	bool				operator != (const FFTRealCorrelation &other);
+
+};	// class FFTRealCorrelation
+
+
+
+#include	"FFTRealCorrelation.hpp"
+
+
+
+#endif	// FFTRealCorrelation_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
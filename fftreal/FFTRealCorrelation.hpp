@@ -0,0 +1,147 @@
+/*****************************************************************************
+
+        FFTRealCorrelation.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealCorrelation_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealCorrelation code header.
+#endif
+#define	FFTRealCorrelation_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealCorrelation_CODEHEADER_INCLUDED)
+#define	FFTRealCorrelation_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: mul_power
+Description:
+	Computes |F|^2 / len, the spectrum of the circular autocorrelation. Its
+	imaginary parts are null.
+Input parameters:
+	- len: FFT length. Range: > 0.
+	- f: spectrum, half-complex layout of FFTReal.
+Output parameters:
+	- dst: result, same layout. Can be f.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealCorrelation::mul_power (long len, DT dst [], const DT f [])
+{
+	assert (len > 0);
+	assert (dst != 0);
+	assert (f != 0);
+
+	const DT			mul = DT (1) / DT (len);
+	const long		half = len >> 1;
+
+	dst [0] = f [0] * f [0] * mul;
+	for (long i = 1; i < (len + 1) >> 1; ++i)
+	{
+		const DT			re = f [i];
+		const DT			im = f [half + i];
+		dst [i] = (re * re + im * im) * mul;
+		dst [half + i] = 0;
+	}
+	if ((len & 1) == 0)
+	{
+		dst [half] = f [half] * f [half] * mul;
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: mul_conj
+Description:
+	Computes F * conj (G) / len, the spectrum of the circular
+	cross-correlation c [k] = sum (x [n + k] * y [n]) where F = FFT (x) and
+	G = FFT (y). As FFTReal stores the opposite of the imaginary parts, the
+	product is done on the stored values directly.
+Input parameters:
+	- len: FFT length. Range: > 0.
+	- f: first spectrum, half-complex layout of FFTReal.
+	- g: second spectrum, same layout.
+Output parameters:
+	- dst: result, same layout. Can be f or g.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealCorrelation::mul_conj (long len, DT dst [], const DT f [], const DT g [])
+{
+	assert (len > 0);
+	assert (dst != 0);
+	assert (f != 0);
+	assert (g != 0);
+
+	const DT			mul = DT (1) / DT (len);
+	const long		half = len >> 1;
+
+	dst [0] = f [0] * g [0] * mul;
+	for (long i = 1; i < (len + 1) >> 1; ++i)
+	{
+		const DT			f_re = f [i];
+		const DT			f_im = f [half + i];
+		const DT			g_re = g [i];
+		const DT			g_im = g [half + i];
+		dst [i]        = (f_re * g_re + f_im * g_im) * mul;
+		dst [half + i] = (f_im * g_re - f_re * g_im) * mul;
+	}
+	if ((len & 1) == 0)
+	{
+		dst [half] = f [half] * g [half] * mul;
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+#endif	// FFTRealCorrelation_CODEHEADER_INCLUDED
+
+#undef FFTRealCorrelation_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,116 @@
+/*****************************************************************************
+
+        FFTRealDct.h
+
+DCT-II, DCT-IV and MDCT for a length chosen at run-time, on top of FFTReal.
+See FFTRealDctCore for the definitions and the algorithms.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealDct_HEADER_INCLUDED)
+#define	FFTRealDct_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"DynArray.h"
+#include	"FFTRealDctCore.h"
+#include	"FFTReal.h"
+#include	"FFTRealTable.h"
+
+
+
+template <class DT>
+class FFTRealDct
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+
+	explicit			FFTRealDct (long length);
+	virtual			~FFTRealDct () {}
+
+	long				get_length () const;
+	void				do_dct2 (DataType f [], const DataType x []);
+	void				do_dct4 (DataType f [], const DataType x []);
+	void				do_mdct (DataType f [], const DataType x []);
+	void				do_imdct (DataType x [], const DataType f []);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	static void		build_table (DataType table_ptr [], long size, long param);
+
+	const long		_length;
+	FFTReal <DataType>
+						_fft;
+	FFTRealTable <DataType>
+						_table;
+	DynArray <DataType>
+						_buffer_1;
+	DynArray <DataType>
+						_buffer_2;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealDct ();
+						FFTRealDct (const FFTRealDct &other);
+	FFTRealDct &
+						operator = (const FFTRealDct &other);
+	bool				operator == (const FFTRealDct &other);
+	bool				operator != (const FFTRealDct &other);
+
+};	// class FFTRealDct
+
+
+
+#include	"FFTRealDct.hpp"
+
+
+
+#endif	// FFTRealDct_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
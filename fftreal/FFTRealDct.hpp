@@ -0,0 +1,196 @@
+/*****************************************************************************
+
+        FFTRealDct.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealDct_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealDct code header.
+#endif
+#define	FFTRealDct_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealDct_CODEHEADER_INCLUDED)
+#define	FFTRealDct_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- length: length N of the DCTs, number of MDCT coefficients. Range:
+		power of 2, >= FFTRealDctCore::MIN_LENGTH.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+FFTRealDct <DT>::FFTRealDct (long length)
+:	_length (length)
+,	_fft (length)
+,	_table (&build_table, FFTRealDctCore::get_table_len (length), length)
+,	_buffer_1 (length)
+,	_buffer_2 (length)
+{
+	assert (length >= FFTRealDctCore::MIN_LENGTH);
+	assert ((length & -length) == length);
+}
+
+
+
+template <class DT>
+long	FFTRealDct <DT>::get_length () const
+{
+	return (_length);
+}
+
+
+
+/*
+==============================================================================
+Name: do_dct2
+Description:
+	Computes the DCT-II of get_length () samples, without normalisation.
+Input parameters:
+	- x: source, get_length () samples.
+Output parameters:
+	- f: get_length () coefficients. Must be different from x.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealDct <DT>::do_dct2 (DataType f [], const DataType x [])
+{
+	FFTRealDctCore::dct2 (
+		_fft, f, x, &_buffer_1 [0], &_table [0], _length
+	);
+}
+
+
+
+/*
+==============================================================================
+Name: do_dct4
+Description:
+	Computes the DCT-IV of get_length () samples, without normalisation.
+	Applying it twice gives the source multiplied by get_length () / 2.
+Input parameters:
+	- x: source, get_length () samples.
+Output parameters:
+	- f: get_length () coefficients. Can be x.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealDct <DT>::do_dct4 (DataType f [], const DataType x [])
+{
+	FFTRealDctCore::dct4 (
+		_fft, f, x, &_buffer_1 [0], &_buffer_2 [0], &_table [0], _length
+	);
+}
+
+
+
+/*
+==============================================================================
+Name: do_mdct
+Description:
+	Computes the MDCT of 2 * get_length () samples. The window, if any,
+	must be applied beforehand.
+Input parameters:
+	- x: source, 2 * get_length () samples.
+Output parameters:
+	- f: get_length () coefficients. Must be different from x.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealDct <DT>::do_mdct (DataType f [], const DataType x [])
+{
+	FFTRealDctCore::mdct (
+		_fft, f, x, &_buffer_1 [0], &_buffer_2 [0], &_table [0], _length
+	);
+}
+
+
+
+/*
+==============================================================================
+Name: do_imdct
+Description:
+	Computes the inverse MDCT of get_length () coefficients, without
+	scaling nor window. See FFTRealDctCore::imdct () for the reconstruction.
+Input parameters:
+	- f: get_length () coefficients.
+Output parameters:
+	- x: 2 * get_length () samples. Must be different from f.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealDct <DT>::do_imdct (DataType x [], const DataType f [])
+{
+	FFTRealDctCore::imdct (
+		_fft, x, f, &_buffer_1 [0], &_buffer_2 [0], &_table [0], _length
+	);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+void	FFTRealDct <DT>::build_table (DataType table_ptr [], long size, long param)
+{
+	assert (size == FFTRealDctCore::get_table_len (param));
+
+	FFTRealDctCore::build_table (table_ptr, param);
+}
+
+
+
+#endif	// FFTRealDct_CODEHEADER_INCLUDED
+
+#undef FFTRealDct_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,141 @@
+/*****************************************************************************
+
+        FFTRealDctCore.h
+
+DCT-II, DCT-IV and MDCT computed with a real FFT of the same length N,
+shared by FFTRealDct and FFTRealDctFixLen. Transforms are not normalised:
+
+	DCT-II: X [k] = sum (x [n] * cos (PI / N * (n + 1/2) * k))
+	DCT-IV: X [k] = sum (x [n] * cos (PI / N * (n + 1/2) * (k + 1/2)))
+	MDCT:   X [k] = sum (x [n] * cos (PI / N * (n + 1/2 + N/2) * (k + 1/2)))
+
+with n in [0 ; N[ for the DCTs and [0 ; 2N[ for the MDCT.
+
+DCT-II follows Makhoul: the even samples then the odd ones in reverse
+order go through the FFT, and each pair of bins k and N - k is rotated by
+PI * k / (2N).
+
+DCT-IV needs a complex FFT of length N/2 of
+
+	t [n] = (x [2n] + j * x [N-1-2n]) * exp (-j * PI * (4n+1) / (4N))
+
+Feeding the real and imaginary parts of t as the even and odd samples of
+the real FFT gives E [k] + exp (-j*2*PI*k/N) * O [k] where E and O are the
+FFTs of the real and imaginary parts; the post-processing separates them
+before the final rotation by PI * k / N.
+
+MDCT folds the 2N samples into N and calls DCT-IV; the inverse MDCT unfolds
+the result of DCT-IV.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealDctCore_HEADER_INCLUDED)
+#define	FFTRealDctCore_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+
+
+
+class FFTRealDctCore
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	enum {			MIN_LENGTH		= 4	};
+
+	static inline long
+						get_table_len (long len);
+	template <class DT>
+	static void		build_table (DT table [], long len);
+
+	template <class DT, class FT>
+	static void		dct2 (FT &fft, DT f [], const DT x [], DT buf [], const DT table [], long len);
+	template <class DT, class FT>
+	static void		dct4 (FT &fft, DT f [], const DT x [], DT buf_1 [], DT buf_2 [], const DT table [], long len);
+	template <class DT, class FT>
+	static void		mdct (FT &fft, DT f [], const DT x [], DT buf_1 [], DT buf_2 [], const DT table [], long len);
+	template <class DT, class FT>
+	static void		imdct (FT &fft, DT x [], const DT f [], DT buf_1 [], DT buf_2 [], const DT table [], long len);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	// Each table is made of half_len cosines followed by half_len sines
+	enum Table
+	{
+		Table_DCT2 = 0,	// PI * k / (2N)
+		Table_PRE,			// PI * (4n+1) / (4N)
+		Table_SPLIT,		// 2 * PI * k / N
+		Table_POST,			// PI * k / N
+
+		Table_NBR_ELT
+	};
+
+	template <class DT>
+	FORCEINLINE static void
+						rotate_dct2 (DT f [], DT re, DT im_neg, DT c, DT s, long k, long len);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealDctCore ();
+						~FFTRealDctCore ();
+						FFTRealDctCore (const FFTRealDctCore &other);
+	FFTRealDctCore &
+						operator = (const FFTRealDctCore &other);
+	bool				operator == (const FFTRealDctCore &other);
+	bool				operator != (const FFTRealDctCore &other);
+
+};	// class FFTRealDctCore
+
+
+
+#include	"FFTRealDctCore.hpp"
+
+
+
+#endif	// FFTRealDctCore_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,360 @@
+/*****************************************************************************
+
+        FFTRealDctCore.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealDctCore_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealDctCore code header.
+#endif
+#define	FFTRealDctCore_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealDctCore_CODEHEADER_INCLUDED)
+#define	FFTRealDctCore_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: get_table_len
+Input parameters:
+	- len: transform length N. Range: power of 2, >= MIN_LENGTH.
+Returns: The number of elements of the table built by build_table ().
+Throws: Nothing
+==============================================================================
+*/
+
+long	FFTRealDctCore::get_table_len (long len)
+{
+	assert (len >= MIN_LENGTH);
+
+	return (Table_NBR_ELT * len);
+}
+
+
+
+template <class DT>
+void	FFTRealDctCore::build_table (DT table [], long len)
+{
+	assert (table != 0);
+	assert (len >= MIN_LENGTH);
+
+	using namespace std;
+
+	const long		half_len = len >> 1;
+	const double	mul [Table_NBR_ELT] =
+	{
+		PI / (2 * len),
+		PI / (4 * len),
+		2 * PI / len,
+		PI / len
+	};
+
+	for (int t = 0; t < Table_NBR_ELT; ++t)
+	{
+		DT * const		cos_ptr = table + t * len;
+		DT * const		sin_ptr = cos_ptr + half_len;
+		for (long k = 0; k < half_len; ++k)
+		{
+			const long		index = (t == Table_PRE) ? 4 * k + 1 : k;
+			const double	angle = mul [t] * index;
+			cos_ptr [k] = static_cast <DT> (cos (angle));
+			sin_ptr [k] = static_cast <DT> (sin (angle));
+		}
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: dct2
+Description:
+	DCT-II, see the header. fft must be a forward real FFT of length len.
+Input parameters:
+	- x: source, len samples.
+	- table: built by build_table ().
+	- len: transform length N. Range: power of 2, >= MIN_LENGTH.
+Output parameters:
+	- f: len coefficients. Must be different from x.
+Input/output parameters:
+	- fft: FFT object of length len.
+	- buf: scratch array, len elements.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT, class FT>
+void	FFTRealDctCore::dct2 (FT &fft, DT f [], const DT x [], DT buf [], const DT table [], long len)
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (f != x);
+	assert (buf != 0);
+	assert (table != 0);
+	assert (len >= MIN_LENGTH);
+
+	const long		half_len = len >> 1;
+
+	for (long n = 0; n < half_len; ++n)
+	{
+		buf [n] = x [2 * n];
+		buf [len - 1 - n] = x [2 * n + 1];
+	}
+
+	fft.do_fft (f, buf);
+
+	// X [k] = Re (V [k] * exp (-j * PI * k / (2N))), with V [N - k] =
+	// conj (V [k]). f holds the opposite of the imaginary parts. Bins k and
+	// N/2 - k are done together, as they read and write the same locations.
+	const DT * const	cos_ptr = table + Table_DCT2 * len;
+	const DT * const	sin_ptr = cos_ptr + half_len;
+	f [half_len] *= static_cast <DT> (SQRT2 * 0.5);
+	for (long k = 1; k <= (half_len >> 1); ++k)
+	{
+		const long		k_2 = half_len - k;
+		const DT			re_1 = f [k];
+		const DT			im_neg_1 = f [half_len + k];
+		const DT			re_2 = f [k_2];
+		const DT			im_neg_2 = f [half_len + k_2];
+
+		rotate_dct2 (f, re_1, im_neg_1, cos_ptr [k], sin_ptr [k], k, len);
+		if (k_2 != k)
+		{
+			rotate_dct2 (f, re_2, im_neg_2, cos_ptr [k_2], sin_ptr [k_2], k_2, len);
+		}
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: dct4
+Description:
+	DCT-IV, see the header. fft must be a forward real FFT of length len.
+Input parameters:
+	- x: source, len samples.
+	- table: built by build_table ().
+	- len: transform length N. Range: power of 2, >= MIN_LENGTH.
+Output parameters:
+	- f: len coefficients. Can be x.
+Input/output parameters:
+	- fft: FFT object of length len.
+	- buf_1, buf_2: scratch arrays, len elements each.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT, class FT>
+void	FFTRealDctCore::dct4 (FT &fft, DT f [], const DT x [], DT buf_1 [], DT buf_2 [], const DT table [], long len)
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (buf_1 != 0);
+	assert (buf_2 != 0);
+	assert (table != 0);
+	assert (len >= MIN_LENGTH);
+
+	const long		half_len = len >> 1;
+
+	// Pre-rotation. Real parts to even samples, imaginary parts to odd ones.
+	{
+		const DT * const	cos_ptr = table + Table_PRE * len;
+		const DT * const	sin_ptr = cos_ptr + half_len;
+		for (long n = 0; n < half_len; ++n)
+		{
+			const DT			a = x [2 * n];
+			const DT			b = x [len - 1 - 2 * n];
+			const DT			c = cos_ptr [n];
+			const DT			s = sin_ptr [n];
+			buf_1 [2 * n]     = a * c + b * s;
+			buf_1 [2 * n + 1] = b * c - a * s;
+		}
+	}
+
+	fft.do_fft (buf_2, buf_1);
+
+	// For k in [0 ; N/2[, with Y [k + N/2] = conj (Y [N/2 - k]):
+	// E = (Y [k] + Y [k + N/2]) / 2
+	// O = (Y [k] - Y [k + N/2]) / 2 * exp (j * 2 * PI * k / N)
+	// u = (E + j * O) * exp (-j * PI * k / N)
+	const DT * const	sp_cos_ptr = table + Table_SPLIT * len;
+	const DT * const	sp_sin_ptr = sp_cos_ptr + half_len;
+	const DT * const	po_cos_ptr = table + Table_POST * len;
+	const DT * const	po_sin_ptr = po_cos_ptr + half_len;
+	const DT				half = static_cast <DT> (0.5);
+	for (long k = 0; k < half_len; ++k)
+	{
+		const long		k_2 = half_len - k;
+		const DT			p_re = buf_2 [k];
+		const DT			p_im = (k == 0) ? DT (0) : -buf_2 [half_len + k];
+		const DT			q_re = buf_2 [k_2];
+		const DT			q_im = (k == 0) ? DT (0) : buf_2 [half_len + k_2];
+
+		const DT			e_re = (p_re + q_re) * half;
+		const DT			e_im = (p_im + q_im) * half;
+		const DT			d_re = (p_re - q_re) * half;
+		const DT			d_im = (p_im - q_im) * half;
+		const DT			sc = sp_cos_ptr [k];
+		const DT			ss = sp_sin_ptr [k];
+		const DT			o_re = d_re * sc - d_im * ss;
+		const DT			o_im = d_re * ss + d_im * sc;
+
+		const DT			t_re = e_re - o_im;
+		const DT			t_im = e_im + o_re;
+		const DT			pc = po_cos_ptr [k];
+		const DT			ps = po_sin_ptr [k];
+		f [2 * k]           =   t_re * pc + t_im * ps;
+		f [len - 1 - 2 * k] = -(t_im * pc - t_re * ps);
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: mdct
+Description:
+	MDCT, see the header. No window is applied.
+Input parameters:
+	- x: source, 2 * len samples.
+	- table: built by build_table ().
+	- len: number of coefficients N. Range: power of 2, >= MIN_LENGTH.
+Output parameters:
+	- f: len coefficients. Must be different from x.
+Input/output parameters:
+	- fft: FFT object of length len.
+	- buf_1, buf_2: scratch arrays, len elements each.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT, class FT>
+void	FFTRealDctCore::mdct (FT &fft, DT f [], const DT x [], DT buf_1 [], DT buf_2 [], const DT table [], long len)
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (f != x);
+
+	// With x = (a, b, c, d), quarters of N/2 samples and r for reversal:
+	// u = (-c_r - d, a - b_r)
+	const long		half_len = len >> 1;
+	const DT * const	a = x;
+	const DT * const	b = x + half_len;
+	const DT * const	c = x + len;
+	const DT * const	d = x + len + half_len;
+	for (long n = 0; n < half_len; ++n)
+	{
+		f [n]            = -c [half_len - 1 - n] - d [n];
+		f [half_len + n] =  a [n] - b [half_len - 1 - n];
+	}
+
+	dct4 (fft, f, f, buf_1, buf_2, table, len);
+}
+
+
+
+/*
+==============================================================================
+Name: imdct
+Description:
+	Inverse MDCT, without scaling nor window:
+	x [n] = sum (f [k] * cos (PI / N * (n + 1/2 + N/2) * (k + 1/2)))
+	Overlap-adding the windowed outputs of successive frames (hop N) with a
+	Princen-Bradley window rebuilds the signal multiplied by N/2.
+Input parameters:
+	- f: len coefficients.
+	- table: built by build_table ().
+	- len: number of coefficients N. Range: power of 2, >= MIN_LENGTH.
+Output parameters:
+	- x: 2 * len samples. Must be different from f.
+Input/output parameters:
+	- fft: FFT object of length len.
+	- buf_1, buf_2: scratch arrays, len elements each.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT, class FT>
+void	FFTRealDctCore::imdct (FT &fft, DT x [], const DT f [], DT buf_1 [], DT buf_2 [], const DT table [], long len)
+{
+	assert (x != 0);
+	assert (f != 0);
+	assert (x != f);
+
+	dct4 (fft, x, f, buf_1, buf_2, table, len);
+
+	// With w = DCT-IV (f) = (w_1, w_2), halves of N/2 samples:
+	// x = (w_2, -w_r, -w_1)
+	const long		half_len = len >> 1;
+	for (long n = 0; n < len; ++n)
+	{
+		buf_1 [n] = x [n];
+	}
+	for (long n = 0; n < half_len; ++n)
+	{
+		x [n] = buf_1 [half_len + n];
+		x [len + half_len + n] = -buf_1 [n];
+	}
+	for (long n = 0; n < len; ++n)
+	{
+		x [half_len + n] = -buf_1 [len - 1 - n];
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+void	FFTRealDctCore::rotate_dct2 (DT f [], DT re, DT im_neg, DT c, DT s, long k, long len)
+{
+	f [k]       = re * c - im_neg * s;
+	f [len - k] = re * s + im_neg * c;
+}
+
+
+
+#endif	// FFTRealDctCore_CODEHEADER_INCLUDED
+
+#undef FFTRealDctCore_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,120 @@
+/*****************************************************************************
+
+        FFTRealDctFixLen.h
+
+DCT-II, DCT-IV and MDCT for a length fixed at compile-time, on top of
+FFTRealFixLen. See FFTRealDctCore for the definitions and the algorithms.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealDctFixLen_HEADER_INCLUDED)
+#define	FFTRealDctFixLen_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"DynArray.h"
+#include	"FFTRealDctCore.h"
+#include	"FFTRealFixLen.h"
+#include	"FFTRealFixLenParam.h"
+#include	"FFTRealTable.h"
+
+
+
+template <int LL2>
+class FFTRealDctFixLen
+{
+	typedef	int	CompileTimeCheck1 [(LL2 >=  2) ? 1 : -1];
+	typedef	int	CompileTimeCheck2 [(LL2 <= 30) ? 1 : -1];
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	FFTRealFixLenParam::DataType	DataType;
+
+	enum {			FFT_LEN_L2	= LL2	};
+	enum {			FFT_LEN		= 1 << FFT_LEN_L2	};
+
+						FFTRealDctFixLen ();
+	virtual			~FFTRealDctFixLen () {}
+
+	long				get_length () const;
+	void				do_dct2 (DataType f [], const DataType x []);
+	void				do_dct4 (DataType f [], const DataType x []);
+	void				do_mdct (DataType f [], const DataType x []);
+	void				do_imdct (DataType x [], const DataType f []);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	static void		build_table (DataType table_ptr [], long size, long param);
+
+	FFTRealFixLen <LL2>
+						_fft;
+	FFTRealTable <DataType>
+						_table;
+	DynArray <DataType>
+						_buffer_1;
+	DynArray <DataType>
+						_buffer_2;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealDctFixLen (const FFTRealDctFixLen &other);
+	FFTRealDctFixLen &
+						operator = (const FFTRealDctFixLen &other);
+	bool				operator == (const FFTRealDctFixLen &other);
+	bool				operator != (const FFTRealDctFixLen &other);
+
+};	// class FFTRealDctFixLen
+
+
+
+#include	"FFTRealDctFixLen.hpp"
+
+
+
+#endif	// FFTRealDctFixLen_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
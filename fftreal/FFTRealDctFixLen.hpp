@@ -0,0 +1,184 @@
+/*****************************************************************************
+
+        FFTRealDctFixLen.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealDctFixLen_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealDctFixLen code header.
+#endif
+#define	FFTRealDctFixLen_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealDctFixLen_CODEHEADER_INCLUDED)
+#define	FFTRealDctFixLen_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <int LL2>
+FFTRealDctFixLen <LL2>::FFTRealDctFixLen ()
+:	_fft ()
+,	_table (&build_table, FFTRealDctCore::get_table_len (FFT_LEN), FFT_LEN)
+,	_buffer_1 (FFT_LEN)
+,	_buffer_2 (FFT_LEN)
+{
+	// Nothing
+}
+
+
+
+template <int LL2>
+long	FFTRealDctFixLen <LL2>::get_length () const
+{
+	return (FFT_LEN);
+}
+
+
+
+/*
+==============================================================================
+Name: do_dct2
+Description:
+	Computes the DCT-II of get_length () samples, without normalisation.
+Input parameters:
+	- x: source, get_length () samples.
+Output parameters:
+	- f: get_length () coefficients. Must be different from x.
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2>
+void	FFTRealDctFixLen <LL2>::do_dct2 (DataType f [], const DataType x [])
+{
+	FFTRealDctCore::dct2 (
+		_fft, f, x, &_buffer_1 [0], &_table [0], FFT_LEN
+	);
+}
+
+
+
+/*
+==============================================================================
+Name: do_dct4
+Description:
+	Computes the DCT-IV of get_length () samples, without normalisation.
+	Applying it twice gives the source multiplied by get_length () / 2.
+Input parameters:
+	- x: source, get_length () samples.
+Output parameters:
+	- f: get_length () coefficients. Can be x.
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2>
+void	FFTRealDctFixLen <LL2>::do_dct4 (DataType f [], const DataType x [])
+{
+	FFTRealDctCore::dct4 (
+		_fft, f, x, &_buffer_1 [0], &_buffer_2 [0], &_table [0], FFT_LEN
+	);
+}
+
+
+
+/*
+==============================================================================
+Name: do_mdct
+Description:
+	Computes the MDCT of 2 * get_length () samples. The window, if any,
+	must be applied beforehand.
+Input parameters:
+	- x: source, 2 * get_length () samples.
+Output parameters:
+	- f: get_length () coefficients. Must be different from x.
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2>
+void	FFTRealDctFixLen <LL2>::do_mdct (DataType f [], const DataType x [])
+{
+	FFTRealDctCore::mdct (
+		_fft, f, x, &_buffer_1 [0], &_buffer_2 [0], &_table [0], FFT_LEN
+	);
+}
+
+
+
+/*
+==============================================================================
+Name: do_imdct
+Description:
+	Computes the inverse MDCT of get_length () coefficients, without
+	scaling nor window. See FFTRealDctCore::imdct () for the reconstruction.
+Input parameters:
+	- f: get_length () coefficients.
+Output parameters:
+	- x: 2 * get_length () samples. Must be different from f.
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2>
+void	FFTRealDctFixLen <LL2>::do_imdct (DataType x [], const DataType f [])
+{
+	FFTRealDctCore::imdct (
+		_fft, x, f, &_buffer_1 [0], &_buffer_2 [0], &_table [0], FFT_LEN
+	);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <int LL2>
+void	FFTRealDctFixLen <LL2>::build_table (DataType table_ptr [], long size, long param)
+{
+	assert (size == FFTRealDctCore::get_table_len (param));
+
+	FFTRealDctCore::build_table (table_ptr, param);
+}
+
+
+
+#endif	// FFTRealDctFixLen_CODEHEADER_INCLUDED
+
+#undef FFTRealDctFixLen_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
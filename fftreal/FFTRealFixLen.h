@@ -38,6 +38,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #include	"Array.h"
 #include	"DynArray.h"
 #include	"FFTRealFixLenParam.h"
+#include	"FFTRealPcm16Reader.h"
+#include	"FFTRealTable.h"
 #include	"OscSinCos.h"
 
 
@@ -63,8 +65,19 @@ public:
 	inline long		get_length () const;
 	void				do_fft (DataType f [], const DataType x []);
 	void				do_ifft (const DataType f [], DataType x []);
+	void				do_power_spectrum (DataType p [], const DataType x []);
+	void				do_log_magnitude (DataType m [], const DataType x [], DataType scale = 1);
+
+	void				do_fft (DataType f [], const FFTRealPcm16Reader &x);
+	void				do_power_spectrum (DataType p [], const FFTRealPcm16Reader &x);
+	void				do_log_magnitude (DataType m [], const FFTRealPcm16Reader &x, DataType scale = 1);
 	void				rescale (DataType x []) const;
 
+	void				set_input_len (long input_len);
+	inline long		get_input_len () const;
+	void				set_max_bin (long max_bin);
+	inline long		get_max_bin () const;
+
 
 
 /*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -91,18 +104,31 @@ private:
 	enum {			NBR_TRIGO_OSC			= FFT_LEN_L2 - TRIGO_BD	};
 	enum {			TRIGO_OSC_ARR_SIZE	=	(NBR_TRIGO_OSC > 0) ? NBR_TRIGO_OSC : 1	};
 
-	void				build_br_lut ();
-	void				build_trigo_lut ();
+	static void		build_br_lut (long table_ptr [], long size, long param);
+	static void		build_trigo_lut (DataType table_ptr [], long size, long param);
+	static void		build_tw_lut (DataType table_ptr [], long size, long param);
 	void				build_trigo_osc ();
 
+	template <class XR>
+	inline void		compute_fft (DataType f [], XR x);
+	template <class XR>
+	inline void		compute_power (DataType p [], XR x);
+	inline void		power_to_log (DataType m [], DataType scale) const;
+
 	DynArray <DataType>
 						_buffer;
-	DynArray <long>
-						_br_data;
 	DynArray <DataType>
+						_buffer_2;
+	FFTRealTable <long>
+						_br_data;
+	FFTRealTable <DataType>
 						_trigo_data;
+	FFTRealTable <DataType>
+						_tw_data;
    Array <OscType, TRIGO_OSC_ARR_SIZE>
 						_trigo_osc;
+	long				_input_len;		// Samples which can be non-zero
+	long				_max_bin;			// Last bin of the power spectra
 
 
 
@@ -36,11 +36,15 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
 #include	"def.h"
+#include	"FFTRealCodelet.h"
 #include	"FFTRealPassDirect.h"
 #include	"FFTRealPassInverse.h"
 #include	"FFTRealSelect.h"
+#include	"FFTRealSimd.h"
 
+#include	<algorithm>
 #include	<cassert>
+#include	<cfloat>
 #include	<cmath>
 
 namespace std { }
@@ -54,12 +58,14 @@ namespace std { }
 template <int LL2>
 FFTRealFixLen <LL2>::FFTRealFixLen ()
 :	_buffer (FFT_LEN)
-,	_br_data (BR_ARR_SIZE)
-,	_trigo_data (TRIGO_TABLE_ARR_SIZE)
+,	_buffer_2 (FFT_LEN)
+,	_br_data (&build_br_lut, BR_ARR_SIZE, FFT_LEN)
+,	_trigo_data (&build_trigo_lut, TRIGO_TABLE_ARR_SIZE, FFT_LEN)
+,	_tw_data (&build_tw_lut, FFTRealSimd::get_twiddle_len (TRIGO_BD), FFT_LEN)
 ,	_trigo_osc ()
+,	_input_len (FFT_LEN)
+,	_max_bin (FFT_LEN >> 1)
 {
-	build_br_lut ();
-	build_trigo_lut ();
 	build_trigo_osc ();
 }
 
@@ -82,6 +88,13 @@ void	FFTRealFixLen <LL2>::do_fft (DataType f [], const DataType x [])
 	assert (x != f);
 	assert (FFT_LEN_L2 >= 3);
 
+	// Short transforms: straight-line code
+	if (FFTRealCodeletUse <FFTRealCodelet <FFT_LEN_L2>::AVAILABLE>::
+		template do_fft <FFT_LEN_L2> (f, x))
+	{
+		return;
+	}
+
 	// Do the transform in several passes
 	const DataType	*	cos_ptr = &_trigo_data [0];
 	const long *	br_ptr = &_br_data [0];
@@ -93,14 +106,17 @@ void	FFTRealFixLen <LL2>::do_fft (DataType f [], const DataType x [])
 		x,
 		cos_ptr,
 		TRIGO_TABLE_ARR_SIZE,
+		&_tw_data [0],
 		br_ptr,
-		&_trigo_osc [0]
+		&_trigo_osc [0],
+		_input_len,
+		FFT_LEN >> 1
 	);
 }
 
 // 4-point FFT
 template <>
-void	FFTRealFixLen <2>::do_fft (DataType f [], const DataType x [])
+inline void	FFTRealFixLen <2>::do_fft (DataType f [], const DataType x [])
 {
 	assert (f != 0);
 	assert (x != 0);
@@ -118,7 +134,7 @@ void	FFTRealFixLen <2>::do_fft (DataType f [], const DataType x [])
 
 // 2-point FFT
 template <>
-void	FFTRealFixLen <1>::do_fft (DataType f [], const DataType x [])
+inline void	FFTRealFixLen <1>::do_fft (DataType f [], const DataType x [])
 {
 	assert (f != 0);
 	assert (x != 0);
@@ -130,7 +146,7 @@ void	FFTRealFixLen <1>::do_fft (DataType f [], const DataType x [])
 
 // 1-point FFT
 template <>
-void	FFTRealFixLen <0>::do_fft (DataType f [], const DataType x [])
+inline void	FFTRealFixLen <0>::do_fft (DataType f [], const DataType x [])
 {
 	assert (f != 0);
 	assert (x != 0);
@@ -149,6 +165,13 @@ void	FFTRealFixLen <LL2>::do_ifft (const DataType f [], DataType x [])
 	assert (x != f);
 	assert (FFT_LEN_L2 >= 3);
 
+	// Short transforms: straight-line code
+	if (FFTRealCodeletUse <FFTRealCodelet <FFT_LEN_L2>::AVAILABLE>::
+		template do_ifft <FFT_LEN_L2> (f, x))
+	{
+		return;
+	}
+
 	// Do the transform in several passes
 	DataType *		s_ptr =
 		FFTRealSelect <FFT_LEN_L2 & 1>::sel_bin (&_buffer [0], x);
@@ -164,6 +187,7 @@ void	FFTRealFixLen <LL2>::do_ifft (const DataType f [], DataType x [])
 		f,
 		cos_ptr,
 		TRIGO_TABLE_ARR_SIZE,
+		&_tw_data [0],
 		br_ptr,
 		&_trigo_osc [0]
 	);
@@ -171,7 +195,7 @@ void	FFTRealFixLen <LL2>::do_ifft (const DataType f [], DataType x [])
 
 // 4-point IFFT
 template <>
-void	FFTRealFixLen <2>::do_ifft (const DataType f [], DataType x [])
+inline void	FFTRealFixLen <2>::do_ifft (const DataType f [], DataType x [])
 {
 	assert (f != 0);
 	assert (x != 0);
@@ -188,7 +212,7 @@ void	FFTRealFixLen <2>::do_ifft (const DataType f [], DataType x [])
 
 // 2-point IFFT
 template <>
-void	FFTRealFixLen <1>::do_ifft (const DataType f [], DataType x [])
+inline void	FFTRealFixLen <1>::do_ifft (const DataType f [], DataType x [])
 {
 	assert (f != 0);
 	assert (x != 0);
@@ -200,7 +224,7 @@ void	FFTRealFixLen <1>::do_ifft (const DataType f [], DataType x [])
 
 // 1-point IFFT
 template <>
-void	FFTRealFixLen <0>::do_ifft (const DataType f [], DataType x [])
+inline void	FFTRealFixLen <0>::do_ifft (const DataType f [], DataType x [])
 {
 	assert (f != 0);
 	assert (x != 0);
@@ -212,6 +236,108 @@ void	FFTRealFixLen <0>::do_ifft (const DataType f [], DataType x [])
 
 
 
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Compute the FFT of 16-bit PCM data. The samples are converted, scaled
+	and windowed while the first pass gathers them.
+Input parameters:
+	- x: reader on the source samples, FFT_LEN values.
+Output parameters:
+	- f: pointer on the destination array (frequencies), same layout as
+		do_fft (DataType f [], const DataType x []).
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2>
+void	FFTRealFixLen <LL2>::do_fft (DataType f [], const FFTRealPcm16Reader &x)
+{
+	assert (f != 0);
+
+	compute_fft <FFTRealPcm16Reader> (f, x);
+}
+
+
+
+/*
+==============================================================================
+Name: do_power_spectrum
+Description:
+	Computes the squared magnitude of the FFT bins, without producing the
+	half-complex spectrum: the last pass writes the powers directly.
+Input parameters:
+	- x: pointer on the source array (time), FFT_LEN values.
+Output parameters:
+	- p: pointer on the destination array. p [k] = |X [k]|^2 for k in
+		[0 ; FFT_LEN/2], FFT_LEN/2 + 1 values. Only the bins up to
+		get_max_bin () are computed, the others are undefined.
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2>
+void	FFTRealFixLen <LL2>::do_power_spectrum (DataType p [], const DataType x [])
+{
+	assert (p != 0);
+	assert (x != 0);
+	assert (x != p);
+
+	compute_power <const DataType *> (p, x);
+}
+
+template <int LL2>
+void	FFTRealFixLen <LL2>::do_power_spectrum (DataType p [], const FFTRealPcm16Reader &x)
+{
+	assert (p != 0);
+
+	compute_power <FFTRealPcm16Reader> (p, x);
+}
+
+
+
+/*
+==============================================================================
+Name: do_log_magnitude
+Description:
+	Computes the logarithm of the magnitude of the FFT bins. Null bins give
+	a large negative value instead of -inf.
+Input parameters:
+	- x: pointer on the source array (time), FFT_LEN values.
+	- scale: multiplier applied to the natural logarithm. Use 20 / ln (10)
+		to get decibels.
+Output parameters:
+	- m: pointer on the destination array. m [k] = scale * ln (|X [k]|) for
+		k in [0 ; FFT_LEN/2], FFT_LEN/2 + 1 values. Only the bins up to
+		get_max_bin () are computed, the others are undefined.
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2>
+void	FFTRealFixLen <LL2>::do_log_magnitude (DataType m [], const DataType x [], DataType scale)
+{
+	assert (m != 0);
+	assert (x != 0);
+	assert (x != m);
+
+	compute_power <const DataType *> (m, x);
+	power_to_log (m, scale);
+}
+
+template <int LL2>
+void	FFTRealFixLen <LL2>::do_log_magnitude (DataType m [], const FFTRealPcm16Reader &x, DataType scale)
+{
+	assert (m != 0);
+
+	compute_power <FFTRealPcm16Reader> (m, x);
+	power_to_log (m, scale);
+}
+
+
+
+
 template <int LL2>
 void	FFTRealFixLen <LL2>::rescale (DataType x []) const
 {
@@ -250,6 +376,80 @@ void	FFTRealFixLen <LL2>::rescale (DataType x []) const
 
 
 
+/*
+==============================================================================
+Name: set_input_len
+Description:
+	Tells the following direct transforms that the source is zero-padded.
+	The first passes, whose blocks would only hold a single non-zero
+	sample, are replaced by a copy of the samples. A source of M samples
+	padded to FFT_LEN points then costs about log2 (M) passes and the copy,
+	instead of FFT_LEN_L2 passes. It has no effect on do_fft () under 128
+	points, which uses straight-line code.
+Input parameters:
+	- input_len: number of leading samples of the source which can be non-
+		zero, in [0 ; FFT_LEN]. x [input_len] to x [FFT_LEN - 1] must be
+		zero, they may not be read. Default: FFT_LEN.
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2>
+void	FFTRealFixLen <LL2>::set_input_len (long input_len)
+{
+	assert (input_len >= 0);
+	assert (input_len <= FFT_LEN);
+
+	_input_len = input_len;
+}
+
+
+
+template <int LL2>
+long	FFTRealFixLen <LL2>::get_input_len () const
+{
+	return (_input_len);
+}
+
+
+
+/*
+==============================================================================
+Name: set_max_bin
+Description:
+	Limits do_power_spectrum () and do_log_magnitude () to the bins in
+	[0 ; max_bin], for applications only showing a part of the spectrum.
+	The butterflies feeding only the bins above are skipped in the last
+	passes, the ones whose blocks are longer than 4 * max_bin. The cost
+	therefore decreases with log2 (max_bin), not in proportion to it. The
+	log conversion is done on the kept bins only. do_fft () always computes
+	the whole spectrum.
+Input parameters:
+	- max_bin: last bin to compute, in [0 ; FFT_LEN/2]. FFT_LEN/2 (default)
+		for the whole spectrum.
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2>
+void	FFTRealFixLen <LL2>::set_max_bin (long max_bin)
+{
+	assert (max_bin >= 0);
+	assert (max_bin <= (FFT_LEN >> 1));
+
+	_max_bin = max_bin;
+}
+
+
+
+template <int LL2>
+long	FFTRealFixLen <LL2>::get_max_bin () const
+{
+	return (_max_bin);
+}
+
+
+
 /*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
 
@@ -258,10 +458,121 @@ void	FFTRealFixLen <LL2>::rescale (DataType x []) const
 
 
 
+// Same as do_fft () for any kind of source
 template <int LL2>
-void	FFTRealFixLen <LL2>::build_br_lut ()
+template <class XR>
+void	FFTRealFixLen <LL2>::compute_fft (DataType f [], XR x)
 {
-	_br_data [0] = 0;
+	// Lengths below 8 have no pass recursion
+	enum {			LAST_PASS	= (FFT_LEN_L2 >= 3) ? FFT_LEN_L2 - 1 : 2	};
+
+	if (FFT_LEN_L2 >= 3)
+	{
+		FFTRealPassDirect <LAST_PASS>::process (
+			FFT_LEN,
+			f,
+			&_buffer [0],
+			x,
+			&_trigo_data [0],
+			TRIGO_TABLE_ARR_SIZE,
+			&_tw_data [0],
+			&_br_data [0],
+			&_trigo_osc [0],
+			_input_len,
+			FFT_LEN >> 1
+		);
+	}
+
+	else
+	{
+		DataType * const	x_flt = &_buffer [0];
+		for (long i = 0; i < FFT_LEN; ++i)
+		{
+			x_flt [i] = x [i];
+		}
+		do_fft (f, x_flt);
+	}
+}
+
+
+
+template <int LL2>
+template <class XR>
+void	FFTRealFixLen <LL2>::compute_power (DataType p [], XR x)
+{
+	// The last pass must be a generic one
+	enum {			POW_PASS	= (FFT_LEN_L2 >= 4) ? FFT_LEN_L2 - 1 : 3	};
+
+	if (FFT_LEN_L2 >= 4)
+	{
+		FFTRealPassDirect <POW_PASS>::process_power (
+			FFT_LEN,
+			p,
+			&_buffer_2 [0],
+			&_buffer [0],
+			x,
+			&_trigo_data [0],
+			TRIGO_TABLE_ARR_SIZE,
+			&_tw_data [0],
+			&_br_data [0],
+			&_trigo_osc [0],
+			_input_len,
+			_max_bin
+		);
+	}
+
+	else
+	{
+		DataType * const	f = &_buffer_2 [0];
+		compute_fft <XR> (f, x);
+
+		const long		h_len = FFT_LEN >> 1;
+		p [0] = f [0] * f [0];
+		for (long i = 1; i < h_len; ++i)
+		{
+			p [i] = f [i] * f [i] + f [h_len + i] * f [h_len + i];
+		}
+		if (h_len > 0)
+		{
+			p [h_len] = f [h_len] * f [h_len];
+		}
+	}
+}
+
+
+
+// Converts the output of compute_power () in place
+template <int LL2>
+void	FFTRealFixLen <LL2>::power_to_log (DataType m [], DataType scale) const
+{
+	const long		nbr_bins = _max_bin + 1;
+	if (FFTRealSimd::get_isa () != FFTRealSimd::Isa_SCALAR)
+	{
+		FFTRealSimd::power_to_log (nbr_bins, m, scale);
+	}
+	else
+	{
+		using namespace std;
+
+		const DataType	mul = scale * DataType (0.5);
+		for (long i = 0; i < nbr_bins; ++i)
+		{
+			m [i] = mul * DataType (log (max (m [i], FLT_MIN)));
+		}
+	}
+}
+
+
+
+// The tables are shared between all the objects of the same length, see
+// FFTRealTable. param is the FFT length, only used as a key.
+template <int LL2>
+void	FFTRealFixLen <LL2>::build_br_lut (long table_ptr [], long size, long param)
+{
+	assert (size == BR_ARR_SIZE);
+	assert (param == FFT_LEN);
+
+	table_ptr [0] = 0;
 	for (long cnt = 1; cnt < BR_ARR_SIZE; ++cnt)
 	{
 		long				index = cnt << 2;
@@ -278,26 +589,40 @@ void	FFTRealFixLen <LL2>::build_br_lut ()
 		}
 		while (bit_cnt > 0);
 
-		_br_data [cnt] = br_index;
+		table_ptr [cnt] = br_index;
 	}
 }
 
 
 
 template <int LL2>
-void	FFTRealFixLen <LL2>::build_trigo_lut ()
+void	FFTRealFixLen <LL2>::build_trigo_lut (DataType table_ptr [], long size, long param)
 {
+	assert (size == TRIGO_TABLE_ARR_SIZE);
+	assert (param == FFT_LEN);
+
 	const double	mul = (0.5 * PI) / TRIGO_TABLE_ARR_SIZE;
 	for (long i = 0; i < TRIGO_TABLE_ARR_SIZE; ++ i)
 	{
 		using namespace std;
 
-		_trigo_data [i] = DataType (cos (i * mul));
+		table_ptr [i] = DataType (cos (i * mul));
 	}
 }
 
 
 
+template <int LL2>
+void	FFTRealFixLen <LL2>::build_tw_lut (DataType table_ptr [], long size, long param)
+{
+	assert (size == FFTRealSimd::get_twiddle_len (TRIGO_BD));
+	assert (param == FFT_LEN);
+
+	FFTRealSimd::build_twiddles (table_ptr, TRIGO_BD);
+}
+
+
+
 template <int LL2>
 void	FFTRealFixLen <LL2>::build_trigo_osc ()
 {
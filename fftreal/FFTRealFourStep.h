@@ -0,0 +1,193 @@
+/*****************************************************************************
+
+        FFTRealFourStep.h
+
+Real FFT for long power-of-2 lengths (whole recordings, 2^17 points and
+more), with the same output layout as FFTReal. The real signal is packed
+into a complex signal of length M = length / 2, seen as a N1 x N2 matrix
+(M = N1 * N2, both close to sqrt (M)). The complex FFT is then done in four
+steps:
+
+	1. N1 FFTs of length N2, on the columns of the matrix,
+	2. Multiplication by the twiddle factors,
+	3. Transposition,
+	4. N2 FFTs of length N1, on the rows of the transposed matrix.
+
+Each sub-FFT fits in the cache and is done by FFTReal. The transpositions
+are done by blocks of ROW_BLOCK rows, so memory is always read and written
+by runs of contiguous elements. A final split step rebuilds the spectrum of
+the real signal. The sub-FFTs of a step are independent and can be spread
+over several threads.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealFourStep_HEADER_INCLUDED)
+#define	FFTRealFourStep_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"DynArray.h"
+#include	"FFTReal.h"
+#include	"FFTRealTable.h"
+#include	"FFTRealThreadPool.h"
+
+
+
+template <class DT>
+class FFTRealFourStep
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	enum {			MIN_BIT_DEPTH	= 3	};
+	enum {			MAX_BIT_DEPTH	= 30	};	// So length can be represented as long int
+
+	// Number of rows transposed at once
+	enum {			ROW_BLOCK		= 16	};
+
+	// Padding between the rows of a block, so they don't compete for the
+	// same cache sets.
+	enum {			ROW_PAD			= 16	};
+
+	typedef	DT	DataType;
+
+	explicit			FFTRealFourStep (long length, int nbr_threads = 1);
+	virtual			~FFTRealFourStep () {}
+
+	long				get_length () const;
+	int				get_nbr_threads () const;
+	void				do_fft (DataType f [], const DataType x []) const;
+	void				do_ifft (const DataType f [], DataType x []) const;
+	void				rescale (DataType x []) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	// Twiddle factors of a column are computed by blocks of this size
+	enum {			TW_BLOCK			= 64	};
+
+	enum Step
+	{
+		Step_SPLIT_DIRECT = 0,
+		Step_SPLIT_INVERSE,
+		Step_COLUMNS,
+		Step_ROWS
+	};
+
+	// Arguments of a step. Complex arrays are made of two parts, element pos
+	// is at re [pos * stride] and im [pos * stride].
+	class Job
+	{
+	public:
+		const FFTRealFourStep *
+							_obj_ptr;
+		Step				_step;
+		const DataType *
+							_src_re_ptr;
+		const DataType *
+							_src_im_ptr;
+		long				_src_stride;
+		DataType *		_dst_re_ptr;
+		DataType *		_dst_im_ptr;
+		long				_dst_stride;
+		DataType			_im_mul;		// -1 to conjugate the result of the last step
+	};
+
+	static int		get_nbr_bits (long length);
+	static long		get_table_size (long nbr_bits);
+	static void		init_table (DataType table_ptr [], long size, long nbr_bits);
+
+	void				run (Job &job) const;
+	static void		exec_job (void *ctx_ptr, int part, int nbr_parts);
+	void				run_range (const Job &job, long first, long last, int thread) const;
+	void				split_direct (const Job &job, long first, long last) const;
+	void				split_inverse (const Job &job, long first, long last) const;
+	void				do_columns (const Job &job, long first, long last, int thread) const;
+	void				do_rows (const Job &job, long first, long last, int thread) const;
+	static void		fft_complex (const FFTReal <DataType> &fft, DataType dr [], DataType di [], const DataType sr [], const DataType si [], DataType scratch_ptr []);
+	inline void		get_twiddle (DataType &c, DataType &s, long p) const;
+
+	const long		_length;
+	const int		_nbr_bits;
+	const int		_tw_lo_bits;	// Twiddle factor table is split in two levels
+	const long		_nbr_cplx;	// M
+	const long		_len_1;		// N1, number of columns
+	const long		_len_2;		// N2, number of rows
+	const int		_nbr_threads;
+	const long		_scratch_len;
+	FFTReal <DataType>
+						_fft_1;
+	FFTReal <DataType>
+						_fft_2;
+	FFTRealTable <DataType>
+						_table;
+	mutable DynArray <DataType>
+						_buffer;
+	mutable DynArray <DataType>
+						_scratch;
+	mutable FFTRealThreadPool
+						_pool;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealFourStep ();
+						FFTRealFourStep (const FFTRealFourStep &other);
+	FFTRealFourStep &
+						operator = (const FFTRealFourStep &other);
+	bool				operator == (const FFTRealFourStep &other);
+	bool				operator != (const FFTRealFourStep &other);
+
+};	// class FFTRealFourStep
+
+
+
+#include	"FFTRealFourStep.hpp"
+
+
+
+#endif	// FFTRealFourStep_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,683 @@
+/*****************************************************************************
+
+        FFTRealFourStep.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealFourStep_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealFourStep code header.
+#endif
+#define	FFTRealFourStep_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealFourStep_CODEHEADER_INCLUDED)
+#define	FFTRealFourStep_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<algorithm>
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- length: length of the array on which we want to do a FFT. Must be a
+		power of 2, from 2^MIN_BIT_DEPTH to 2^MAX_BIT_DEPTH.
+	- nbr_threads: number of threads sharing the work of each step, the
+		calling thread included. Range: > 0.
+Throws: std::bad_alloc, std::system_error
+==============================================================================
+*/
+
+template <class DT>
+FFTRealFourStep <DT>::FFTRealFourStep (long length, int nbr_threads)
+:	_length (length)
+,	_nbr_bits (get_nbr_bits (length))
+,	_tw_lo_bits ((_nbr_bits + 1) >> 1)
+,	_nbr_cplx (length >> 1)
+,	_len_1 (1L << ((_nbr_bits - 1) >> 1))
+,	_len_2 (_nbr_cplx >> ((_nbr_bits - 1) >> 1))
+,	_nbr_threads (std::max (nbr_threads, 1))
+,	_scratch_len ((ROW_BLOCK * 2 + 3) * (_len_2 + ROW_PAD))
+,	_fft_1 (_len_1)
+,	_fft_2 (_len_2)
+,	_table (&init_table, get_table_size (_nbr_bits), _nbr_bits)
+,	_buffer (length)
+,	_scratch (_scratch_len * _nbr_threads)
+,	_pool (_nbr_threads)
+{
+	assert (length == 1L << _nbr_bits);
+	assert (_nbr_bits >= MIN_BIT_DEPTH);
+	assert (_nbr_bits <= MAX_BIT_DEPTH);
+	assert (nbr_threads > 0);
+}
+
+
+
+/*
+==============================================================================
+Name: get_length
+Description:
+	Returns the number of points processed by this FFT object.
+Returns: The number of points, power of 2, positive.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+long	FFTRealFourStep <DT>::get_length () const
+{
+	return (_length);
+}
+
+
+
+/*
+==============================================================================
+Name: get_nbr_threads
+Description:
+	Returns the number of threads sharing the work of each step.
+Returns: The number of threads, > 0.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+int	FFTRealFourStep <DT>::get_nbr_threads () const
+{
+	return (_nbr_threads);
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Compute the FFT of the array, with the same output layout as
+	FFTReal::do_fft ().
+	The object uses internal buffers and cannot be shared between threads.
+Input parameters:
+	- x: pointer on the source array (time).
+Output parameters:
+	- f: pointer on the destination array (frequencies).
+		f [0...length(x)/2] = real values,
+		f [length(x)/2+1...length(x)-1] = negative imaginary values of
+		coefficents 1...length(x)/2-1.
+Throws: std::system_error
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealFourStep <DT>::do_fft (DataType f [], const DataType x []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+
+	DataType * const	br_ptr = &_buffer [0];
+	DataType * const	bi_ptr = br_ptr + _nbr_cplx;
+	Job				job;
+
+	// Columns of the packed signal, from x to the buffer
+	job._step       = Step_COLUMNS;
+	job._src_re_ptr = x;
+	job._src_im_ptr = x + 1;
+	job._src_stride = 2;
+	job._dst_re_ptr = br_ptr;
+	job._dst_im_ptr = bi_ptr;
+	job._dst_stride = 1;
+	job._im_mul     = DataType (1);
+	run (job);
+
+	// Rows, from the buffer to f
+	job._step       = Step_ROWS;
+	job._src_re_ptr = br_ptr;
+	job._src_im_ptr = bi_ptr;
+	job._src_stride = 1;
+	job._dst_re_ptr = f;
+	job._dst_im_ptr = f + _nbr_cplx;
+	job._dst_stride = 1;
+	run (job);
+
+	// Spectrum of the real signal, in place
+	job._step       = Step_SPLIT_DIRECT;
+	run (job);
+}
+
+
+
+/*
+==============================================================================
+Name: do_ifft
+Description:
+	Compute the inverse FFT of the array, with the same input layout as
+	FFTReal::do_ifft (). Data are not rescaled.
+	The object uses internal buffers and cannot be shared between threads.
+Input parameters:
+	- f: pointer on the source array (frequencies).
+		f [0...length(x)/2] = real values
+		f [length(x)/2+1...length(x)-1] = negative imaginary values of
+		coefficents 1...length(x)/2-1.
+Output parameters:
+	- x: pointer on the destination array (time).
+Throws: std::system_error
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealFourStep <DT>::do_ifft (const DataType f [], DataType x []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+
+	DataType * const	br_ptr = &_buffer [0];
+	DataType * const	bi_ptr = br_ptr + _nbr_cplx;
+	Job				job;
+
+	// Conjugated spectrum of the packed signal, from f to x. The inverse
+	// transform is then done with the direct one.
+	job._step       = Step_SPLIT_INVERSE;
+	job._src_re_ptr = f;
+	job._src_im_ptr = f + _nbr_cplx;
+	job._src_stride = 1;
+	job._dst_re_ptr = x;
+	job._dst_im_ptr = x + _nbr_cplx;
+	job._dst_stride = 1;
+	job._im_mul     = DataType (1);
+	run (job);
+
+	// Columns, from x to the buffer
+	job._step       = Step_COLUMNS;
+	job._src_re_ptr = x;
+	job._src_im_ptr = x + _nbr_cplx;
+	job._dst_re_ptr = br_ptr;
+	job._dst_im_ptr = bi_ptr;
+	run (job);
+
+	// Rows, from the buffer to x, conjugated and interleaved
+	job._step       = Step_ROWS;
+	job._src_re_ptr = br_ptr;
+	job._src_im_ptr = bi_ptr;
+	job._dst_re_ptr = x;
+	job._dst_im_ptr = x + 1;
+	job._dst_stride = 2;
+	job._im_mul     = DataType (-1);
+	run (job);
+}
+
+
+
+/*
+==============================================================================
+Name: rescale
+Description:
+	Scale an array by divide each element by its length. This function should
+	be called after FFT + IFFT.
+Input parameters:
+	- x: pointer on array to rescale (time or frequency).
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealFourStep <DT>::rescale (DataType x []) const
+{
+	const DataType	mul = DataType (1.0 / _length);
+
+	for (long i = 0; i < _length; ++i)
+	{
+		x [i] *= mul;
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+int	FFTRealFourStep <DT>::get_nbr_bits (long length)
+{
+	assert (length > 0);
+
+	int				nbr_bits = 0;
+	while ((1L << nbr_bits) < length)
+	{
+		++ nbr_bits;
+	}
+
+	return (nbr_bits);
+}
+
+
+
+// Two levels: W^p = W^(p & lo_mask) * W^(p - (p & lo_mask))
+// cos and sin of the low part, then cos and sin of the high part.
+template <class DT>
+long	FFTRealFourStep <DT>::get_table_size (long nbr_bits)
+{
+	const long		lo_bits = (nbr_bits + 1) >> 1;
+
+	return (((1L << lo_bits) + (1L << (nbr_bits - lo_bits))) * 2);
+}
+
+
+
+template <class DT>
+void	FFTRealFourStep <DT>::init_table (DataType table_ptr [], long size, long nbr_bits)
+{
+	using namespace std;
+
+	assert (size == get_table_size (nbr_bits));
+
+	const long		lo_bits = (nbr_bits + 1) >> 1;
+	const long		lo_len = 1L << lo_bits;
+	const long		hi_len = 1L << (nbr_bits - lo_bits);
+	const double	mul = (2 * PI) / (1L << nbr_bits);
+
+	for (long i = 0; i < lo_len; ++i)
+	{
+		table_ptr [         i] = DataType (cos (i * mul));
+		table_ptr [lo_len + i] = DataType (sin (i * mul));
+	}
+
+	DataType * const	hi_ptr = table_ptr + lo_len * 2;
+	for (long i = 0; i < hi_len; ++i)
+	{
+		hi_ptr [         i] = DataType (cos ((i << lo_bits) * mul));
+		hi_ptr [hi_len + i] = DataType (sin ((i << lo_bits) * mul));
+	}
+}
+
+
+
+// Splits the step into contiguous ranges, one per thread of the pool
+template <class DT>
+void	FFTRealFourStep <DT>::run (Job &job) const
+{
+	job._obj_ptr = this;
+	_pool.run (&exec_job, &job);
+}
+
+
+
+template <class DT>
+void	FFTRealFourStep <DT>::exec_job (void *ctx_ptr, int part, int nbr_parts)
+{
+	assert (ctx_ptr != 0);
+
+	const Job &		job = *static_cast <const Job *> (ctx_ptr);
+	const FFTRealFourStep &	obj = *job._obj_ptr;
+
+	long				nbr_items = 0;
+	long				granularity = 1;
+	switch (job._step)
+	{
+	case	Step_SPLIT_DIRECT:
+	case	Step_SPLIT_INVERSE:
+		nbr_items = (obj._nbr_cplx >> 1) + 1;
+		break;
+	case	Step_COLUMNS:
+		nbr_items = obj._len_1;
+		granularity = std::min (long (ROW_BLOCK), obj._len_1);
+		break;
+	case	Step_ROWS:
+		nbr_items = obj._len_2;
+		granularity = std::min (long (ROW_BLOCK), obj._len_2);
+		break;
+	default:
+		assert (false);
+		break;
+	}
+
+	const long		nbr_blocks = (nbr_items + granularity - 1) / granularity;
+	const long		part_len = nbr_blocks / nbr_parts;
+	const long		rem = nbr_blocks % nbr_parts;
+	const long		blk_beg = part_len *  part      + std::min (long (part    ), rem);
+	const long		blk_end = part_len * (part + 1) + std::min (long (part + 1), rem);
+	const long		first = std::min (blk_beg * granularity, nbr_items);
+	const long		last  = std::min (blk_end * granularity, nbr_items);
+	if (first < last)
+	{
+		obj.run_range (job, first, last, part);
+	}
+}
+
+
+
+template <class DT>
+void	FFTRealFourStep <DT>::run_range (const Job &job, long first, long last, int thread) const
+{
+	switch (job._step)
+	{
+	case	Step_SPLIT_DIRECT:
+		split_direct (job, first, last);
+		break;
+	case	Step_SPLIT_INVERSE:
+		split_inverse (job, first, last);
+		break;
+	case	Step_COLUMNS:
+		do_columns (job, first, last, thread);
+		break;
+	case	Step_ROWS:
+		do_rows (job, first, last, thread);
+		break;
+	default:
+		assert (false);
+		break;
+	}
+}
+
+
+
+// Z is the packed signal spectrum, stored in place in the destination.
+// Processes the coefficient pairs k and M - k, k in [first ; last[.
+template <class DT>
+void	FFTRealFourStep <DT>::split_direct (const Job &job, long first, long last) const
+{
+	const long		nbr_cplx = _nbr_cplx;
+	DataType * const	f = job._dst_re_ptr;
+	const DataType	half = DataType (0.5);
+
+	for (long k = first; k < last; ++k)
+	{
+		if (k == 0)
+		{
+			const DataType	zr = f [0];
+			const DataType	zi = f [nbr_cplx];
+			f [0       ] = zr + zi;
+			f [nbr_cplx] = zr - zi;
+		}
+		else
+		{
+			const long		j = nbr_cplx - k;
+			const DataType	zr_k = f [k];
+			const DataType	zi_k = f [nbr_cplx + k];
+			const DataType	zr_j = f [j];
+			const DataType	zi_j = f [nbr_cplx + j];
+			const DataType	fe_r = (zr_k + zr_j) * half;
+			const DataType	fe_i = (zi_k - zi_j) * half;
+			const DataType	fo_r = (zi_k + zi_j) * half;
+			const DataType	fo_i = (zr_j - zr_k) * half;
+			DataType			c;
+			DataType			s;
+			get_twiddle (c, s, k);
+			const DataType	t_r = c * fo_r + s * fo_i;
+			const DataType	t_i = c * fo_i - s * fo_r;
+
+			f [k           ] =   fe_r + t_r;
+			f [nbr_cplx + k] = -(fe_i + t_i);
+			f [j           ] =   fe_r - t_r;
+			f [nbr_cplx + j] =   fe_i - t_i;
+		}
+	}
+}
+
+
+
+// Writes the conjugated spectrum of the packed signal.
+// Processes the coefficient pairs k and M - k, k in [first ; last[.
+template <class DT>
+void	FFTRealFourStep <DT>::split_inverse (const Job &job, long first, long last) const
+{
+	const long		nbr_cplx = _nbr_cplx;
+	const DataType * const	f = job._src_re_ptr;
+	DataType * const	xr = job._dst_re_ptr;
+	DataType * const	xi = job._dst_im_ptr;
+
+	for (long k = first; k < last; ++k)
+	{
+		if (k == 0)
+		{
+			xr [0] =   f [0] + f [nbr_cplx];
+			xi [0] = -(f [0] - f [nbr_cplx]);
+		}
+		else
+		{
+			const long		j = nbr_cplx - k;
+			const DataType	a_r = f [k] + f [j];
+			const DataType	a_i = f [nbr_cplx + j] - f [nbr_cplx + k];
+			const DataType	b_r = f [k] - f [j];
+			const DataType	b_i = -(f [nbr_cplx + k] + f [nbr_cplx + j]);
+			DataType			c;
+			DataType			s;
+			get_twiddle (c, s, k);
+			const DataType	u_r = s * b_r + c * b_i;
+			const DataType	u_i = c * b_r - s * b_i;
+
+			xr [k] =   a_r - u_r;
+			xi [k] = -(a_i + u_i);
+			xr [j] =   a_r + u_r;
+			xi [j] =   a_i - u_i;
+		}
+	}
+}
+
+
+
+// Steps 1 to 3 for the columns [first ; last[: FFT of length N2, twiddle
+// factors W_M ^ (n1 * k2), and transposition.
+template <class DT>
+void	FFTRealFourStep <DT>::do_columns (const Job &job, long first, long last, int thread) const
+{
+	const long		len_1 = _len_1;
+	const long		len_2 = _len_2;
+	const long		blk_len = std::min (long (ROW_BLOCK), len_1);
+	const long		tw_len = std::min (long (TW_BLOCK), len_2);
+	const long		pitch = len_2 + ROW_PAD;
+	const long		src_stride = job._src_stride;
+	DataType * const	rr_ptr = &_scratch [thread * _scratch_len];
+	DataType * const	ri_ptr = rr_ptr + ROW_BLOCK * pitch;
+	DataType * const	tmp_ptr = ri_ptr + ROW_BLOCK * pitch;
+
+	assert (first % blk_len == 0);
+	assert (last % blk_len == 0);
+
+	for (long n1_beg = first; n1_beg < last; n1_beg += blk_len)
+	{
+		for (long n2 = 0; n2 < len_2; ++n2)
+		{
+			const long		src_pos = (n2 * len_1 + n1_beg) * src_stride;
+			const DataType * const	sr = job._src_re_ptr + src_pos;
+			const DataType * const	si = job._src_im_ptr + src_pos;
+			for (long r = 0; r < blk_len; ++r)
+			{
+				rr_ptr [r * pitch + n2] = sr [r * src_stride];
+				ri_ptr [r * pitch + n2] = si [r * src_stride];
+			}
+		}
+
+		for (long r = 0; r < blk_len; ++r)
+		{
+			DataType * const	zr = rr_ptr + r * pitch;
+			DataType * const	zi = ri_ptr + r * pitch;
+			fft_complex (_fft_2, zr, zi, zr, zi, tmp_ptr);
+
+			// W ^ (k2 * p_step) = W ^ (k2_beg * p_step) * W ^ (j * p_step)
+			const long		p_step = (n1_beg + r) * 2;
+			DataType * const	twc_ptr = tmp_ptr;
+			DataType * const	tws_ptr = tmp_ptr + tw_len;
+			for (long j = 0; j < tw_len; ++j)
+			{
+				get_twiddle (twc_ptr [j], tws_ptr [j], j * p_step);
+			}
+
+			for (long k2_beg = 0; k2_beg < len_2; k2_beg += tw_len)
+			{
+				DataType			bc;
+				DataType			bs;
+				get_twiddle (bc, bs, k2_beg * p_step);
+				DataType * const	tr = zr + k2_beg;
+				DataType * const	ti = zi + k2_beg;
+				for (long j = 0; j < tw_len; ++j)
+				{
+					const DataType	c = bc * twc_ptr [j] - bs * tws_ptr [j];
+					const DataType	s = bs * twc_ptr [j] + bc * tws_ptr [j];
+					const DataType	re = tr [j];
+					const DataType	im = ti [j];
+					tr [j] = re * c + im * s;
+					ti [j] = im * c - re * s;
+				}
+			}
+		}
+
+		for (long k2 = 0; k2 < len_2; ++k2)
+		{
+			DataType * const	dr = job._dst_re_ptr + k2 * len_1 + n1_beg;
+			DataType * const	di = job._dst_im_ptr + k2 * len_1 + n1_beg;
+			for (long r = 0; r < blk_len; ++r)
+			{
+				dr [r] = rr_ptr [r * pitch + k2];
+				di [r] = ri_ptr [r * pitch + k2];
+			}
+		}
+	}
+}
+
+
+
+// Step 4 for the rows [first ; last[: FFT of length N1, and transposition
+// to the natural order.
+template <class DT>
+void	FFTRealFourStep <DT>::do_rows (const Job &job, long first, long last, int thread) const
+{
+	const long		len_1 = _len_1;
+	const long		len_2 = _len_2;
+	const long		blk_len = std::min (long (ROW_BLOCK), len_2);
+	const long		dst_stride = job._dst_stride;
+	const long		pitch = len_1 + ROW_PAD;
+	const DataType	im_mul = job._im_mul;
+	DataType * const	rr_ptr = &_scratch [thread * _scratch_len];
+	DataType * const	ri_ptr = rr_ptr + ROW_BLOCK * pitch;
+	DataType * const	tmp_ptr = ri_ptr + ROW_BLOCK * pitch;
+
+	assert (first % blk_len == 0);
+	assert (last % blk_len == 0);
+
+	for (long k2_beg = first; k2_beg < last; k2_beg += blk_len)
+	{
+		for (long r = 0; r < blk_len; ++r)
+		{
+			const long		src_pos = (k2_beg + r) * len_1;
+			fft_complex (
+				_fft_1,
+				rr_ptr + r * pitch, ri_ptr + r * pitch,
+				job._src_re_ptr + src_pos, job._src_im_ptr + src_pos,
+				tmp_ptr
+			);
+		}
+
+		for (long k1 = 0; k1 < len_1; ++k1)
+		{
+			const long		dst_pos = (k1 * len_2 + k2_beg) * dst_stride;
+			DataType * const	dr = job._dst_re_ptr + dst_pos;
+			DataType * const	di = job._dst_im_ptr + dst_pos;
+			for (long r = 0; r < blk_len; ++r)
+			{
+				dr [r * dst_stride] = rr_ptr [r * pitch + k1];
+				di [r * dst_stride] = ri_ptr [r * pitch + k1] * im_mul;
+			}
+		}
+	}
+}
+
+
+
+// Complex FFT made of two real FFTs, one for each part.
+// The destination may be the source. scratch_ptr: 3 * length elements.
+template <class DT>
+void	FFTRealFourStep <DT>::fft_complex (const FFTReal <DataType> &fft, DataType dr [], DataType di [], const DataType sr [], const DataType si [], DataType scratch_ptr [])
+{
+	const long		len = fft.get_length ();
+	const long		h_len = len >> 1;
+	DataType * const	fr = scratch_ptr;
+	DataType * const	fs = fr + len;
+	DataType * const	buf_ptr = fs + len;
+
+	fft.do_fft (fr, sr, buf_ptr);
+	fft.do_fft (fs, si, buf_ptr);
+
+	dr [0    ] = fr [0    ];
+	di [0    ] = fs [0    ];
+	dr [h_len] = fr [h_len];
+	di [h_len] = fs [h_len];
+	for (long k = 1; k < h_len; ++k)
+	{
+		const DataType	rr = fr [k        ];
+		const DataType	ri = fr [h_len + k];
+		const DataType	sr_k = fs [k        ];
+		const DataType	si_k = fs [h_len + k];
+
+		dr [      k] = rr + si_k;
+		di [      k] = sr_k - ri;
+		dr [len - k] = rr - si_k;
+		di [len - k] = sr_k + ri;
+	}
+}
+
+
+
+// W_N ^ p = c - i * s, p in [0 ; N[
+template <class DT>
+void	FFTRealFourStep <DT>::get_twiddle (DataType &c, DataType &s, long p) const
+{
+	assert (p >= 0);
+	assert (p < _length);
+
+	const long		lo_len = 1L << _tw_lo_bits;
+	const long		hi_len = _length >> _tw_lo_bits;
+	const long		lo = p & (lo_len - 1);
+	const long		hi = p >> _tw_lo_bits;
+	const DataType	lc = _table [         lo];
+	const DataType	ls = _table [lo_len + lo];
+	const DataType	hc = _table [lo_len * 2          + hi];
+	const DataType	hs = _table [lo_len * 2 + hi_len + hi];
+
+	c = hc * lc - hs * ls;
+	s = hs * lc + hc * ls;
+}
+
+
+
+#endif	// FFTRealFourStep_CODEHEADER_INCLUDED
+
+#undef FFTRealFourStep_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
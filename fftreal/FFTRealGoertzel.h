@@ -0,0 +1,178 @@
+/*****************************************************************************
+
+        FFTRealGoertzel.h
+
+Bank of Goertzel filters, giving the energy of a signal at a few arbitrary
+frequencies for much less than a whole FFT. Each filter runs the recursion
+
+	s [n] = x [n] + 2 * cos (w) * s [n - 1] - s [n - 2]
+
+and the squared magnitude of the DFT at w is read from the last two states.
+Each vector lane holds a filter, and several vectors are updated for each
+sample: their recursions are independent, so the processor can overlap
+them. AVX2 is used when available, SSE2 otherwise.
+
+The filter poles are on the unit circle: call clear () at the beginning of
+each analysis block, as with a DFT over that block.
+
+The recursion runs in DataType. Its rounding errors grow with the length
+of the block, and are the largest near 0 and 0.5 cycles per sample, where
+the poles merge: on 4096 samples of white noise, the power can be off by
+1 % at DC and Nyquist, and by about 0.01 % in the middle of the band.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealGoertzel_HEADER_INCLUDED)
+#define	FFTRealGoertzel_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"DynArray.h"
+#include	"FFTRealFixLenParam.h"
+#include	"FFTRealSimd.h"
+
+// Same rule as FFTRealBatch: SSE2 registers only when the compiler may use
+// SSE2 everywhere, plain arrays otherwise.
+#if defined (FFTRealSimd_X86)
+	#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define	FFTRealGoertzel_SSE2
+	#endif
+#endif
+
+
+
+class FFTRealGoertzel
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	FFTRealFixLenParam::DataType	DataType;
+
+	inline			FFTRealGoertzel (const double freq_arr [], long nbr_filters);
+						~FFTRealGoertzel () {}
+
+	inline long		get_nbr_filters () const;
+	inline double	get_freq (long index) const;
+
+	inline void		clear ();
+	inline void		process_block (const DataType x [], long nbr_spl);
+	inline void		get_power (DataType p []) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	enum {			NBR_LANES		= 4	};
+
+	// Number of vectors updated at once. The recursions are latency-bound,
+	// so a single filter costs about as much as NBR_VEC vectors of them.
+	enum {			NBR_VEC			= 4	};
+
+	// Filter arrays are padded to a whole number of blocks of NBR_VEC AVX2
+	// vectors.
+	enum {			ALIGN_LANES		= NBR_VEC * 8	};
+
+#if defined (FFTRealGoertzel_SSE2)
+	typedef	__m128	VecType;
+#else
+	struct VecType
+	{
+		DataType			_lane [NBR_LANES];
+	};
+#endif
+
+	FORCEINLINE static VecType
+						load (const DataType ptr []);
+	FORCEINLINE static void
+						store (DataType ptr [], VecType v);
+	FORCEINLINE static VecType
+						set1 (DataType a);
+	FORCEINLINE static VecType
+						sub (VecType a, VecType b);
+	FORCEINLINE static VecType
+						mul_add (VecType a, VecType b, VecType c);
+	FORCEINLINE static void
+						step (VecType &s1, VecType &s2, VecType c, VecType xv);
+
+	inline void		process_vec_n (long ofs, const DataType x [], long nbr_spl);
+
+#if defined (FFTRealGoertzel_SSE2)
+	FFTRealSimd_TARGET_AVX2 FORCEINLINE static void
+						step_avx2 (__m256 &s1, __m256 &s2, __m256 c, __m256 xv);
+	FFTRealSimd_TARGET_AVX2 inline void
+						process_avx2 (const DataType x [], long nbr_spl);
+#endif
+
+	const long		_nbr_filters;
+	const long		_nbr_lanes;	// _nbr_filters, padded
+	DynArray <double>
+						_freq;
+	DynArray <DataType>
+						_coef;		// 2 * cos (w), 0 for the unused lanes
+	DynArray <DataType>
+						_state_1;	// s [n - 1]
+	DynArray <DataType>
+						_state_2;	// s [n - 2]
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealGoertzel ();
+						FFTRealGoertzel (const FFTRealGoertzel &other);
+	FFTRealGoertzel &
+						operator = (const FFTRealGoertzel &other);
+	bool				operator == (const FFTRealGoertzel &other);
+	bool				operator != (const FFTRealGoertzel &other);
+
+};	// class FFTRealGoertzel
+
+
+
+#include	"FFTRealGoertzel.hpp"
+
+
+
+#endif	// FFTRealGoertzel_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
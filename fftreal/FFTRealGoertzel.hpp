@@ -0,0 +1,400 @@
+/*****************************************************************************
+
+        FFTRealGoertzel.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealGoertzel_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealGoertzel code header.
+#endif
+#define	FFTRealGoertzel_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealGoertzel_CODEHEADER_INCLUDED)
+#define	FFTRealGoertzel_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- freq_arr: frequency of each filter, in cycles per sample (frequency in
+		Hz divided by the sampling rate). Range: [0 ; 0.5].
+	- nbr_filters: number of filters. Range: > 0.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+FFTRealGoertzel::FFTRealGoertzel (const double freq_arr [], long nbr_filters)
+:	_nbr_filters (nbr_filters)
+,	_nbr_lanes ((nbr_filters + ALIGN_LANES - 1) & -long (ALIGN_LANES))
+,	_freq (nbr_filters)
+,	_coef (_nbr_lanes)
+,	_state_1 (_nbr_lanes)
+,	_state_2 (_nbr_lanes)
+{
+	assert (freq_arr != 0);
+	assert (nbr_filters > 0);
+
+	using namespace std;
+
+	for (long index = 0; index < _nbr_lanes; ++index)
+	{
+		_coef [index] = 0;
+	}
+	for (long index = 0; index < _nbr_filters; ++index)
+	{
+		assert (freq_arr [index] >= 0);
+		assert (freq_arr [index] <= 0.5);
+
+		_freq [index] = freq_arr [index];
+		_coef [index] = static_cast <DataType> (2 * cos (2 * PI * freq_arr [index]));
+	}
+
+	clear ();
+}
+
+
+
+long	FFTRealGoertzel::get_nbr_filters () const
+{
+	return (_nbr_filters);
+}
+
+
+
+/*
+==============================================================================
+Name: get_freq
+Input parameters:
+	- index: filter index. Range: [0 ; get_nbr_filters ()[
+Returns: The frequency of the filter, in cycles per sample.
+Throws: Nothing
+==============================================================================
+*/
+
+double	FFTRealGoertzel::get_freq (long index) const
+{
+	assert (index >= 0);
+	assert (index < _nbr_filters);
+
+	return (_freq [index]);
+}
+
+
+
+/*
+==============================================================================
+Name: clear
+Description:
+	Starts a new analysis block.
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealGoertzel::clear ()
+{
+	for (long index = 0; index < _nbr_lanes; ++index)
+	{
+		_state_1 [index] = 0;
+		_state_2 [index] = 0;
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: process_block
+Description:
+	Feeds samples to all the filters. A block can be split over several
+	calls.
+Input parameters:
+	- x: samples.
+	- nbr_spl: number of samples. Range: >= 0.
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealGoertzel::process_block (const DataType x [], long nbr_spl)
+{
+	assert (x != 0 || nbr_spl == 0);
+	assert (nbr_spl >= 0);
+
+#if defined (FFTRealGoertzel_SSE2)
+	if (FFTRealSimd::get_isa () >= FFTRealSimd::Isa_AVX2)
+	{
+		process_avx2 (x, nbr_spl);
+		return;
+	}
+#endif
+
+	for (long ofs = 0; ofs < _nbr_lanes; ofs += NBR_VEC * NBR_LANES)
+	{
+		process_vec_n (ofs, x, nbr_spl);
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: get_power
+Description:
+	Returns the squared magnitude of the DFT of the samples given since the
+	last clear (), at the frequency of each filter:
+	|sum (x [n] * exp (-j * 2 * PI * f * n))| ^ 2
+	With f = k / N and N samples, this is the power of bin k of an FFT of
+	length N.
+Output parameters:
+	- p: power for each filter, get_nbr_filters () elements.
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealGoertzel::get_power (DataType p []) const
+{
+	assert (p != 0);
+
+	for (long index = 0; index < _nbr_filters; ++index)
+	{
+		const double	s1 = _state_1 [index];
+		const double	s2 = _state_2 [index];
+		const double	power = s1 * s1 + s2 * s2 - _coef [index] * s1 * s2;
+		p [index] = static_cast <DataType> ((power > 0) ? power : 0);
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+#if defined (FFTRealGoertzel_SSE2)
+
+FFTRealGoertzel::VecType	FFTRealGoertzel::load (const DataType ptr [])
+{
+	return (_mm_loadu_ps (ptr));
+}
+
+void	FFTRealGoertzel::store (DataType ptr [], VecType v)
+{
+	_mm_storeu_ps (ptr, v);
+}
+
+FFTRealGoertzel::VecType	FFTRealGoertzel::set1 (DataType a)
+{
+	return (_mm_set1_ps (a));
+}
+
+FFTRealGoertzel::VecType	FFTRealGoertzel::sub (VecType a, VecType b)
+{
+	return (_mm_sub_ps (a, b));
+}
+
+// a * b + c
+FFTRealGoertzel::VecType	FFTRealGoertzel::mul_add (VecType a, VecType b, VecType c)
+{
+	return (_mm_add_ps (_mm_mul_ps (a, b), c));
+}
+
+#else	// FFTRealGoertzel_SSE2
+
+FFTRealGoertzel::VecType	FFTRealGoertzel::load (const DataType ptr [])
+{
+	VecType			v;
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		v._lane [lane] = ptr [lane];
+	}
+
+	return (v);
+}
+
+void	FFTRealGoertzel::store (DataType ptr [], VecType v)
+{
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		ptr [lane] = v._lane [lane];
+	}
+}
+
+FFTRealGoertzel::VecType	FFTRealGoertzel::set1 (DataType a)
+{
+	VecType			v;
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		v._lane [lane] = a;
+	}
+
+	return (v);
+}
+
+FFTRealGoertzel::VecType	FFTRealGoertzel::sub (VecType a, VecType b)
+{
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		a._lane [lane] -= b._lane [lane];
+	}
+
+	return (a);
+}
+
+FFTRealGoertzel::VecType	FFTRealGoertzel::mul_add (VecType a, VecType b, VecType c)
+{
+	for (int lane = 0; lane < NBR_LANES; ++lane)
+	{
+		c._lane [lane] += a._lane [lane] * b._lane [lane];
+	}
+
+	return (c);
+}
+
+#endif	// FFTRealGoertzel_SSE2
+
+
+
+// One sample of the recursion. x [n] - s [n - 2] does not depend on
+// s [n - 1], so only the multiply-add is on the critical path.
+void	FFTRealGoertzel::step (VecType &s1, VecType &s2, VecType c, VecType xv)
+{
+	const VecType	t = sub (xv, s2);
+	s2 = s1;
+	s1 = mul_add (c, s1, t);
+}
+
+
+
+// NBR_VEC vectors starting at lane ofs
+void	FFTRealGoertzel::process_vec_n (long ofs, const DataType x [], long nbr_spl)
+{
+	const VecType	c_0 = load (&_coef [ofs                ]);
+	const VecType	c_1 = load (&_coef [ofs + NBR_LANES    ]);
+	const VecType	c_2 = load (&_coef [ofs + NBR_LANES * 2]);
+	const VecType	c_3 = load (&_coef [ofs + NBR_LANES * 3]);
+	VecType			s1_0 = load (&_state_1 [ofs                ]);
+	VecType			s1_1 = load (&_state_1 [ofs + NBR_LANES    ]);
+	VecType			s1_2 = load (&_state_1 [ofs + NBR_LANES * 2]);
+	VecType			s1_3 = load (&_state_1 [ofs + NBR_LANES * 3]);
+	VecType			s2_0 = load (&_state_2 [ofs                ]);
+	VecType			s2_1 = load (&_state_2 [ofs + NBR_LANES    ]);
+	VecType			s2_2 = load (&_state_2 [ofs + NBR_LANES * 2]);
+	VecType			s2_3 = load (&_state_2 [ofs + NBR_LANES * 3]);
+
+	for (long pos = 0; pos < nbr_spl; ++pos)
+	{
+		const VecType	xv = set1 (x [pos]);
+		step (s1_0, s2_0, c_0, xv);
+		step (s1_1, s2_1, c_1, xv);
+		step (s1_2, s2_2, c_2, xv);
+		step (s1_3, s2_3, c_3, xv);
+	}
+
+	store (&_state_1 [ofs                ], s1_0);
+	store (&_state_1 [ofs + NBR_LANES    ], s1_1);
+	store (&_state_1 [ofs + NBR_LANES * 2], s1_2);
+	store (&_state_1 [ofs + NBR_LANES * 3], s1_3);
+	store (&_state_2 [ofs                ], s2_0);
+	store (&_state_2 [ofs + NBR_LANES    ], s2_1);
+	store (&_state_2 [ofs + NBR_LANES * 2], s2_2);
+	store (&_state_2 [ofs + NBR_LANES * 3], s2_3);
+}
+
+
+
+#if defined (FFTRealGoertzel_SSE2)
+
+void	FFTRealGoertzel::step_avx2 (__m256 &s1, __m256 &s2, __m256 c, __m256 xv)
+{
+	const __m256	t = _mm256_sub_ps (xv, s2);
+	s2 = s1;
+	s1 = _mm256_add_ps (_mm256_mul_ps (c, s1), t);
+}
+
+
+
+// Same as the generic code, with 8 lanes per vector
+void	FFTRealGoertzel::process_avx2 (const DataType x [], long nbr_spl)
+{
+	const long		avx_lanes = 8;
+
+	for (long ofs = 0; ofs < _nbr_lanes; ofs += NBR_VEC * avx_lanes)
+	{
+		const __m256	c_0 = _mm256_loadu_ps (&_coef [ofs                ]);
+		const __m256	c_1 = _mm256_loadu_ps (&_coef [ofs + avx_lanes    ]);
+		const __m256	c_2 = _mm256_loadu_ps (&_coef [ofs + avx_lanes * 2]);
+		const __m256	c_3 = _mm256_loadu_ps (&_coef [ofs + avx_lanes * 3]);
+		__m256			s1_0 = _mm256_loadu_ps (&_state_1 [ofs                ]);
+		__m256			s1_1 = _mm256_loadu_ps (&_state_1 [ofs + avx_lanes    ]);
+		__m256			s1_2 = _mm256_loadu_ps (&_state_1 [ofs + avx_lanes * 2]);
+		__m256			s1_3 = _mm256_loadu_ps (&_state_1 [ofs + avx_lanes * 3]);
+		__m256			s2_0 = _mm256_loadu_ps (&_state_2 [ofs                ]);
+		__m256			s2_1 = _mm256_loadu_ps (&_state_2 [ofs + avx_lanes    ]);
+		__m256			s2_2 = _mm256_loadu_ps (&_state_2 [ofs + avx_lanes * 2]);
+		__m256			s2_3 = _mm256_loadu_ps (&_state_2 [ofs + avx_lanes * 3]);
+
+		for (long pos = 0; pos < nbr_spl; ++pos)
+		{
+			const __m256	xv = _mm256_set1_ps (x [pos]);
+			step_avx2 (s1_0, s2_0, c_0, xv);
+			step_avx2 (s1_1, s2_1, c_1, xv);
+			step_avx2 (s1_2, s2_2, c_2, xv);
+			step_avx2 (s1_3, s2_3, c_3, xv);
+		}
+
+		_mm256_storeu_ps (&_state_1 [ofs                ], s1_0);
+		_mm256_storeu_ps (&_state_1 [ofs + avx_lanes    ], s1_1);
+		_mm256_storeu_ps (&_state_1 [ofs + avx_lanes * 2], s1_2);
+		_mm256_storeu_ps (&_state_1 [ofs + avx_lanes * 3], s1_3);
+		_mm256_storeu_ps (&_state_2 [ofs                ], s2_0);
+		_mm256_storeu_ps (&_state_2 [ofs + avx_lanes    ], s2_1);
+		_mm256_storeu_ps (&_state_2 [ofs + avx_lanes * 2], s2_2);
+		_mm256_storeu_ps (&_state_2 [ofs + avx_lanes * 3], s2_3);
+	}
+}
+
+#endif	// FFTRealGoertzel_SSE2
+
+
+
+#endif	// FFTRealGoertzel_CODEHEADER_INCLUDED
+
+#undef FFTRealGoertzel_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
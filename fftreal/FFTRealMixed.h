@@ -0,0 +1,168 @@
+/*****************************************************************************
+
+        FFTRealMixed.h
+
+Real FFT for lengths whose prime factors are 2, 3, 5 and 7 only, for
+instance 441 or 2205 (20 ms and 100 ms at 22050 Hz). The output uses the
+same half-complex layout as FFTReal, generalised to odd lengths:
+
+	f [0...length/2]             = real values of coefficients
+	                               0...length/2 (rounded down),
+	f [length/2+1...length-1]    = negative imaginary values of
+	                               coefficients 1...(length-1)/2.
+
+An even length is computed with a complex FFT of half the length, followed
+by a split step. The complex FFT is a Stockham autosort algorithm (no bit
+reversal, data ping-pongs between two buffers), with dedicated radix-2, 3,
+4 and 5 butterflies and a generic odd radix butterfly used for 7.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealMixed_HEADER_INCLUDED)
+#define	FFTRealMixed_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"Array.h"
+#include	"DynArray.h"
+#include	"FFTRealTable.h"
+
+
+
+template <class DT>
+class FFTRealMixed
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	enum {			MAX_RADIX		= 7	};
+	enum {			MAX_LENGTH		= 1L << 30	};	// So length can be represented as long int
+	enum {			MAX_NBR_STAGES	= 30	};
+
+	typedef	DT	DataType;
+
+	static bool		is_supported_length (long length);
+
+	explicit			FFTRealMixed (long length);
+	virtual			~FFTRealMixed () {}
+
+	long				get_length () const;
+	long				get_buffer_length () const;
+	void				do_fft (DataType f [], const DataType x []) const;
+	void				do_fft (DataType f [], const DataType x [], DataType buffer []) const;
+	void				do_ifft (const DataType f [], DataType x []) const;
+	void				do_ifft (const DataType f [], DataType x [], DataType buffer []) const;
+	void				rescale (DataType x []) const;
+	DataType *		use_buffer () const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	// Direction of the complex transforms, sign of the exponent is -DIR
+	enum {			DIR_DIRECT	=  1	};
+	enum {			DIR_INVERSE	= -1	};
+
+	class Stage
+	{
+	public:
+		int				_radix;
+		long				_stride;		// Product of the radices of the previous stages
+		long				_tw_index;	// Twiddle factors of the stage in the table
+	};
+
+	typedef	Array <Stage, MAX_NBR_STAGES>	StageArray;
+
+	static long		get_complex_length (long length);
+	static int		build_stages (StageArray &stage_arr, long length);
+	static long		get_table_size (long length);
+	static void		init_table (DataType table_ptr [], long size, long length);
+
+	template <int DIR>
+	inline int		compute_complex (DataType buffer []) const;
+	template <int DIR>
+	inline void		compute_stage (DataType dr [], DataType di [], const DataType sr [], const DataType si [], const Stage &stage) const;
+	template <int DIR>
+	inline void		compute_stage_2 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long s, long m, const DataType tw_ptr []) const;
+	template <int DIR>
+	inline void		compute_stage_3 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long s, long m, const DataType tw_ptr []) const;
+	template <int DIR>
+	inline void		compute_stage_4 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long s, long m, const DataType tw_ptr []) const;
+	template <int DIR>
+	inline void		compute_stage_5 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long s, long m, const DataType tw_ptr []) const;
+	template <int DIR>
+	inline void		compute_stage_odd (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long s, long m, int p, const DataType tw_ptr []) const;
+
+	FORCEINLINE static void
+						mul_twiddle (DataType &re, DataType &im, DataType c, DataType s);
+
+	const long		_length;
+	const long		_nbr_cplx;
+	StageArray		_stage_arr;
+	int				_nbr_stages;
+	FFTRealTable <DataType>
+						_table;
+	mutable DynArray <DataType>
+						_buffer;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealMixed ();
+						FFTRealMixed (const FFTRealMixed &other);
+	FFTRealMixed &	operator = (const FFTRealMixed &other);
+	bool				operator == (const FFTRealMixed &other);
+	bool				operator != (const FFTRealMixed &other);
+
+};	// class FFTRealMixed
+
+
+
+#include	"FFTRealMixed.hpp"
+
+
+
+#endif	// FFTRealMixed_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,986 @@
+/*****************************************************************************
+
+        FFTRealMixed.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealMixed_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealMixed code header.
+#endif
+#define	FFTRealMixed_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealMixed_CODEHEADER_INCLUDED)
+#define	FFTRealMixed_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: is_supported_length
+Description:
+	Tells if a length can be processed, that is if its prime factors are
+	only 2, 3, 5 and 7.
+Input parameters:
+	- length: number of points.
+Returns: true if the length is supported.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+bool	FFTRealMixed <DT>::is_supported_length (long length)
+{
+	if (length < 1 || length > MAX_LENGTH)
+	{
+		return (false);
+	}
+
+	static const int	radix_arr [] = { 2, 3, 5, 7 };
+	for (int i = 0; i < int (sizeof (radix_arr) / sizeof (radix_arr [0])); ++i)
+	{
+		while (length % radix_arr [i] == 0)
+		{
+			length /= radix_arr [i];
+		}
+	}
+
+	return (length == 1);
+}
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- length: length of the array on which we want to do a FFT. Range: > 0,
+		see is_supported_length ().
+	The twiddle factors are shared with the other objects of the same length
+	and type, see FFTRealTable.
+Throws: std::bad_alloc, std::system_error
+==============================================================================
+*/
+
+template <class DT>
+FFTRealMixed <DT>::FFTRealMixed (long length)
+:	_length (length)
+,	_nbr_cplx (get_complex_length (length))
+,	_stage_arr ()
+,	_nbr_stages (build_stages (_stage_arr, length))
+,	_table (&init_table, get_table_size (length), length)
+,	_buffer (_nbr_cplx * 4)
+{
+	assert (is_supported_length (length));
+}
+
+
+
+/*
+==============================================================================
+Name: get_length
+Description:
+	Returns the number of points processed by this FFT object.
+Returns: The number of points, > 0.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+long	FFTRealMixed <DT>::get_length () const
+{
+	return (_length);
+}
+
+
+
+/*
+==============================================================================
+Name: get_buffer_length
+Description:
+	Returns the number of elements of the scratch buffer used by do_fft ()
+	and do_ifft (), about twice the FFT length.
+Returns: The number of elements, > 0.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+long	FFTRealMixed <DT>::get_buffer_length () const
+{
+	return (_nbr_cplx * 4);
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Compute the FFT of the array. Uses the internal buffer: not reentrant.
+Input parameters:
+	- x: pointer on the source array (time).
+Output parameters:
+	- f: pointer on the destination array (frequencies).
+		f [0...length(x)/2] = real values,
+		f [length(x)/2+1...length(x)-1] = negative imaginary values of
+		coefficents 1...(length(x)-1)/2.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealMixed <DT>::do_fft (DataType f [], const DataType x []) const
+{
+	do_fft (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Same as do_fft (f, x), with a scratch buffer supplied by the caller.
+	Several threads can share the object if each one has its own buffer.
+Input parameters:
+	- x: pointer on the source array (time).
+Output parameters:
+	- f: pointer on the destination array (frequencies).
+Input/output parameters:
+	- buffer: scratch array, get_buffer_length () elements. Must be
+		different from x and f.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealMixed <DT>::do_fft (DataType f [], const DataType x [], DataType buffer []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+	assert (buffer != 0);
+	assert (buffer != f);
+	assert (buffer != x);
+
+	const long		nbr_cplx = _nbr_cplx;
+	DataType * const	re_ptr = buffer;
+	DataType * const	im_ptr = buffer + nbr_cplx;
+
+	// Even length: even and odd samples are packed as real and imaginary
+	// parts of a complex FFT of half the length.
+	if ((_length & 1) == 0)
+	{
+		for (long n = 0; n < nbr_cplx; ++n)
+		{
+			re_ptr [n] = x [n * 2    ];
+			im_ptr [n] = x [n * 2 + 1];
+		}
+	}
+	else
+	{
+		for (long n = 0; n < nbr_cplx; ++n)
+		{
+			re_ptr [n] = x [n];
+			im_ptr [n] = 0;
+		}
+	}
+
+	const int		res = compute_complex <DIR_DIRECT> (buffer);
+	const DataType * const	zr = buffer + res * 2 * nbr_cplx;
+	const DataType * const	zi = zr + nbr_cplx;
+
+	if ((_length & 1) == 0)
+	{
+		// Split step
+		const DataType * const	cos_ptr = &_table [0];
+		const DataType * const	sin_ptr = cos_ptr + nbr_cplx;
+		const DataType	half = DataType (0.5);
+
+		f [0       ] = zr [0] + zi [0];
+		f [nbr_cplx] = zr [0] - zi [0];
+		for (long k = 1; k < nbr_cplx; ++k)
+		{
+			const long		j = nbr_cplx - k;
+			const DataType	fe_r = (zr [k] + zr [j]) * half;
+			const DataType	fe_i = (zi [k] - zi [j]) * half;
+			const DataType	fo_r = (zi [k] + zi [j]) * half;
+			const DataType	fo_i = (zr [j] - zr [k]) * half;
+			const DataType	c = cos_ptr [k];
+			const DataType	s = sin_ptr [k];
+
+			f [k           ] =   fe_r + c * fo_r + s * fo_i;
+			f [nbr_cplx + k] = -(fe_i + c * fo_i - s * fo_r);
+		}
+	}
+	else
+	{
+		const long		h_len = _length >> 1;
+
+		f [0] = zr [0];
+		for (long k = 1; k <= h_len; ++k)
+		{
+			f [k        ] =  zr [k];
+			f [h_len + k] = -zi [k];
+		}
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: do_ifft
+Description:
+	Compute the inverse FFT of the array. Note that data must be post-scaled:
+	IFFT (FFT (x)) = x * length (x). Uses the internal buffer: not reentrant.
+Input parameters:
+	- f: pointer on the source array (frequencies), same layout as the
+		output of do_fft ().
+Output parameters:
+	- x: pointer on the destination array (time).
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealMixed <DT>::do_ifft (const DataType f [], DataType x []) const
+{
+	do_ifft (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_ifft
+Description:
+	Same as do_ifft (f, x), with a scratch buffer supplied by the caller.
+	Several threads can share the object if each one has its own buffer.
+Input parameters:
+	- f: pointer on the source array (frequencies).
+Output parameters:
+	- x: pointer on the destination array (time).
+Input/output parameters:
+	- buffer: scratch array, get_buffer_length () elements. Must be
+		different from x and f.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealMixed <DT>::do_ifft (const DataType f [], DataType x [], DataType buffer []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+	assert (buffer != 0);
+	assert (buffer != f);
+	assert (buffer != x);
+
+	const long		nbr_cplx = _nbr_cplx;
+	DataType * const	re_ptr = buffer;
+	DataType * const	im_ptr = buffer + nbr_cplx;
+
+	if ((_length & 1) == 0)
+	{
+		// Inverse split step: rebuilds the spectrum of the packed signal
+		const DataType * const	cos_ptr = &_table [0];
+		const DataType * const	sin_ptr = cos_ptr + nbr_cplx;
+
+		re_ptr [0] = f [0] + f [nbr_cplx];
+		im_ptr [0] = f [0] - f [nbr_cplx];
+		for (long k = 1; k < nbr_cplx; ++k)
+		{
+			const long		j = nbr_cplx - k;
+			const DataType	xr_k =  f [k];
+			const DataType	xi_k = -f [nbr_cplx + k];
+			const DataType	xr_j =  f [j];
+			const DataType	xi_j = -f [nbr_cplx + j];
+			const DataType	a_r = xr_k + xr_j;
+			const DataType	a_i = xi_k - xi_j;
+			const DataType	b_r = xr_k - xr_j;
+			const DataType	b_i = xi_k + xi_j;
+			const DataType	c = cos_ptr [k];
+			const DataType	s = sin_ptr [k];
+
+			re_ptr [k] = a_r - (c * b_i + s * b_r);
+			im_ptr [k] = a_i + (c * b_r - s * b_i);
+		}
+	}
+	else
+	{
+		// Rebuilds the whole hermitian spectrum
+		const long		h_len = _length >> 1;
+
+		re_ptr [0] = f [0];
+		im_ptr [0] = 0;
+		for (long k = 1; k <= h_len; ++k)
+		{
+			re_ptr [k          ] =  f [k];
+			im_ptr [k          ] = -f [h_len + k];
+			re_ptr [_length - k] =  f [k];
+			im_ptr [_length - k] =  f [h_len + k];
+		}
+	}
+
+	const int		res = compute_complex <DIR_INVERSE> (buffer);
+	const DataType * const	zr = buffer + res * 2 * nbr_cplx;
+	const DataType * const	zi = zr + nbr_cplx;
+
+	if ((_length & 1) == 0)
+	{
+		for (long n = 0; n < nbr_cplx; ++n)
+		{
+			x [n * 2    ] = zr [n];
+			x [n * 2 + 1] = zi [n];
+		}
+	}
+	else
+	{
+		for (long n = 0; n < nbr_cplx; ++n)
+		{
+			x [n] = zr [n];
+		}
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: rescale
+Description:
+	Scale an array by divide each element by its length. This function should
+	be called after FFT + IFFT.
+Input parameters:
+	- x: pointer on array to rescale (time or frequency).
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealMixed <DT>::rescale (DataType x []) const
+{
+	const DataType	mul = DataType (1.0 / _length);
+
+	for (long i = 0; i < _length; ++i)
+	{
+		x [i] *= mul;
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: use_buffer
+Description:
+	Access the internal buffer, get_buffer_length () elements.
+	Buffer content will be erased at each do_fft() / do_ifft() call without
+	explicit scratch buffer!
+Returns:
+	Buffer start address
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+typename FFTRealMixed <DT>::DataType *	FFTRealMixed <DT>::use_buffer () const
+{
+	return (&_buffer [0]);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+long	FFTRealMixed <DT>::get_complex_length (long length)
+{
+	return (((length & 1) == 0) ? length >> 1 : length);
+}
+
+
+
+// Factorises the complex length, radix 4 first. Returns the number of
+// stages. The table starts with the split step factors (even lengths only),
+// followed by the blocks of each stage:
+//	cos, then sin of 2*PI*q*j/(m*p), q in [0 ; m[, j in [1 ; p[
+//	cos, then sin of 2*PI*k/p, k in [0 ; p[ (roots for the odd radices)
+template <class DT>
+int	FFTRealMixed <DT>::build_stages (StageArray &stage_arr, long length)
+{
+	const long		nbr_cplx = get_complex_length (length);
+	long				rem = nbr_cplx;
+	long				stride = 1;
+	long				tw_index = ((length & 1) == 0) ? nbr_cplx * 2 : 0;
+	int				nbr_stages = 0;
+
+	while (rem > 1)
+	{
+		int				radix;
+		if      (rem % 4 == 0) { radix = 4; }
+		else if (rem % 2 == 0) { radix = 2; }
+		else if (rem % 3 == 0) { radix = 3; }
+		else if (rem % 5 == 0) { radix = 5; }
+		else if (rem % 7 == 0) { radix = 7; }
+		else
+		{
+			assert (false);	// Unsupported length
+			break;
+		}
+		assert (nbr_stages < MAX_NBR_STAGES);
+
+		const long		m = rem / radix;
+		Stage &			stage = stage_arr [nbr_stages];
+		stage._radix = radix;
+		stage._stride = stride;
+		stage._tw_index = tw_index;
+
+		tw_index += (m * (radix - 1) + radix) * 2;
+		stride *= radix;
+		rem = m;
+		++ nbr_stages;
+	}
+
+	return (nbr_stages);
+}
+
+
+
+template <class DT>
+long	FFTRealMixed <DT>::get_table_size (long length)
+{
+	StageArray		stage_arr;
+	const int		nbr_stages = build_stages (stage_arr, length);
+	if (nbr_stages == 0)
+	{
+		return (((length & 1) == 0) ? get_complex_length (length) * 2 : 0);
+	}
+
+	const Stage &	last = stage_arr [nbr_stages - 1];
+	const long		radix = last._radix;
+	const long		m = get_complex_length (length) / (last._stride * radix);
+
+	return (last._tw_index + (m * (radix - 1) + radix) * 2);
+}
+
+
+
+template <class DT>
+void	FFTRealMixed <DT>::init_table (DataType table_ptr [], long size, long length)
+{
+	using namespace std;
+
+	assert (size == get_table_size (length));
+
+	const long		nbr_cplx = get_complex_length (length);
+	if ((length & 1) == 0)
+	{
+		const double	mul = (2 * PI) / length;
+		for (long k = 0; k < nbr_cplx; ++k)
+		{
+			table_ptr [           k] = DataType (cos (k * mul));
+			table_ptr [nbr_cplx + k] = DataType (sin (k * mul));
+		}
+	}
+
+	StageArray		stage_arr;
+	const int		nbr_stages = build_stages (stage_arr, length);
+	for (int stage_cnt = 0; stage_cnt < nbr_stages; ++stage_cnt)
+	{
+		const Stage &	stage = stage_arr [stage_cnt];
+		const long		radix = stage._radix;
+		const long		m = nbr_cplx / (stage._stride * radix);
+		const long		len = m * radix;
+		const long		nbr_tw = m * (radix - 1);
+		DataType * const	tw_ptr = table_ptr + stage._tw_index;
+
+		const double	mul = (2 * PI) / len;
+		for (long q = 0; q < m; ++q)
+		{
+			for (long j = 1; j < radix; ++j)
+			{
+				const long		pos = q * (radix - 1) + j - 1;
+				const double	angle = ((q * j) % len) * mul;
+				tw_ptr [         pos] = DataType (cos (angle));
+				tw_ptr [nbr_tw + pos] = DataType (sin (angle));
+			}
+		}
+
+		DataType * const	root_ptr = tw_ptr + nbr_tw * 2;
+		for (long k = 0; k < radix; ++k)
+		{
+			const double	angle = (2 * PI * k) / radix;
+			root_ptr [        k] = DataType (cos (angle));
+			root_ptr [radix + k] = DataType (sin (angle));
+		}
+	}
+}
+
+
+
+// Transforms the complex data held in buffer, real parts followed by
+// imaginary parts. Returns the half of the buffer containing the result.
+template <class DT>
+template <int DIR>
+int	FFTRealMixed <DT>::compute_complex (DataType buffer []) const
+{
+	const long		nbr_cplx = _nbr_cplx;
+	DataType *		sr = buffer;
+	DataType *		si = buffer + nbr_cplx;
+	DataType *		dr = buffer + nbr_cplx * 2;
+	DataType *		di = buffer + nbr_cplx * 3;
+	int				res = 0;
+
+	for (int stage_cnt = 0; stage_cnt < _nbr_stages; ++stage_cnt)
+	{
+		compute_stage <DIR> (dr, di, sr, si, _stage_arr [stage_cnt]);
+
+		DataType * const	tr = sr;
+		DataType * const	ti = si;
+		sr = dr;
+		si = di;
+		dr = tr;
+		di = ti;
+		res ^= 1;
+	}
+
+	return (res);
+}
+
+
+
+// Stockham stage: s interleaved DFTs of length m*p. For each q and t,
+// reads x [t + s * (q + r * m)], r in [0 ; p[, and writes the twiddled
+// butterfly output to y [t + s * (q * p + j)], j in [0 ; p[.
+template <class DT>
+template <int DIR>
+void	FFTRealMixed <DT>::compute_stage (DataType dr [], DataType di [], const DataType sr [], const DataType si [], const Stage &stage) const
+{
+	const long		s = stage._stride;
+	const long		m = _nbr_cplx / (s * stage._radix);
+	const DataType * const	tw_ptr = &_table [stage._tw_index];
+
+	switch (stage._radix)
+	{
+	case	2:
+		compute_stage_2 <DIR> (dr, di, sr, si, s, m, tw_ptr);
+		break;
+	case	3:
+		compute_stage_3 <DIR> (dr, di, sr, si, s, m, tw_ptr);
+		break;
+	case	4:
+		compute_stage_4 <DIR> (dr, di, sr, si, s, m, tw_ptr);
+		break;
+	case	5:
+		compute_stage_5 <DIR> (dr, di, sr, si, s, m, tw_ptr);
+		break;
+	default:
+		compute_stage_odd <DIR> (dr, di, sr, si, s, m, stage._radix, tw_ptr);
+		break;
+	}
+}
+
+
+
+template <class DT>
+template <int DIR>
+void	FFTRealMixed <DT>::compute_stage_2 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long s, long m, const DataType tw_ptr []) const
+{
+	const DataType * const	cos_ptr = tw_ptr;
+	const DataType * const	sin_ptr = tw_ptr + m;
+
+	for (long q = 0; q < m; ++q)
+	{
+		const DataType	c1 = cos_ptr [q];
+		const DataType	s1 = sin_ptr [q] * DIR;
+
+		const DataType * const	s0r = sr + s * q;
+		const DataType * const	s0i = si + s * q;
+		const DataType * const	s1r = s0r + s * m;
+		const DataType * const	s1i = s0i + s * m;
+		DataType * const	d0r = dr + s * q * 2;
+		DataType * const	d0i = di + s * q * 2;
+		DataType * const	d1r = d0r + s;
+		DataType * const	d1i = d0i + s;
+
+		for (long t = 0; t < s; ++t)
+		{
+			DataType			br = s0r [t] - s1r [t];
+			DataType			bi = s0i [t] - s1i [t];
+			d0r [t] = s0r [t] + s1r [t];
+			d0i [t] = s0i [t] + s1i [t];
+			mul_twiddle (br, bi, c1, s1);
+			d1r [t] = br;
+			d1i [t] = bi;
+		}
+	}
+}
+
+
+
+template <class DT>
+template <int DIR>
+void	FFTRealMixed <DT>::compute_stage_3 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long s, long m, const DataType tw_ptr []) const
+{
+	const DataType	sin_60 = DataType (0.86602540378443864676);
+	const DataType	d = DataType (DIR);
+	const DataType * const	cos_ptr = tw_ptr;
+	const DataType * const	sin_ptr = tw_ptr + m * 2;
+
+	for (long q = 0; q < m; ++q)
+	{
+		const DataType	c1 = cos_ptr [q * 2    ];
+		const DataType	c2 = cos_ptr [q * 2 + 1];
+		const DataType	s1 = sin_ptr [q * 2    ] * d;
+		const DataType	s2 = sin_ptr [q * 2 + 1] * d;
+
+		const long		sm = s * m;
+		const DataType * const	s0r = sr + s * q;
+		const DataType * const	s0i = si + s * q;
+		DataType * const	d0r = dr + s * q * 3;
+		DataType * const	d0i = di + s * q * 3;
+
+		for (long t = 0; t < s; ++t)
+		{
+			const DataType	a0r = s0r [t];
+			const DataType	a0i = s0i [t];
+			const DataType	a1r = s0r [t + sm];
+			const DataType	a1i = s0i [t + sm];
+			const DataType	a2r = s0r [t + sm * 2];
+			const DataType	a2i = s0i [t + sm * 2];
+
+			const DataType	t1r = a1r + a2r;
+			const DataType	t1i = a1i + a2i;
+			const DataType	t2r = a0r - t1r * DataType (0.5);
+			const DataType	t2i = a0i - t1i * DataType (0.5);
+			const DataType	t3r = (a1r - a2r) * sin_60;
+			const DataType	t3i = (a1i - a2i) * sin_60;
+
+			DataType			y1r = t2r + d * t3i;
+			DataType			y1i = t2i - d * t3r;
+			DataType			y2r = t2r - d * t3i;
+			DataType			y2i = t2i + d * t3r;
+			mul_twiddle (y1r, y1i, c1, s1);
+			mul_twiddle (y2r, y2i, c2, s2);
+
+			d0r [t        ] = a0r + t1r;
+			d0i [t        ] = a0i + t1i;
+			d0r [t + s    ] = y1r;
+			d0i [t + s    ] = y1i;
+			d0r [t + s * 2] = y2r;
+			d0i [t + s * 2] = y2i;
+		}
+	}
+}
+
+
+
+template <class DT>
+template <int DIR>
+void	FFTRealMixed <DT>::compute_stage_4 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long s, long m, const DataType tw_ptr []) const
+{
+	const DataType	d = DataType (DIR);
+	const DataType * const	cos_ptr = tw_ptr;
+	const DataType * const	sin_ptr = tw_ptr + m * 3;
+
+	for (long q = 0; q < m; ++q)
+	{
+		const DataType	c1 = cos_ptr [q * 3    ];
+		const DataType	c2 = cos_ptr [q * 3 + 1];
+		const DataType	c3 = cos_ptr [q * 3 + 2];
+		const DataType	s1 = sin_ptr [q * 3    ] * d;
+		const DataType	s2 = sin_ptr [q * 3 + 1] * d;
+		const DataType	s3 = sin_ptr [q * 3 + 2] * d;
+
+		const long		sm = s * m;
+		const DataType * const	s0r = sr + s * q;
+		const DataType * const	s0i = si + s * q;
+		DataType * const	d0r = dr + s * q * 4;
+		DataType * const	d0i = di + s * q * 4;
+
+		for (long t = 0; t < s; ++t)
+		{
+			const DataType	a0r = s0r [t];
+			const DataType	a0i = s0i [t];
+			const DataType	a1r = s0r [t + sm];
+			const DataType	a1i = s0i [t + sm];
+			const DataType	a2r = s0r [t + sm * 2];
+			const DataType	a2i = s0i [t + sm * 2];
+			const DataType	a3r = s0r [t + sm * 3];
+			const DataType	a3i = s0i [t + sm * 3];
+
+			const DataType	t0r = a0r + a2r;
+			const DataType	t0i = a0i + a2i;
+			const DataType	t1r = a0r - a2r;
+			const DataType	t1i = a0i - a2i;
+			const DataType	t2r = a1r + a3r;
+			const DataType	t2i = a1i + a3i;
+			const DataType	t3r = a1r - a3r;
+			const DataType	t3i = a1i - a3i;
+
+			DataType			y1r = t1r + d * t3i;
+			DataType			y1i = t1i - d * t3r;
+			DataType			y2r = t0r - t2r;
+			DataType			y2i = t0i - t2i;
+			DataType			y3r = t1r - d * t3i;
+			DataType			y3i = t1i + d * t3r;
+			mul_twiddle (y1r, y1i, c1, s1);
+			mul_twiddle (y2r, y2i, c2, s2);
+			mul_twiddle (y3r, y3i, c3, s3);
+
+			d0r [t        ] = t0r + t2r;
+			d0i [t        ] = t0i + t2i;
+			d0r [t + s    ] = y1r;
+			d0i [t + s    ] = y1i;
+			d0r [t + s * 2] = y2r;
+			d0i [t + s * 2] = y2i;
+			d0r [t + s * 3] = y3r;
+			d0i [t + s * 3] = y3i;
+		}
+	}
+}
+
+
+
+template <class DT>
+template <int DIR>
+void	FFTRealMixed <DT>::compute_stage_5 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long s, long m, const DataType tw_ptr []) const
+{
+	const DataType	cos_72  = DataType ( 0.30901699437494742410);
+	const DataType	cos_144 = DataType (-0.80901699437494742410);
+	const DataType	sin_72  = DataType ( 0.95105651629515357212);
+	const DataType	sin_144 = DataType ( 0.58778525229247312917);
+	const DataType	d = DataType (DIR);
+	const DataType * const	cos_ptr = tw_ptr;
+	const DataType * const	sin_ptr = tw_ptr + m * 4;
+
+	for (long q = 0; q < m; ++q)
+	{
+		const DataType	c1 = cos_ptr [q * 4    ];
+		const DataType	c2 = cos_ptr [q * 4 + 1];
+		const DataType	c3 = cos_ptr [q * 4 + 2];
+		const DataType	c4 = cos_ptr [q * 4 + 3];
+		const DataType	s1 = sin_ptr [q * 4    ] * d;
+		const DataType	s2 = sin_ptr [q * 4 + 1] * d;
+		const DataType	s3 = sin_ptr [q * 4 + 2] * d;
+		const DataType	s4 = sin_ptr [q * 4 + 3] * d;
+
+		const long		sm = s * m;
+		const DataType * const	s0r = sr + s * q;
+		const DataType * const	s0i = si + s * q;
+		DataType * const	d0r = dr + s * q * 5;
+		DataType * const	d0i = di + s * q * 5;
+
+		for (long t = 0; t < s; ++t)
+		{
+			const DataType	a0r = s0r [t];
+			const DataType	a0i = s0i [t];
+			const DataType	a1r = s0r [t + sm];
+			const DataType	a1i = s0i [t + sm];
+			const DataType	a2r = s0r [t + sm * 2];
+			const DataType	a2i = s0i [t + sm * 2];
+			const DataType	a3r = s0r [t + sm * 3];
+			const DataType	a3i = s0i [t + sm * 3];
+			const DataType	a4r = s0r [t + sm * 4];
+			const DataType	a4i = s0i [t + sm * 4];
+
+			const DataType	b1r = a1r + a4r;
+			const DataType	b1i = a1i + a4i;
+			const DataType	b2r = a2r + a3r;
+			const DataType	b2i = a2i + a3i;
+			const DataType	e1r = a1r - a4r;
+			const DataType	e1i = a1i - a4i;
+			const DataType	e2r = a2r - a3r;
+			const DataType	e2i = a2i - a3i;
+
+			const DataType	t1r = a0r + cos_72 * b1r + cos_144 * b2r;
+			const DataType	t1i = a0i + cos_72 * b1i + cos_144 * b2i;
+			const DataType	t2r = a0r + cos_144 * b1r + cos_72 * b2r;
+			const DataType	t2i = a0i + cos_144 * b1i + cos_72 * b2i;
+			const DataType	u1r = sin_72 * e1r + sin_144 * e2r;
+			const DataType	u1i = sin_72 * e1i + sin_144 * e2i;
+			const DataType	u2r = sin_144 * e1r - sin_72 * e2r;
+			const DataType	u2i = sin_144 * e1i - sin_72 * e2i;
+
+			DataType			y1r = t1r + d * u1i;
+			DataType			y1i = t1i - d * u1r;
+			DataType			y4r = t1r - d * u1i;
+			DataType			y4i = t1i + d * u1r;
+			DataType			y2r = t2r + d * u2i;
+			DataType			y2i = t2i - d * u2r;
+			DataType			y3r = t2r - d * u2i;
+			DataType			y3i = t2i + d * u2r;
+			mul_twiddle (y1r, y1i, c1, s1);
+			mul_twiddle (y2r, y2i, c2, s2);
+			mul_twiddle (y3r, y3i, c3, s3);
+			mul_twiddle (y4r, y4i, c4, s4);
+
+			d0r [t        ] = a0r + b1r + b2r;
+			d0i [t        ] = a0i + b1i + b2i;
+			d0r [t + s    ] = y1r;
+			d0i [t + s    ] = y1i;
+			d0r [t + s * 2] = y2r;
+			d0i [t + s * 2] = y2i;
+			d0r [t + s * 3] = y3r;
+			d0i [t + s * 3] = y3i;
+			d0r [t + s * 4] = y4r;
+			d0i [t + s * 4] = y4i;
+		}
+	}
+}
+
+
+
+// Any odd radix up to MAX_RADIX. Inputs r and p - r are combined so only
+// half of the products are computed.
+template <class DT>
+template <int DIR>
+void	FFTRealMixed <DT>::compute_stage_odd (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long s, long m, int p, const DataType tw_ptr []) const
+{
+	assert ((p & 1) != 0);
+	assert (p <= MAX_RADIX);
+
+	const DataType	d = DataType (DIR);
+	const int		h_p = p >> 1;
+	const long		nbr_tw = m * (p - 1);
+	const DataType * const	cos_ptr = tw_ptr;
+	const DataType * const	sin_ptr = tw_ptr + nbr_tw;
+	const DataType * const	root_cos_ptr = tw_ptr + nbr_tw * 2;
+	const DataType * const	root_sin_ptr = root_cos_ptr + p;
+
+	for (long q = 0; q < m; ++q)
+	{
+		DataType			wc [MAX_RADIX];
+		DataType			ws [MAX_RADIX];
+		for (int j = 1; j < p; ++j)
+		{
+			wc [j] = cos_ptr [q * (p - 1) + j - 1];
+			ws [j] = sin_ptr [q * (p - 1) + j - 1] * d;
+		}
+
+		const long		sm = s * m;
+		const DataType * const	s0r = sr + s * q;
+		const DataType * const	s0i = si + s * q;
+		DataType * const	d0r = dr + s * q * p;
+		DataType * const	d0i = di + s * q * p;
+
+		for (long t = 0; t < s; ++t)
+		{
+			DataType			pr [MAX_RADIX / 2 + 1];
+			DataType			pi [MAX_RADIX / 2 + 1];
+			DataType			mr [MAX_RADIX / 2 + 1];
+			DataType			mi [MAX_RADIX / 2 + 1];
+			const DataType	a0r = s0r [t];
+			const DataType	a0i = s0i [t];
+			DataType			y0r = a0r;
+			DataType			y0i = a0i;
+			for (int r = 1; r <= h_p; ++r)
+			{
+				const DataType	ar = s0r [t + sm * r];
+				const DataType	ai = s0i [t + sm * r];
+				const DataType	br = s0r [t + sm * (p - r)];
+				const DataType	bi = s0i [t + sm * (p - r)];
+				pr [r] = ar + br;
+				pi [r] = ai + bi;
+				mr [r] = ar - br;
+				mi [r] = ai - bi;
+				y0r += pr [r];
+				y0i += pi [r];
+			}
+			d0r [t] = y0r;
+			d0i [t] = y0i;
+
+			for (int j = 1; j <= h_p; ++j)
+			{
+				DataType			sum_r = a0r;
+				DataType			sum_i = a0i;
+				DataType			alt_r = 0;
+				DataType			alt_i = 0;
+				int				k = 0;
+				for (int r = 1; r <= h_p; ++r)
+				{
+					k += j;
+					if (k >= p)
+					{
+						k -= p;
+					}
+					sum_r += pr [r] * root_cos_ptr [k];
+					sum_i += pi [r] * root_cos_ptr [k];
+					alt_r += mr [r] * root_sin_ptr [k];
+					alt_i += mi [r] * root_sin_ptr [k];
+				}
+
+				DataType			yjr = sum_r + d * alt_i;
+				DataType			yji = sum_i - d * alt_r;
+				DataType			ykr = sum_r - d * alt_i;
+				DataType			yki = sum_i + d * alt_r;
+				mul_twiddle (yjr, yji, wc [j    ], ws [j    ]);
+				mul_twiddle (ykr, yki, wc [p - j], ws [p - j]);
+
+				d0r [t + s *  j     ] = yjr;
+				d0i [t + s *  j     ] = yji;
+				d0r [t + s * (p - j)] = ykr;
+				d0i [t + s * (p - j)] = yki;
+			}
+		}
+	}
+}
+
+
+
+// Multiplies (re, im) by (c - i * s)
+template <class DT>
+void	FFTRealMixed <DT>::mul_twiddle (DataType &re, DataType &im, DataType c, DataType s)
+{
+	const DataType	tmp = re * c + im * s;
+	im = im * c - re * s;
+	re = tmp;
+}
+
+
+
+#endif	// FFTRealMixed_CODEHEADER_INCLUDED
+
+#undef FFTRealMixed_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -52,8 +52,21 @@ public:
    typedef	FFTRealFixLenParam::DataType	DataType;
 	typedef	OscSinCos <DataType>	OscType;
 
+	// XR: source of the time-domain data, read by the first pass only.
+	// Either const DataType * or a class with an operator [] (long) const
+	// returning DataType, like FFTRealPcm16Reader.
+	// x_len: number of leading samples of x_ptr which can be non-zero, the
+	// others must be null. When it is short enough, the first passes are
+	// replaced by FFTRealBitRev::direct_pass_spread (). Use len if unknown.
+	// max_bin: last bin of the spectrum needed. The butterflies feeding only
+	// the bins above are skipped, and these bins are left undefined. Use
+	// len/2 for the whole spectrum.
+	template <class XR>
 	FORCEINLINE static void
-						process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType x_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list []);
+						process (long len, DataType dest_ptr [], DataType src_ptr [], XR x_ptr, const DataType cos_ptr [], long cos_len, const DataType tw_ptr [], const long br_ptr [], OscType osc_list [], long x_len, long max_bin);
+	template <class XR>
+	FORCEINLINE static void
+						process_power (long len, DataType p_ptr [], DataType dest_ptr [], DataType src_ptr [], XR x_ptr, const DataType cos_ptr [], long cos_len, const DataType tw_ptr [], const long br_ptr [], OscType osc_list [], long x_len, long max_bin);
 
 
 
@@ -67,6 +80,11 @@ protected:
 
 private:
 
+	FORCEINLINE static void
+						process_radix_4 (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, const DataType tw_ptr [], long max_bin);
+	FORCEINLINE static long
+						get_butterfly_end (long dist, long max_bin);
+
 
 
 /*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -35,8 +35,12 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
+#include	"FFTRealBitRev.h"
+#include	"FFTRealSimd.h"
 #include	"FFTRealUseTrigo.h"
 
+#include	<cassert>
+
 
 
 /*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -44,9 +48,22 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 
 template <>
-void	FFTRealPassDirect <1>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType x_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+template <class XR>
+void	FFTRealPassDirect <1>::process (long len, DataType dest_ptr [], DataType /*src_ptr*/ [], XR x_ptr, const DataType /*cos_ptr*/ [], long /*cos_len*/, const DataType /*tw_ptr*/ [], const long br_ptr [], OscType /*osc_list*/ [], long /*x_len*/, long /*max_bin*/)
 {
 	// First and second pass at once
+	if (len >= (1L << FFTRealBitRev::MIN_NBR_BITS))
+	{
+		FFTRealBitRev::direct_pass_1_2 (len, dest_ptr, x_ptr);
+		return;
+	}
+
+	if (len >= 16 && FFTRealSimd::get_isa () != FFTRealSimd::Isa_SCALAR)
+	{
+		FFTRealSimd::direct_pass_1_2 (len, dest_ptr, x_ptr, br_ptr);
+		return;
+	}
+
 	const long		qlen = len >> 2;
 
 	long				coef_index = 0;
@@ -74,8 +91,16 @@ void	FFTRealPassDirect <1>::process (long len, DataType dest_ptr [], DataType sr
 }
 
 template <>
-void	FFTRealPassDirect <2>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType x_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+template <class XR>
+void	FFTRealPassDirect <2>::process (long len, DataType dest_ptr [], DataType src_ptr [], XR x_ptr, const DataType cos_ptr [], long cos_len, const DataType tw_ptr [], const long br_ptr [], OscType osc_list [], long x_len, long max_bin)
 {
+	// Zero-padded source: only spreads single samples up to this pass
+	if (x_len <= (len >> 3))
+	{
+		FFTRealBitRev::direct_pass_spread (len, dest_ptr, x_ptr, 3);
+		return;
+	}
+
 	// Executes "previous" passes first. Inverts source and destination buffers
 	FFTRealPassDirect <1>::process (
 		len,
@@ -84,11 +109,20 @@ void	FFTRealPassDirect <2>::process (long len, DataType dest_ptr [], DataType sr
 		x_ptr,
 		cos_ptr,
 		cos_len,
+		tw_ptr,
 		br_ptr,
-		osc_list
+		osc_list,
+		x_len,
+		max_bin
 	);
 
 	// Third pass
+	if (len >= 32 && FFTRealSimd::get_isa () != FFTRealSimd::Isa_SCALAR)
+	{
+		FFTRealSimd::direct_pass_3 (len, dest_ptr, src_ptr);
+		return;
+	}
+
 	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
 
 	long				coef_index = 0;
@@ -115,20 +149,46 @@ void	FFTRealPassDirect <2>::process (long len, DataType dest_ptr [], DataType sr
 }
 
 template <int PASS>
-void	FFTRealPassDirect <PASS>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType x_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+template <class XR>
+void	FFTRealPassDirect <PASS>::process (long len, DataType dest_ptr [], DataType src_ptr [], XR x_ptr, const DataType cos_ptr [], long cos_len, const DataType tw_ptr [], const long br_ptr [], OscType osc_list [], long x_len, long max_bin)
 {
+   enum {	TRIGO_OSC		= PASS - FFTRealFixLenParam::TRIGO_BD_LIMIT	};
+	enum {	TRIGO_DIRECT	= (TRIGO_OSC >= 0) ? 1 : 0	};
+
+	// Two table-based generic passes, PASS - 1 and PASS, are done at once
+	// (radix 4), halving the number of sweeps over the data. Pairs are
+	// taken from the last pass down. The first passes have too few
+	// coefficients per block to benefit from it and stay radix 2.
+	enum {	RADIX_4			= (PASS >= 6 && TRIGO_DIRECT == 0) ? 1 : 0	};
+
+	// Zero-padded source: only spreads single samples up to this pass
+	if (x_len <= (len >> (PASS + 1)))
+	{
+		FFTRealBitRev::direct_pass_spread (len, dest_ptr, x_ptr, PASS + 1);
+		return;
+	}
+
 	// Executes "previous" passes first. Inverts source and destination buffers
-	FFTRealPassDirect <PASS - 1>::process (
+	FFTRealPassDirect <PASS - 1 - RADIX_4>::process (
 		len,
 		src_ptr,
 		dest_ptr,
 		x_ptr,
 		cos_ptr,
 		cos_len,
+		tw_ptr,
 		br_ptr,
-		osc_list
+		osc_list,
+		x_len,
+		max_bin
 	);
 
+	if (RADIX_4 != 0)
+	{
+		process_radix_4 (len, dest_ptr, src_ptr, cos_ptr, cos_len, tw_ptr, max_bin);
+		return;
+	}
+
 	const long		dist = 1L << (PASS - 1);
 	const long		c1_r = 0;
 	const long		c1_i = dist;
@@ -136,9 +196,21 @@ void	FFTRealPassDirect <PASS>::process (long len, DataType dest_ptr [], DataType
 	const long		c2_i = dist * 3;
 	const long		cend = dist * 4;
 	const long		table_step = cos_len >> (PASS - 1);
+	const long		i_end = get_butterfly_end (dist, max_bin);
 
-   enum {	TRIGO_OSC		= PASS - FFTRealFixLenParam::TRIGO_BD_LIMIT	};
-	enum {	TRIGO_DIRECT	= (TRIGO_OSC >= 0) ? 1 : 0	};
+	// Vector version available for the table-based passes only
+	if (TRIGO_DIRECT == 0 && FFTRealSimd::get_isa () != FFTRealSimd::Isa_SCALAR)
+	{
+		FFTRealSimd::direct_pass_n (
+			len,
+			dest_ptr,
+			src_ptr,
+			dist,
+			i_end,
+			FFTRealSimd::use_twiddles (tw_ptr, PASS)
+		);
+		return;
+	}
 
 	long				coef_index = 0;
 	do
@@ -155,7 +227,7 @@ void	FFTRealPassDirect <PASS>::process (long len, DataType dest_ptr [], DataType
 		FFTRealUseTrigo <TRIGO_DIRECT>::prepare (osc_list [TRIGO_OSC]);
 
 		// Others are conjugate complex numbers
-		for (long i = 1; i < dist; ++ i)
+		for (long i = 1; i < i_end; ++ i)
 		{
 			DataType			c;
 			DataType			s;
@@ -187,6 +259,94 @@ void	FFTRealPassDirect <PASS>::process (long len, DataType dest_ptr [], DataType
 
 
 
+// Last pass only, for a single block. Previous passes leave their result in
+// src_ptr; the butterflies write |X[k]|^2 into p_ptr [0...len/2] instead of
+// the half-complex spectrum.
+template <int PASS>
+template <class XR>
+void	FFTRealPassDirect <PASS>::process_power (long len, DataType p_ptr [], DataType dest_ptr [], DataType src_ptr [], XR x_ptr, const DataType cos_ptr [], long cos_len, const DataType tw_ptr [], const long br_ptr [], OscType osc_list [], long x_len, long max_bin)
+{
+	FFTRealPassDirect <PASS - 1>::process (
+		len,
+		src_ptr,
+		dest_ptr,
+		x_ptr,
+		cos_ptr,
+		cos_len,
+		tw_ptr,
+		br_ptr,
+		osc_list,
+		x_len,
+		max_bin
+	);
+
+	const long		dist = 1L << (PASS - 1);
+	const long		c1_r = 0;
+	const long		c1_i = dist;
+	const long		c2_r = dist * 2;
+	const long		c2_i = dist * 3;
+	const long		table_step = cos_len >> (PASS - 1);
+	const long		i_end = get_butterfly_end (dist, max_bin);
+
+	assert (len == dist * 4);
+
+   enum {	TRIGO_OSC		= PASS - FFTRealFixLenParam::TRIGO_BD_LIMIT	};
+	enum {	TRIGO_DIRECT	= (TRIGO_OSC >= 0) ? 1 : 0	};
+
+	if (TRIGO_DIRECT == 0 && FFTRealSimd::get_isa () != FFTRealSimd::Isa_SCALAR)
+	{
+		FFTRealSimd::direct_pass_power (
+			len,
+			p_ptr,
+			src_ptr,
+			i_end,
+			FFTRealSimd::use_twiddles (tw_ptr, PASS)
+		);
+		return;
+	}
+
+	const DataType * const	sf = src_ptr;
+
+	// Extreme coefficients are always real
+	const DataType	dc = sf [c1_r] + sf [c2_r];
+	const DataType	ny = sf [c1_r] - sf [c2_r];
+	p_ptr [c1_r] = dc * dc;
+	p_ptr [c2_r] = ny * ny;
+	p_ptr [c1_i] = sf [c1_i] * sf [c1_i] + sf [c2_i] * sf [c2_i];
+
+	FFTRealUseTrigo <TRIGO_DIRECT>::prepare (osc_list [TRIGO_OSC]);
+
+	// Others are conjugate complex numbers
+	for (long i = 1; i < i_end; ++ i)
+	{
+		DataType			c;
+		DataType			s;
+		FFTRealUseTrigo <TRIGO_DIRECT>::iterate (
+			osc_list [TRIGO_OSC],
+			c,
+			s,
+			cos_ptr,
+			i * table_step,
+			(dist - i) * table_step
+		);
+
+		const DataType	sf_r_i = sf [c1_r + i];
+		const DataType	sf_i_i = sf [c1_i + i];
+
+		const DataType	v1 = sf [c2_r + i] * c - sf [c2_i + i] * s;
+		const DataType	v2 = sf [c2_r + i] * s + sf [c2_i + i] * c;
+
+		const DataType	re_1 = sf_r_i + v1;
+		const DataType	im_1 = v2 + sf_i_i;
+		const DataType	re_2 = sf_r_i - v1;
+		const DataType	im_2 = v2 - sf_i_i;
+		p_ptr [c1_r + i] = re_1 * re_1 + im_1 * im_1;
+		p_ptr [c2_r - i] = re_2 * re_2 + im_2 * im_2;
+	}
+}
+
+
+
 /*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
 
@@ -195,6 +355,124 @@ void	FFTRealPassDirect <PASS>::process (long len, DataType dest_ptr [], DataType
 
 
 
+// Passes PASS - 1 and PASS, table-based. dist is the one of the first pass.
+// For each i in ]0 ; dist[, the 8 source coefficients at i + k * dist give
+// the destination coefficients i and 2 * dist - i of both halves of the
+// block. See FFTRealSimd::butterfly_direct_r4 () for the details.
+template <int PASS>
+void	FFTRealPassDirect <PASS>::process_radix_4 (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, const DataType tw_ptr [], long max_bin)
+{
+	const long		dist = 1L << (PASS - 2);
+	const long		table_step_1 = cos_len >> (PASS - 2);
+	const long		table_step_2 = cos_len >> (PASS - 1);
+
+	// The second pass needs the butterflies 2 * dist - i too, unless
+	// max_bin < dist.
+	const long		i_end = get_butterfly_end (dist, max_bin);
+
+	if (FFTRealSimd::get_isa () != FFTRealSimd::Isa_SCALAR)
+	{
+		FFTRealSimd::direct_pass_r4 (
+			len,
+			dest_ptr,
+			src_ptr,
+			dist,
+			i_end,
+			FFTRealSimd::use_twiddles (tw_ptr, PASS - 1),
+			FFTRealSimd::use_twiddles (tw_ptr, PASS)
+		);
+		return;
+	}
+
+	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
+
+	long				coef_index = 0;
+	do
+	{
+		const DataType	* const	sf = src_ptr + coef_index;
+		DataType			* const	df = dest_ptr + coef_index;
+
+		// Extreme coefficients of the first pass, then coefficients 0,
+		// dist and 2 * dist of the second one
+		const DataType	p_0 = sf [0       ] + sf [dist * 2];
+		const DataType	p_n = sf [0       ] - sf [dist * 2];
+		const DataType	q_0 = sf [dist * 4] + sf [dist * 6];
+		const DataType	q_n = sf [dist * 4] - sf [dist * 6];
+		df [0       ] = p_0 + q_0;
+		df [dist * 4] = p_0 - q_0;
+		df [dist * 2] = p_n;
+		df [dist * 6] = q_n;
+
+		const DataType	w1 = (sf [dist * 5] - sf [dist * 7]) * sqrt2_2;
+		const DataType	w2 = (sf [dist * 5] + sf [dist * 7]) * sqrt2_2;
+		df [dist    ] = sf [dist    ] + w1;
+		df [dist * 3] = sf [dist    ] - w1;
+		df [dist * 5] = w2 + sf [dist * 3];
+		df [dist * 7] = w2 - sf [dist * 3];
+
+		for (long i = 1; i < i_end; ++ i)
+		{
+			const DataType	c1 = cos_ptr [i * table_step_1];
+			const DataType	s1 = cos_ptr [(dist - i) * table_step_1];
+			const DataType	c2 = cos_ptr [i * table_step_2];
+			const DataType	s2 = cos_ptr [(dist * 2 - i) * table_step_2];
+
+			// First pass, on both halves of the block
+			const DataType	v1 = sf [dist * 2 + i] * c1 - sf [dist * 3 + i] * s1;
+			const DataType	v2 = sf [dist * 2 + i] * s1 + sf [dist * 3 + i] * c1;
+			const DataType	u1 = sf [dist * 6 + i] * c1 - sf [dist * 7 + i] * s1;
+			const DataType	u2 = sf [dist * 6 + i] * s1 + sf [dist * 7 + i] * c1;
+
+			const DataType	p_r_0 = sf [           i] + v1;
+			const DataType	p_r_1 = sf [           i] - v1;
+			const DataType	p_i_0 = v2 + sf [dist     + i];
+			const DataType	p_i_1 = v2 - sf [dist     + i];
+			const DataType	q_r_0 = sf [dist * 4 + i] + u1;
+			const DataType	q_r_1 = sf [dist * 4 + i] - u1;
+			const DataType	q_i_0 = u2 + sf [dist * 5 + i];
+			const DataType	q_i_1 = u2 - sf [dist * 5 + i];
+
+			// Second pass, coefficient i
+			const DataType	x1 = q_r_0 * c2 - q_i_0 * s2;
+			const DataType	x2 = q_r_0 * s2 + q_i_0 * c2;
+			df [           i] = p_r_0 + x1;
+			df [dist * 4 - i] = p_r_0 - x1;
+			df [dist * 4 + i] = x2 + p_i_0;
+			df [dist * 8 - i] = x2 - p_i_0;
+
+			// Second pass, coefficient 2 * dist - i: cos and sin swap
+			const DataType	y1 = q_r_1 * s2 - q_i_1 * c2;
+			const DataType	y2 = q_r_1 * c2 + q_i_1 * s2;
+			df [dist * 2 - i] = p_r_1 + y1;
+			df [dist * 2 + i] = p_r_1 - y1;
+			df [dist * 6 - i] = y2 + p_i_1;
+			df [dist * 6 + i] = y2 - p_i_1;
+		}
+
+		coef_index += dist * 8;
+	}
+	while (coef_index < len);
+}
+
+
+
+// Butterfly i of a pass gives the bins i and 2 * dist - i of its block, and
+// needs the bins i of the two blocks of the previous pass. When max_bin is
+// below dist, the bins up to max_bin only depend on the butterflies up to
+// max_bin in each pass, the mirrored ones being all above. The bound is
+// rounded up to full vectors, see FFTRealSimd::direct_pass_n ().
+template <int PASS>
+long	FFTRealPassDirect <PASS>::get_butterfly_end (long dist, long max_bin)
+{
+	assert (max_bin >= 0);
+
+	const long		i_end = (max_bin + 8) & ~7L;
+
+	return ((i_end < dist) ? i_end : dist);
+}
+
+
+
 #endif	// FFTRealPassDirect_CODEHEADER_INCLUDED
 
 #undef FFTRealPassDirect_CURRENT_CODEHEADER
@@ -35,6 +35,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
+#include	"FFTRealSimd.h"
 #include	"FFTRealUseTrigo.h"
 
 
@@ -44,7 +45,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 
 template <int PASS>
-void	FFTRealPassInverse <PASS>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType f_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+void	FFTRealPassInverse <PASS>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType f_ptr [], const DataType cos_ptr [], long cos_len, const DataType tw_ptr [], const long br_ptr [], OscType osc_list [])
 {
 	process_internal (
 		len,
@@ -52,6 +53,7 @@ void	FFTRealPassInverse <PASS>::process (long len, DataType dest_ptr [], DataTyp
 		f_ptr,
 		cos_ptr,
 		cos_len,
+		tw_ptr,
 		br_ptr,
 		osc_list
 	);
@@ -61,6 +63,7 @@ void	FFTRealPassInverse <PASS>::process (long len, DataType dest_ptr [], DataTyp
 		dest_ptr,
 		cos_ptr,
 		cos_len,
+		tw_ptr,
 		br_ptr,
 		osc_list
 	);
@@ -69,7 +72,7 @@ void	FFTRealPassInverse <PASS>::process (long len, DataType dest_ptr [], DataTyp
 
 
 template <int PASS>
-void	FFTRealPassInverse <PASS>::process_rec (long len, DataType dest_ptr [], DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+void	FFTRealPassInverse <PASS>::process_rec (long len, DataType dest_ptr [], DataType src_ptr [], const DataType cos_ptr [], long cos_len, const DataType tw_ptr [], const long br_ptr [], OscType osc_list [])
 {
 	process_internal (
 		len,
@@ -77,6 +80,7 @@ void	FFTRealPassInverse <PASS>::process_rec (long len, DataType dest_ptr [], Dat
 		src_ptr,
 		cos_ptr,
 		cos_len,
+		tw_ptr,
 		br_ptr,
 		osc_list
 	);
@@ -86,13 +90,14 @@ void	FFTRealPassInverse <PASS>::process_rec (long len, DataType dest_ptr [], Dat
 		dest_ptr,
 		cos_ptr,
 		cos_len,
+		tw_ptr,
 		br_ptr,
 		osc_list
 	);
 }
 
 template <>
-void	FFTRealPassInverse <0>::process_rec (long len, DataType dest_ptr [], DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+inline void	FFTRealPassInverse <0>::process_rec (long /*len*/, DataType /*dest_ptr*/ [], DataType /*src_ptr*/ [], const DataType /*cos_ptr*/ [], long /*cos_len*/, const DataType /*tw_ptr*/ [], const long /*br_ptr*/ [], OscType /*osc_list*/ [])
 {
 	// Stops recursion
 }
@@ -100,7 +105,7 @@ void	FFTRealPassInverse <0>::process_rec (long len, DataType dest_ptr [], DataTy
 
 
 template <int PASS>
-void	FFTRealPassInverse <PASS>::process_internal (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+void	FFTRealPassInverse <PASS>::process_internal (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, const DataType tw_ptr [], const long /*br_ptr*/ [], OscType osc_list [])
 {
 	const long		dist = 1L << (PASS - 1);
 	const long		c1_r = 0;
@@ -113,6 +118,19 @@ void	FFTRealPassInverse <PASS>::process_internal (long len, DataType dest_ptr []
    enum {	TRIGO_OSC		= PASS - FFTRealFixLenParam::TRIGO_BD_LIMIT	};
 	enum {	TRIGO_DIRECT	= (TRIGO_OSC >= 0) ? 1 : 0	};
 
+	// Vector version available for the table-based passes only
+	if (TRIGO_DIRECT == 0 && FFTRealSimd::get_isa () != FFTRealSimd::Isa_SCALAR)
+	{
+		FFTRealSimd::inverse_pass_n (
+			len,
+			dest_ptr,
+			src_ptr,
+			dist,
+			FFTRealSimd::use_twiddles (tw_ptr, PASS)
+		);
+		return;
+	}
+
 	long				coef_index = 0;
 	do
 	{
@@ -157,9 +175,15 @@ void	FFTRealPassInverse <PASS>::process_internal (long len, DataType dest_ptr []
 }
 
 template <>
-void	FFTRealPassInverse <2>::process_internal (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+inline void	FFTRealPassInverse <2>::process_internal (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType /*cos_ptr*/ [], long /*cos_len*/, const DataType /*tw_ptr*/ [], const long /*br_ptr*/ [], OscType /*osc_list*/ [])
 {
 	// Antepenultimate pass
+	if (len >= 32 && FFTRealSimd::get_isa () != FFTRealSimd::Isa_SCALAR)
+	{
+		FFTRealSimd::inverse_pass_3 (len, dest_ptr, src_ptr);
+		return;
+	}
+
 	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
 
 	long				coef_index = 0;
@@ -185,9 +209,15 @@ void	FFTRealPassInverse <2>::process_internal (long len, DataType dest_ptr [], c
 }
 
 template <>
-void	FFTRealPassInverse <1>::process_internal (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+inline void	FFTRealPassInverse <1>::process_internal (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType /*cos_ptr*/ [], long /*cos_len*/, const DataType /*tw_ptr*/ [], const long br_ptr [], OscType /*osc_list*/ [])
 {
 	// Penultimate and last pass at once
+	if (len >= 16 && FFTRealSimd::get_isa () != FFTRealSimd::Isa_SCALAR)
+	{
+		FFTRealSimd::inverse_pass_1_2 (len, dest_ptr, src_ptr, br_ptr);
+		return;
+	}
+
 	const long		qlen = len >> 2;
 
 	long				coef_index = 0;
@@ -0,0 +1,109 @@
+/*****************************************************************************
+
+        FFTRealPcm16Reader.h
+
+Input adapter for the direct FFT passes. Reads signed 16-bit little-endian
+PCM samples, converts them to DataType, scales them and applies a window,
+one sample at a time. Used in place of the source array, the conversion
+happens within the bit-reversed gather of the first pass and no
+intermediate buffer is needed.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealPcm16Reader_HEADER_INCLUDED)
+#define	FFTRealPcm16Reader_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"FFTRealFixLenParam.h"
+
+
+
+class FFTRealPcm16Reader
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	FFTRealFixLenParam::DataType	DataType;
+
+	inline			FFTRealPcm16Reader (const void *pcm_ptr, long stride, const DataType win_ptr [], DataType scale = DataType (1.0 / 32768));
+
+	FORCEINLINE DataType
+						operator [] (long pos) const;
+
+	FORCEINLINE int	read_sample (long pos) const;
+	inline const DataType *
+						use_window () const;
+	inline DataType
+						get_scale () const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	const unsigned char *
+						_pcm_ptr;
+	long				_stride;
+	const DataType *
+						_win_ptr;
+	DataType			_scale;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealPcm16Reader ();
+	bool				operator == (const FFTRealPcm16Reader &other);
+	bool				operator != (const FFTRealPcm16Reader &other);
+
+};	// class FFTRealPcm16Reader
+
+
+
+#include	"FFTRealPcm16Reader.hpp"
+
+
+
+#endif	// FFTRealPcm16Reader_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
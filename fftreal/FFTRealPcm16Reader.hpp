@@ -0,0 +1,118 @@
+/*****************************************************************************
+
+        FFTRealPcm16Reader.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealPcm16Reader_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealPcm16Reader code header.
+#endif
+#define	FFTRealPcm16Reader_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealPcm16Reader_CODEHEADER_INCLUDED)
+#define	FFTRealPcm16Reader_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- pcm_ptr: pointer on the first sample.
+	- stride: distance in bytes between two consecutive samples, >= 2. Use
+		the frame size to read one channel of interleaved data.
+	- win_ptr: window, one coefficient per sample.
+	- scale: multiplier applied with the window. The default maps the 16-bit
+		range to [-1 ; 1[.
+Throws: Nothing
+==============================================================================
+*/
+
+FFTRealPcm16Reader::FFTRealPcm16Reader (const void *pcm_ptr, long stride, const DataType win_ptr [], DataType scale)
+:	_pcm_ptr (static_cast <const unsigned char *> (pcm_ptr))
+,	_stride (stride)
+,	_win_ptr (win_ptr)
+,	_scale (scale)
+{
+	assert (pcm_ptr != 0);
+	assert (stride >= 2);
+	assert (win_ptr != 0);
+}
+
+
+
+// Converted, scaled and windowed sample
+FFTRealPcm16Reader::DataType	FFTRealPcm16Reader::operator [] (long pos) const
+{
+	return (DataType (read_sample (pos)) * _scale * _win_ptr [pos]);
+}
+
+
+
+// Raw sample, for callers doing the conversion themselves
+int	FFTRealPcm16Reader::read_sample (long pos) const
+{
+	const unsigned char * const	byte_ptr = _pcm_ptr + pos * _stride;
+
+	return (static_cast <short> (byte_ptr [0] | (byte_ptr [1] << 8)));
+}
+
+
+
+const FFTRealPcm16Reader::DataType *	FFTRealPcm16Reader::use_window () const
+{
+	return (_win_ptr);
+}
+
+
+
+FFTRealPcm16Reader::DataType	FFTRealPcm16Reader::get_scale () const
+{
+	return (_scale);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+#endif	// FFTRealPcm16Reader_CODEHEADER_INCLUDED
+
+#undef FFTRealPcm16Reader_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -38,7 +38,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 
 template <int P>
-float *	FFTRealSelect <P>::sel_bin (float *e_ptr, float *o_ptr)
+float *	FFTRealSelect <P>::sel_bin (float * /*e_ptr*/, float *o_ptr)
 {
 	return (o_ptr);
 }
@@ -46,7 +46,7 @@ float *	FFTRealSelect <P>::sel_bin (float *e_ptr, float *o_ptr)
 
 
 template <>
-float *	FFTRealSelect <0>::sel_bin (float *e_ptr, float *o_ptr)
+inline float *	FFTRealSelect <0>::sel_bin (float *e_ptr, float * /*o_ptr*/)
 {
 	return (e_ptr);
 }
@@ -0,0 +1,215 @@
+/*****************************************************************************
+
+        FFTRealSimd.h
+
+SSE2 and AVX2 versions of the FFTRealFixLen passes. The instruction set is
+detected once at run-time; get_isa () returns Isa_SCALAR when no supported
+extension is available (or on non-x86 targets, or when FFTREAL_NO_SIMD is
+defined), in which case the callers keep using their scalar code.
+
+Kernels only handle the table-based passes. The twiddle factors are stored
+per pass, as contiguous cos and sin arrays so they can be loaded as vectors
+(see build_twiddles () for the layout).
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealSimd_HEADER_INCLUDED)
+#define	FFTRealSimd_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"FFTRealFixLenParam.h"
+#include	"FFTRealPcm16Reader.h"
+
+#if ! defined (FFTREAL_NO_SIMD)
+	#if defined (__x86_64__) || defined (__i386__) || defined (_M_X64) || defined (_M_IX86)
+		#define	FFTRealSimd_X86
+	#endif
+#endif
+
+#if defined (FFTRealSimd_X86)
+	#include	<emmintrin.h>
+	#include	<immintrin.h>
+	#if defined (_MSC_VER)
+		#include	<intrin.h>
+	#endif
+#endif
+
+// Lets GCC and Clang emit code for an instruction set that is not enabled
+// on the command line. MSVC accepts the intrinsics without it.
+#if defined (FFTRealSimd_X86) && defined (__GNUC__)
+	#define	FFTRealSimd_TARGET_SSE2	__attribute__ ((target ("sse2")))
+	#define	FFTRealSimd_TARGET_AVX2	__attribute__ ((target ("avx2")))
+#else
+	#define	FFTRealSimd_TARGET_SSE2
+	#define	FFTRealSimd_TARGET_AVX2
+#endif
+
+
+
+class FFTRealSimd
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	FFTRealFixLenParam::DataType	DataType;
+
+	enum Isa
+	{
+		Isa_SCALAR	= 0,
+		Isa_SSE2,
+		Isa_AVX2
+	};
+
+	static inline Isa
+						get_isa ();
+	static inline void
+						set_isa_limit (Isa isa);
+
+	static inline long
+						get_twiddle_len (int pass_end);
+	static inline void
+						build_twiddles (DataType tw_ptr [], int pass_end);
+	FORCEINLINE static const DataType *
+						use_twiddles (const DataType tw_ptr [], int pass);
+
+	template <class XR>
+	static inline void
+						direct_pass_1_2 (long len, DataType df [], XR x, const long br_ptr []);
+	static inline void
+						direct_pass_3 (long len, DataType df [], const DataType sf []);
+	static inline void
+						direct_pass_n (long len, DataType df [], const DataType sf [], long dist, long i_end, const DataType tw_ptr []);
+	static inline void
+						direct_pass_r4 (long len, DataType df [], const DataType sf [], long dist, long i_end, const DataType tw1_ptr [], const DataType tw2_ptr []);
+
+	static inline void
+						inverse_pass_n (long len, DataType df [], const DataType sf [], long dist, const DataType tw_ptr []);
+	static inline void
+						inverse_pass_3 (long len, DataType df [], const DataType sf []);
+	static inline void
+						inverse_pass_1_2 (long len, DataType x [], const DataType sf [], const long br_ptr []);
+
+	static inline void
+						direct_pass_power (long len, DataType p [], const DataType sf [], long i_end, const DataType tw_ptr []);
+	static inline void
+						power_to_log (long nbr_bins, DataType buf [], DataType scale);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	static inline Isa
+						detect_isa ();
+	static inline Isa &
+						use_isa_limit ();
+
+	FORCEINLINE static void
+						butterfly_direct (DataType df [], const DataType sf [], long dist, long i, DataType c, DataType s);
+	FORCEINLINE static void
+						butterfly_direct_r4 (DataType df [], const DataType sf [], long dist, long i, DataType c1, DataType s1, DataType c2, DataType s2);
+	FORCEINLINE static void
+						butterfly_inverse (DataType df [], const DataType sf [], long dist, long i, DataType c, DataType s);
+	FORCEINLINE static void
+						butterfly_power (DataType p [], const DataType sf [], long dist, long i, DataType c, DataType s);
+
+#if defined (FFTRealSimd_X86)
+
+	FFTRealSimd_TARGET_SSE2 static inline __m128
+						gather_sse2 (const DataType x [], long i_0, long i_1, long i_2, long i_3);
+	FFTRealSimd_TARGET_SSE2 static inline __m128
+						gather_sse2 (const FFTRealPcm16Reader &x, long i_0, long i_1, long i_2, long i_3);
+	template <class XR>
+	FFTRealSimd_TARGET_SSE2 static inline void
+						direct_pass_1_2_sse2 (long len, DataType df [], XR x, const long br_ptr []);
+	FFTRealSimd_TARGET_SSE2 static inline void
+						direct_pass_3_sse2 (long len, DataType df [], const DataType sf []);
+	FFTRealSimd_TARGET_SSE2 static inline void
+						direct_pass_n_sse2 (long len, DataType df [], const DataType sf [], long dist, long i_end, const DataType tw_ptr []);
+	FFTRealSimd_TARGET_AVX2 static inline void
+						direct_pass_n_avx2 (long len, DataType df [], const DataType sf [], long dist, long i_end, const DataType tw_ptr []);
+	FFTRealSimd_TARGET_SSE2 static inline void
+						direct_pass_r4_sse2 (long len, DataType df [], const DataType sf [], long dist, long i_end, const DataType tw1_ptr [], const DataType tw2_ptr []);
+	FFTRealSimd_TARGET_AVX2 static inline void
+						direct_pass_r4_avx2 (long len, DataType df [], const DataType sf [], long dist, long i_end, const DataType tw1_ptr [], const DataType tw2_ptr []);
+
+	FFTRealSimd_TARGET_SSE2 static inline void
+						inverse_pass_n_sse2 (long len, DataType df [], const DataType sf [], long dist, const DataType tw_ptr []);
+	FFTRealSimd_TARGET_AVX2 static inline void
+						inverse_pass_n_avx2 (long len, DataType df [], const DataType sf [], long dist, const DataType tw_ptr []);
+	FFTRealSimd_TARGET_SSE2 static inline void
+						inverse_pass_3_sse2 (long len, DataType df [], const DataType sf []);
+	FFTRealSimd_TARGET_SSE2 static inline void
+						inverse_pass_1_2_sse2 (long len, DataType x [], const DataType sf [], const long br_ptr []);
+
+	FFTRealSimd_TARGET_SSE2 static inline void
+						direct_pass_power_sse2 (long len, DataType p [], const DataType sf [], long i_end, const DataType tw_ptr []);
+	FFTRealSimd_TARGET_SSE2 static inline void
+						power_to_log_sse2 (long nbr_bins, DataType buf [], DataType scale);
+	FFTRealSimd_TARGET_SSE2 static inline __m128
+						log_sse2 (__m128 x);
+
+#endif	// FFTRealSimd_X86
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealSimd ();
+						~FFTRealSimd ();
+						FFTRealSimd (const FFTRealSimd &other);
+	FFTRealSimd &	operator = (const FFTRealSimd &other);
+	bool				operator == (const FFTRealSimd &other);
+	bool				operator != (const FFTRealSimd &other);
+
+};	// class FFTRealSimd
+
+
+
+#include	"FFTRealSimd.hpp"
+
+
+
+#endif	// FFTRealSimd_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,1467 @@
+/*****************************************************************************
+
+        FFTRealSimd.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealSimd_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealSimd code header.
+#endif
+#define	FFTRealSimd_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealSimd_CODEHEADER_INCLUDED)
+#define	FFTRealSimd_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+#include	<cfloat>
+#include	<cmath>
+
+namespace std { }
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: get_isa
+Description:
+	Returns the best instruction set supported by both the library and the
+	CPU we are running on, within the limit set by set_isa_limit ().
+	Detection is done on the first call only.
+Throws: Nothing
+==============================================================================
+*/
+
+FFTRealSimd::Isa	FFTRealSimd::get_isa ()
+{
+	static const Isa	isa = detect_isa ();
+	const Isa		limit = use_isa_limit ();
+
+	return ((isa < limit) ? isa : limit);
+}
+
+
+
+/*
+==============================================================================
+Name: set_isa_limit
+Description:
+	Restricts get_isa () to the given instruction set or a lesser one, so
+	the tests can run the SSE2 and scalar code on an AVX2 CPU. Must not be
+	called while a transform is running.
+Input parameters:
+	- isa: best instruction set to use. Isa_AVX2 (default) for no limit.
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealSimd::set_isa_limit (Isa isa)
+{
+	assert (isa >= Isa_SCALAR);
+	assert (isa <= Isa_AVX2);
+
+	use_isa_limit () = isa;
+}
+
+
+
+/*
+==============================================================================
+Name: get_twiddle_len
+Description:
+	Size of the table built by build_twiddles ().
+Input parameters:
+	- pass_end: first pass not covered by the table. Passes 3 to pass_end - 1
+		are covered.
+Returns: The number of elements, > 0.
+Throws: Nothing
+==============================================================================
+*/
+
+long	FFTRealSimd::get_twiddle_len (int pass_end)
+{
+	return ((pass_end > 3) ? (1L << pass_end) - 8 : 1);
+}
+
+
+
+/*
+==============================================================================
+Name: build_twiddles
+Description:
+	Fills the per-pass twiddle table. Pass p (dist = 2^(p-1)) starts at
+	index 2^p - 8 and stores cos (i*PI/(2*dist)) for i in [0 ; dist[,
+	followed by the corresponding sines.
+Input parameters:
+	- pass_end: first pass not covered by the table.
+Output parameters:
+	- tw_ptr: table, get_twiddle_len (pass_end) elements.
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealSimd::build_twiddles (DataType tw_ptr [], int pass_end)
+{
+	assert (tw_ptr != 0);
+
+	using namespace std;
+
+	tw_ptr [0] = 0;
+	for (int pass = 3; pass < pass_end; ++pass)
+	{
+		const long		dist = 1L << (pass - 1);
+		const double	mul = (0.5 * PI) / dist;
+		DataType	* const	cos_ptr = tw_ptr + (1L << pass) - 8;
+		DataType	* const	sin_ptr = cos_ptr + dist;
+
+		for (long i = 0; i < dist; ++i)
+		{
+			cos_ptr [i] = static_cast <DataType> (cos (i * mul));
+			sin_ptr [i] = static_cast <DataType> (sin (i * mul));
+		}
+	}
+}
+
+
+
+const FFTRealSimd::DataType *	FFTRealSimd::use_twiddles (const DataType tw_ptr [], int pass)
+{
+	assert (tw_ptr != 0);
+	assert (pass >= 3);
+
+	return (tw_ptr + (1L << pass) - 8);
+}
+
+
+
+// Same as FFTRealPassDirect <1>::process, 4 groups at once
+template <class XR>
+void	FFTRealSimd::direct_pass_1_2 (long len, DataType df [], XR x, const long br_ptr [])
+{
+	assert (len >= 16);
+
+#if defined (FFTRealSimd_X86)
+	direct_pass_1_2_sse2 (len, df, x, br_ptr);
+#else
+	(void) len;
+	(void) df;
+	(void) x;
+	(void) br_ptr;
+	assert (false);
+#endif
+}
+
+
+
+// Same as FFTRealPassDirect <2>::process, 4 groups at once
+void	FFTRealSimd::direct_pass_3 (long len, DataType df [], const DataType sf [])
+{
+	assert (len >= 32);
+
+#if defined (FFTRealSimd_X86)
+	direct_pass_3_sse2 (len, df, sf);
+#else
+	(void) len;
+	(void) df;
+	(void) sf;
+	assert (false);
+#endif
+}
+
+
+
+/*
+==============================================================================
+Name: direct_pass_n
+Description:
+	Generic pass of FFTRealPassDirect, for the passes using the trigonometric
+	table.
+Input parameters:
+	- len: FFT length
+	- sf: source data
+	- dist: 2^(PASS-1), >= 4
+	- i_end: only the butterflies i < i_end of each block are computed, see
+		FFTRealPassDirect::get_butterfly_end (). dist, or a multiple of 8.
+	- tw_ptr: twiddles for this pass, see use_twiddles ()
+Output parameters:
+	- df: destination data, must be different from sf
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealSimd::direct_pass_n (long len, DataType df [], const DataType sf [], long dist, long i_end, const DataType tw_ptr [])
+{
+	assert (df != sf);
+	assert (dist >= 4);
+	assert (i_end == dist || (i_end > 0 && i_end < dist && (i_end & 7) == 0));
+
+#if defined (FFTRealSimd_X86)
+	if (get_isa () >= Isa_AVX2)
+	{
+		direct_pass_n_avx2 (len, df, sf, dist, i_end, tw_ptr);
+	}
+	else
+	{
+		direct_pass_n_sse2 (len, df, sf, dist, i_end, tw_ptr);
+	}
+#else
+	(void) len;
+	(void) df;
+	(void) sf;
+	(void) dist;
+	(void) i_end;
+	(void) tw_ptr;
+	assert (false);
+#endif
+}
+
+
+
+/*
+==============================================================================
+Name: direct_pass_r4
+Description:
+	Two consecutive generic passes of FFTRealPassDirect in a single sweep
+	over the data (radix 4). Each group of 8 source coefficients, one per
+	quarter of a half block, gives 8 destination coefficients without
+	storing the result of the first pass.
+Input parameters:
+	- len: FFT length
+	- sf: source data
+	- dist: 2^(PASS-1) for the first pass, >= 4
+	- i_end: only the butterflies i < i_end are computed, same as for
+		direct_pass_n ()
+	- tw1_ptr: twiddles for the first pass, see use_twiddles ()
+	- tw2_ptr: twiddles for the second pass
+Output parameters:
+	- df: destination data, must be different from sf
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealSimd::direct_pass_r4 (long len, DataType df [], const DataType sf [], long dist, long i_end, const DataType tw1_ptr [], const DataType tw2_ptr [])
+{
+	assert (df != sf);
+	assert (dist >= 4);
+	assert (i_end == dist || (i_end > 0 && i_end < dist && (i_end & 7) == 0));
+	assert (len >= dist * 8);
+
+#if defined (FFTRealSimd_X86)
+	if (get_isa () >= Isa_AVX2)
+	{
+		direct_pass_r4_avx2 (len, df, sf, dist, i_end, tw1_ptr, tw2_ptr);
+	}
+	else
+	{
+		direct_pass_r4_sse2 (len, df, sf, dist, i_end, tw1_ptr, tw2_ptr);
+	}
+#else
+	(void) len;
+	(void) df;
+	(void) sf;
+	(void) dist;
+	(void) i_end;
+	(void) tw1_ptr;
+	(void) tw2_ptr;
+	assert (false);
+#endif
+}
+
+
+
+void	FFTRealSimd::inverse_pass_n (long len, DataType df [], const DataType sf [], long dist, const DataType tw_ptr [])
+{
+	assert (df != sf);
+	assert (dist >= 4);
+
+#if defined (FFTRealSimd_X86)
+	if (get_isa () >= Isa_AVX2)
+	{
+		inverse_pass_n_avx2 (len, df, sf, dist, tw_ptr);
+	}
+	else
+	{
+		inverse_pass_n_sse2 (len, df, sf, dist, tw_ptr);
+	}
+#else
+	(void) len;
+	(void) df;
+	(void) sf;
+	(void) dist;
+	(void) tw_ptr;
+	assert (false);
+#endif
+}
+
+
+
+void	FFTRealSimd::inverse_pass_3 (long len, DataType df [], const DataType sf [])
+{
+	assert (len >= 32);
+
+#if defined (FFTRealSimd_X86)
+	inverse_pass_3_sse2 (len, df, sf);
+#else
+	(void) len;
+	(void) df;
+	(void) sf;
+	assert (false);
+#endif
+}
+
+
+
+void	FFTRealSimd::inverse_pass_1_2 (long len, DataType x [], const DataType sf [], const long br_ptr [])
+{
+	assert (len >= 16);
+
+#if defined (FFTRealSimd_X86)
+	inverse_pass_1_2_sse2 (len, x, sf, br_ptr);
+#else
+	(void) len;
+	(void) x;
+	(void) sf;
+	(void) br_ptr;
+	assert (false);
+#endif
+}
+
+
+
+/*
+==============================================================================
+Name: direct_pass_power
+Description:
+	Last pass of FFTRealPassDirect, for a table-based pass. Instead of the
+	half-complex spectrum, writes the squared magnitude of each bin.
+Input parameters:
+	- len: FFT length, >= 16
+	- sf: source data
+	- i_end: only the butterflies i < i_end are computed, same as for
+		direct_pass_n (). dist is len/4 here.
+	- tw_ptr: twiddles for this pass, see use_twiddles ()
+Output parameters:
+	- p: |X[k]|^2 for k in [0 ; len/2], len/2 + 1 values. With i_end < len/4,
+		only the bins in [0 ; i_end[ are valid.
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealSimd::direct_pass_power (long len, DataType p [], const DataType sf [], long i_end, const DataType tw_ptr [])
+{
+	assert (p != sf);
+	assert (len >= 16);
+	assert (i_end == len >> 2 || (i_end > 0 && i_end < len >> 2 && (i_end & 7) == 0));
+
+#if defined (FFTRealSimd_X86)
+	direct_pass_power_sse2 (len, p, sf, i_end, tw_ptr);
+#else
+	(void) len;
+	(void) p;
+	(void) sf;
+	(void) i_end;
+	(void) tw_ptr;
+	assert (false);
+#endif
+}
+
+
+
+/*
+==============================================================================
+Name: power_to_log
+Description:
+	Converts squared magnitudes in place to scale * ln (magnitude). Uses a
+	polynomial approximation of the logarithm, accurate to a few float ulps.
+	Null values are clamped to the smallest normalised float, so the result
+	is always finite.
+Input parameters:
+	- nbr_bins: number of values, >= 0
+	- scale: multiplier applied to the natural logarithm of the magnitude.
+		20 / ln (10) gives decibels.
+Input/output parameters:
+	- buf: squared magnitudes in input, logarithms in output.
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealSimd::power_to_log (long nbr_bins, DataType buf [], DataType scale)
+{
+	assert (nbr_bins >= 0);
+	assert (buf != 0);
+
+#if defined (FFTRealSimd_X86)
+	power_to_log_sse2 (nbr_bins, buf, scale);
+#else
+	(void) nbr_bins;
+	(void) buf;
+	(void) scale;
+	assert (false);
+#endif
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+FFTRealSimd::Isa	FFTRealSimd::detect_isa ()
+{
+	Isa				isa = Isa_SCALAR;
+
+#if defined (FFTRealSimd_X86)
+
+ #if defined (_MSC_VER)
+
+	int				info [4];
+	__cpuid (info, 0);
+	const int		max_leaf = info [0];
+
+	__cpuid (info, 1);
+	const bool		sse2_flag = ((info [3] & (1 << 26)) != 0);
+	const bool		osxsave_flag = ((info [2] & (1 << 27)) != 0);
+	const bool		avx_flag = ((info [2] & (1 << 28)) != 0);
+
+	bool				avx2_flag = false;
+	if (max_leaf >= 7 && osxsave_flag && avx_flag)
+	{
+		// The OS must save the YMM registers too
+		if ((_xgetbv (0) & 6) == 6)
+		{
+			__cpuidex (info, 7, 0);
+			avx2_flag = ((info [1] & (1 << 5)) != 0);
+		}
+	}
+
+ #else		// _MSC_VER
+
+	__builtin_cpu_init ();
+	const bool		sse2_flag = (__builtin_cpu_supports ("sse2") != 0);
+	const bool		avx2_flag = (__builtin_cpu_supports ("avx2") != 0);
+
+ #endif	// _MSC_VER
+
+	if (avx2_flag)
+	{
+		isa = Isa_AVX2;
+	}
+	else if (sse2_flag)
+	{
+		isa = Isa_SSE2;
+	}
+
+#endif	// FFTRealSimd_X86
+
+	return (isa);
+}
+
+
+
+FFTRealSimd::Isa &	FFTRealSimd::use_isa_limit ()
+{
+	static Isa		limit = Isa_AVX2;
+
+	return (limit);
+}
+
+
+
+void	FFTRealSimd::butterfly_direct (DataType df [], const DataType sf [], long dist, long i, DataType c, DataType s)
+{
+	const long		c1_r = 0;
+	const long		c1_i = dist;
+	const long		c2_r = dist * 2;
+	const long		c2_i = dist * 3;
+	const long		cend = dist * 4;
+
+	const DataType	sf_r_i = sf [c1_r + i];
+	const DataType	sf_i_i = sf [c1_i + i];
+
+	const DataType	v1 = sf [c2_r + i] * c - sf [c2_i + i] * s;
+	df [c1_r + i] = sf_r_i + v1;
+	df [c2_r - i] = sf_r_i - v1;
+
+	const DataType	v2 = sf [c2_r + i] * s + sf [c2_i + i] * c;
+	df [c2_r + i] = v2 + sf_i_i;
+	df [cend - i] = v2 - sf_i_i;
+}
+
+
+
+// Coefficients i and 2 * dist - i of two passes at once, see
+// direct_pass_r4 (). The second pass uses (c2, s2) for i and (s2, c2) for
+// 2 * dist - i.
+void	FFTRealSimd::butterfly_direct_r4 (DataType df [], const DataType sf [], long dist, long i, DataType c1, DataType s1, DataType c2, DataType s2)
+{
+	// First pass, on both halves of the block
+	const DataType	a_r = sf [           i];
+	const DataType	a_i = sf [dist     + i];
+	const DataType	b_r = sf [dist * 2 + i];
+	const DataType	b_i = sf [dist * 3 + i];
+	const DataType	c_r = sf [dist * 4 + i];
+	const DataType	c_i = sf [dist * 5 + i];
+	const DataType	e_r = sf [dist * 6 + i];
+	const DataType	e_i = sf [dist * 7 + i];
+
+	const DataType	v1 = b_r * c1 - b_i * s1;
+	const DataType	v2 = b_r * s1 + b_i * c1;
+	const DataType	w1 = e_r * c1 - e_i * s1;
+	const DataType	w2 = e_r * s1 + e_i * c1;
+
+	const DataType	p_r_0 = a_r + v1;
+	const DataType	p_r_1 = a_r - v1;
+	const DataType	p_i_0 = v2 + a_i;
+	const DataType	p_i_1 = v2 - a_i;
+	const DataType	q_r_0 = c_r + w1;
+	const DataType	q_r_1 = c_r - w1;
+	const DataType	q_i_0 = w2 + c_i;
+	const DataType	q_i_1 = w2 - c_i;
+
+	// Second pass, coefficient i
+	const DataType	x1 = q_r_0 * c2 - q_i_0 * s2;
+	const DataType	x2 = q_r_0 * s2 + q_i_0 * c2;
+	df [           i] = p_r_0 + x1;
+	df [dist * 4 - i] = p_r_0 - x1;
+	df [dist * 4 + i] = x2 + p_i_0;
+	df [dist * 8 - i] = x2 - p_i_0;
+
+	// Second pass, coefficient 2 * dist - i
+	const DataType	y1 = q_r_1 * s2 - q_i_1 * c2;
+	const DataType	y2 = q_r_1 * c2 + q_i_1 * s2;
+	df [dist * 2 - i] = p_r_1 + y1;
+	df [dist * 2 + i] = p_r_1 - y1;
+	df [dist * 6 - i] = y2 + p_i_1;
+	df [dist * 6 + i] = y2 - p_i_1;
+}
+
+
+
+void	FFTRealSimd::butterfly_inverse (DataType df [], const DataType sf [], long dist, long i, DataType c, DataType s)
+{
+	const long		c1_r = 0;
+	const long		c1_i = dist;
+	const long		c2_r = dist * 2;
+	const long		c2_i = dist * 3;
+	const long		cend = dist * 4;
+
+	df [c1_r + i] = sf [c1_r + i] + sf [c2_r - i];
+	df [c1_i + i] = sf [c2_r + i] - sf [cend - i];
+
+	const DataType	vr = sf [c1_r + i] - sf [c2_r - i];
+	const DataType	vi = sf [c2_r + i] + sf [cend - i];
+
+	df [c2_r + i] = vr * c + vi * s;
+	df [c2_i + i] = vi * c - vr * s;
+}
+
+
+
+void	FFTRealSimd::butterfly_power (DataType p [], const DataType sf [], long dist, long i, DataType c, DataType s)
+{
+	const long		c1_r = 0;
+	const long		c1_i = dist;
+	const long		c2_r = dist * 2;
+	const long		c2_i = dist * 3;
+
+	const DataType	sf_r_i = sf [c1_r + i];
+	const DataType	sf_i_i = sf [c1_i + i];
+
+	const DataType	v1 = sf [c2_r + i] * c - sf [c2_i + i] * s;
+	const DataType	v2 = sf [c2_r + i] * s + sf [c2_i + i] * c;
+
+	const DataType	re_1 = sf_r_i + v1;
+	const DataType	im_1 = v2 + sf_i_i;
+	const DataType	re_2 = sf_r_i - v1;
+	const DataType	im_2 = v2 - sf_i_i;
+	p [i] = re_1 * re_1 + im_1 * im_1;
+	p [c2_r - i] = re_2 * re_2 + im_2 * im_2;
+}
+
+
+
+#if defined (FFTRealSimd_X86)
+
+
+
+FFTRealSimd_TARGET_SSE2
+__m128	FFTRealSimd::gather_sse2 (const DataType x [], long i_0, long i_1, long i_2, long i_3)
+{
+	return (_mm_setr_ps (x [i_0], x [i_1], x [i_2], x [i_3]));
+}
+
+
+
+// Converts, windows and scales the 4 samples at once
+FFTRealSimd_TARGET_SSE2
+__m128	FFTRealSimd::gather_sse2 (const FFTRealPcm16Reader &x, long i_0, long i_1, long i_2, long i_3)
+{
+	const DataType	* const	win_ptr = x.use_window ();
+	const __m128	smp = _mm_cvtepi32_ps (_mm_setr_epi32 (
+		x.read_sample (i_0), x.read_sample (i_1), x.read_sample (i_2), x.read_sample (i_3)
+	));
+	const __m128	win = _mm_setr_ps (
+		win_ptr [i_0], win_ptr [i_1], win_ptr [i_2], win_ptr [i_3]
+	);
+
+	return (_mm_mul_ps (_mm_mul_ps (smp, win), _mm_set1_ps (x.get_scale ())));
+}
+
+
+
+template <class XR>
+FFTRealSimd_TARGET_SSE2
+void	FFTRealSimd::direct_pass_1_2_sse2 (long len, DataType df [], XR x, const long br_ptr [])
+{
+	const long		qlen = len >> 2;
+
+	long				coef_index = 0;
+	do
+	{
+		const long * const	br2 = br_ptr + (coef_index >> 2);
+		const long		ri_0 = br2 [0];
+		const long		ri_1 = br2 [1];
+		const long		ri_2 = br2 [2];
+		const long		ri_3 = br2 [3];
+
+		// One lane per group of 4 coefficients
+		const __m128	x_0 = gather_sse2 (x, ri_0           , ri_1           , ri_2           , ri_3           );
+		const __m128	x_1 = gather_sse2 (x, ri_0 + 2 * qlen, ri_1 + 2 * qlen, ri_2 + 2 * qlen, ri_3 + 2 * qlen);
+		const __m128	x_2 = gather_sse2 (x, ri_0 + 1 * qlen, ri_1 + 1 * qlen, ri_2 + 1 * qlen, ri_3 + 1 * qlen);
+		const __m128	x_3 = gather_sse2 (x, ri_0 + 3 * qlen, ri_1 + 3 * qlen, ri_2 + 3 * qlen, ri_3 + 3 * qlen);
+
+		const __m128	sf_0 = _mm_add_ps (x_0, x_1);
+		const __m128	sf_2 = _mm_add_ps (x_2, x_3);
+
+		__m128			d_0 = _mm_add_ps (sf_0, sf_2);
+		__m128			d_1 = _mm_sub_ps (x_0, x_1);
+		__m128			d_2 = _mm_sub_ps (sf_0, sf_2);
+		__m128			d_3 = _mm_sub_ps (x_2, x_3);
+		_MM_TRANSPOSE4_PS (d_0, d_1, d_2, d_3);
+
+		DataType	* const	df2 = df + coef_index;
+		_mm_storeu_ps (df2     , d_0);
+		_mm_storeu_ps (df2 +  4, d_1);
+		_mm_storeu_ps (df2 +  8, d_2);
+		_mm_storeu_ps (df2 + 12, d_3);
+
+		coef_index += 16;
+	}
+	while (coef_index < len);
+}
+
+
+
+FFTRealSimd_TARGET_SSE2
+void	FFTRealSimd::direct_pass_3_sse2 (long len, DataType df [], const DataType sf [])
+{
+	const __m128	sqrt2_2 = _mm_set1_ps (DataType (SQRT2 * 0.5));
+
+	long				coef_index = 0;
+	do
+	{
+		const DataType	* const	sf2 = sf + coef_index;
+		DataType			* const	df2 = df + coef_index;
+
+		// a_k and b_k hold coefficients k and k + 4 of 4 successive groups
+		__m128			a_0 = _mm_loadu_ps (sf2     );
+		__m128			a_1 = _mm_loadu_ps (sf2 +  8);
+		__m128			a_2 = _mm_loadu_ps (sf2 + 16);
+		__m128			a_3 = _mm_loadu_ps (sf2 + 24);
+		_MM_TRANSPOSE4_PS (a_0, a_1, a_2, a_3);
+
+		__m128			b_0 = _mm_loadu_ps (sf2 +  4);
+		__m128			b_1 = _mm_loadu_ps (sf2 + 12);
+		__m128			b_2 = _mm_loadu_ps (sf2 + 20);
+		__m128			b_3 = _mm_loadu_ps (sf2 + 28);
+		_MM_TRANSPOSE4_PS (b_0, b_1, b_2, b_3);
+
+		const __m128	v1 = _mm_mul_ps (_mm_sub_ps (b_1, b_3), sqrt2_2);
+		const __m128	v2 = _mm_mul_ps (_mm_add_ps (b_1, b_3), sqrt2_2);
+
+		__m128			d_0 = _mm_add_ps (a_0, b_0);
+		__m128			d_1 = _mm_add_ps (a_1, v1);
+		__m128			d_2 = a_2;
+		__m128			d_3 = _mm_sub_ps (a_1, v1);
+		__m128			d_4 = _mm_sub_ps (a_0, b_0);
+		__m128			d_5 = _mm_add_ps (v2, a_3);
+		__m128			d_6 = b_2;
+		__m128			d_7 = _mm_sub_ps (v2, a_3);
+		_MM_TRANSPOSE4_PS (d_0, d_1, d_2, d_3);
+		_MM_TRANSPOSE4_PS (d_4, d_5, d_6, d_7);
+
+		_mm_storeu_ps (df2     , d_0);
+		_mm_storeu_ps (df2 +  4, d_4);
+		_mm_storeu_ps (df2 +  8, d_1);
+		_mm_storeu_ps (df2 + 12, d_5);
+		_mm_storeu_ps (df2 + 16, d_2);
+		_mm_storeu_ps (df2 + 20, d_6);
+		_mm_storeu_ps (df2 + 24, d_3);
+		_mm_storeu_ps (df2 + 28, d_7);
+
+		coef_index += 32;
+	}
+	while (coef_index < len);
+}
+
+
+
+FFTRealSimd_TARGET_SSE2
+void	FFTRealSimd::direct_pass_n_sse2 (long len, DataType df [], const DataType sf [], long dist, long i_end, const DataType tw_ptr [])
+{
+	const long		c1_r = 0;
+	const long		c1_i = dist;
+	const long		c2_r = dist * 2;
+	const long		c2_i = dist * 3;
+	const long		cend = dist * 4;
+	const DataType	* const	cos_ptr = tw_ptr;
+	const DataType	* const	sin_ptr = tw_ptr + dist;
+
+	long				coef_index = 0;
+	do
+	{
+		const DataType	* const	sf2 = sf + coef_index;
+		DataType			* const	df2 = df + coef_index;
+
+		// Extreme coefficients are always real
+		df2 [c1_r] = sf2 [c1_r] + sf2 [c2_r];
+		df2 [c2_r] = sf2 [c1_r] - sf2 [c2_r];
+		df2 [c1_i] = sf2 [c1_i];
+		df2 [c2_i] = sf2 [c2_i];
+
+		// Leading coefficients, so the vector loop runs on full vectors
+		for (long i = 1; i < 4; ++i)
+		{
+			butterfly_direct (df2, sf2, dist, i, cos_ptr [i], sin_ptr [i]);
+		}
+
+		for (long i = 4; i < i_end; i += 4)
+		{
+			const __m128	c = _mm_loadu_ps (cos_ptr + i);
+			const __m128	s = _mm_loadu_ps (sin_ptr + i);
+			const __m128	sf_r_i = _mm_loadu_ps (sf2 + c1_r + i);
+			const __m128	sf_i_i = _mm_loadu_ps (sf2 + c1_i + i);
+			const __m128	sf_2r = _mm_loadu_ps (sf2 + c2_r + i);
+			const __m128	sf_2i = _mm_loadu_ps (sf2 + c2_i + i);
+
+			const __m128	v1 = _mm_sub_ps (_mm_mul_ps (sf_2r, c), _mm_mul_ps (sf_2i, s));
+			const __m128	v2 = _mm_add_ps (_mm_mul_ps (sf_2r, s), _mm_mul_ps (sf_2i, c));
+
+			const __m128	d_1 = _mm_sub_ps (sf_r_i, v1);
+			const __m128	d_3 = _mm_sub_ps (v2, sf_i_i);
+
+			// Descending indexes: store reversed
+			_mm_storeu_ps (df2 + c1_r + i, _mm_add_ps (sf_r_i, v1));
+			_mm_storeu_ps (df2 + c2_r - i - 3, _mm_shuffle_ps (d_1, d_1, _MM_SHUFFLE (0, 1, 2, 3)));
+			_mm_storeu_ps (df2 + c2_r + i, _mm_add_ps (v2, sf_i_i));
+			_mm_storeu_ps (df2 + cend - i - 3, _mm_shuffle_ps (d_3, d_3, _MM_SHUFFLE (0, 1, 2, 3)));
+		}
+
+		coef_index += cend;
+	}
+	while (coef_index < len);
+}
+
+
+
+FFTRealSimd_TARGET_SSE2
+void	FFTRealSimd::direct_pass_r4_sse2 (long len, DataType df [], const DataType sf [], long dist, long i_end, const DataType tw1_ptr [], const DataType tw2_ptr [])
+{
+	const DataType	* const	cos1_ptr = tw1_ptr;
+	const DataType	* const	sin1_ptr = tw1_ptr + dist;
+	const DataType	* const	cos2_ptr = tw2_ptr;
+	const DataType	* const	sin2_ptr = tw2_ptr + dist * 2;
+	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
+
+	long				coef_index = 0;
+	do
+	{
+		const DataType	* const	sf2 = sf + coef_index;
+		DataType			* const	df2 = df + coef_index;
+
+		// Extreme coefficients of the first pass, then coefficients 0,
+		// dist and 2 * dist of the second one
+		const DataType	p_0 = sf2 [0       ] + sf2 [dist * 2];
+		const DataType	p_n = sf2 [0       ] - sf2 [dist * 2];
+		const DataType	q_0 = sf2 [dist * 4] + sf2 [dist * 6];
+		const DataType	q_n = sf2 [dist * 4] - sf2 [dist * 6];
+		df2 [0       ] = p_0 + q_0;
+		df2 [dist * 4] = p_0 - q_0;
+		df2 [dist * 2] = p_n;
+		df2 [dist * 6] = q_n;
+
+		const DataType	w1 = (sf2 [dist * 5] - sf2 [dist * 7]) * sqrt2_2;
+		const DataType	w2 = (sf2 [dist * 5] + sf2 [dist * 7]) * sqrt2_2;
+		df2 [dist    ] = sf2 [dist    ] + w1;
+		df2 [dist * 3] = sf2 [dist    ] - w1;
+		df2 [dist * 5] = w2 + sf2 [dist * 3];
+		df2 [dist * 7] = w2 - sf2 [dist * 3];
+
+		// Leading coefficients, so the vector loop runs on full vectors
+		for (long i = 1; i < 4; ++i)
+		{
+			butterfly_direct_r4 (
+				df2, sf2, dist, i,
+				cos1_ptr [i], sin1_ptr [i], cos2_ptr [i], sin2_ptr [i]
+			);
+		}
+
+		for (long i = 4; i < i_end; i += 4)
+		{
+			const __m128	c1 = _mm_loadu_ps (cos1_ptr + i);
+			const __m128	s1 = _mm_loadu_ps (sin1_ptr + i);
+			const __m128	c2 = _mm_loadu_ps (cos2_ptr + i);
+			const __m128	s2 = _mm_loadu_ps (sin2_ptr + i);
+
+			const __m128	a_r = _mm_loadu_ps (sf2            + i);
+			const __m128	a_i = _mm_loadu_ps (sf2 + dist     + i);
+			const __m128	b_r = _mm_loadu_ps (sf2 + dist * 2 + i);
+			const __m128	b_i = _mm_loadu_ps (sf2 + dist * 3 + i);
+			const __m128	c_r = _mm_loadu_ps (sf2 + dist * 4 + i);
+			const __m128	c_i = _mm_loadu_ps (sf2 + dist * 5 + i);
+			const __m128	e_r = _mm_loadu_ps (sf2 + dist * 6 + i);
+			const __m128	e_i = _mm_loadu_ps (sf2 + dist * 7 + i);
+
+			// First pass
+			const __m128	v1 = _mm_sub_ps (_mm_mul_ps (b_r, c1), _mm_mul_ps (b_i, s1));
+			const __m128	v2 = _mm_add_ps (_mm_mul_ps (b_r, s1), _mm_mul_ps (b_i, c1));
+			const __m128	u1 = _mm_sub_ps (_mm_mul_ps (e_r, c1), _mm_mul_ps (e_i, s1));
+			const __m128	u2 = _mm_add_ps (_mm_mul_ps (e_r, s1), _mm_mul_ps (e_i, c1));
+
+			const __m128	p_r_0 = _mm_add_ps (a_r, v1);
+			const __m128	p_r_1 = _mm_sub_ps (a_r, v1);
+			const __m128	p_i_0 = _mm_add_ps (v2, a_i);
+			const __m128	p_i_1 = _mm_sub_ps (v2, a_i);
+			const __m128	q_r_0 = _mm_add_ps (c_r, u1);
+			const __m128	q_r_1 = _mm_sub_ps (c_r, u1);
+			const __m128	q_i_0 = _mm_add_ps (u2, c_i);
+			const __m128	q_i_1 = _mm_sub_ps (u2, c_i);
+
+			// Second pass, coefficients i
+			const __m128	x1 = _mm_sub_ps (_mm_mul_ps (q_r_0, c2), _mm_mul_ps (q_i_0, s2));
+			const __m128	x2 = _mm_add_ps (_mm_mul_ps (q_r_0, s2), _mm_mul_ps (q_i_0, c2));
+			const __m128	d_4m = _mm_sub_ps (p_r_0, x1);
+			const __m128	d_8m = _mm_sub_ps (x2, p_i_0);
+			_mm_storeu_ps (df2            + i, _mm_add_ps (p_r_0, x1));
+			_mm_storeu_ps (df2 + dist * 4 + i, _mm_add_ps (x2, p_i_0));
+
+			// Second pass, coefficients 2 * dist - i
+			const __m128	y1 = _mm_sub_ps (_mm_mul_ps (q_r_1, s2), _mm_mul_ps (q_i_1, c2));
+			const __m128	y2 = _mm_add_ps (_mm_mul_ps (q_r_1, c2), _mm_mul_ps (q_i_1, s2));
+			const __m128	d_2m = _mm_add_ps (p_r_1, y1);
+			const __m128	d_6m = _mm_add_ps (y2, p_i_1);
+			_mm_storeu_ps (df2 + dist * 2 + i, _mm_sub_ps (p_r_1, y1));
+			_mm_storeu_ps (df2 + dist * 6 + i, _mm_sub_ps (y2, p_i_1));
+
+			// Descending indexes: store reversed
+			_mm_storeu_ps (df2 + dist * 2 - i - 3, _mm_shuffle_ps (d_2m, d_2m, _MM_SHUFFLE (0, 1, 2, 3)));
+			_mm_storeu_ps (df2 + dist * 4 - i - 3, _mm_shuffle_ps (d_4m, d_4m, _MM_SHUFFLE (0, 1, 2, 3)));
+			_mm_storeu_ps (df2 + dist * 6 - i - 3, _mm_shuffle_ps (d_6m, d_6m, _MM_SHUFFLE (0, 1, 2, 3)));
+			_mm_storeu_ps (df2 + dist * 8 - i - 3, _mm_shuffle_ps (d_8m, d_8m, _MM_SHUFFLE (0, 1, 2, 3)));
+		}
+
+		coef_index += dist * 8;
+	}
+	while (coef_index < len);
+}
+
+
+
+FFTRealSimd_TARGET_AVX2
+void	FFTRealSimd::direct_pass_r4_avx2 (long len, DataType df [], const DataType sf [], long dist, long i_end, const DataType tw1_ptr [], const DataType tw2_ptr [])
+{
+	const DataType	* const	cos1_ptr = tw1_ptr;
+	const DataType	* const	sin1_ptr = tw1_ptr + dist;
+	const DataType	* const	cos2_ptr = tw2_ptr;
+	const DataType	* const	sin2_ptr = tw2_ptr + dist * 2;
+	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
+	const __m256i	rev = _mm256_setr_epi32 (7, 6, 5, 4, 3, 2, 1, 0);
+
+	long				coef_index = 0;
+	do
+	{
+		const DataType	* const	sf2 = sf + coef_index;
+		DataType			* const	df2 = df + coef_index;
+
+		// Extreme coefficients of the first pass, then coefficients 0,
+		// dist and 2 * dist of the second one
+		const DataType	p_0 = sf2 [0       ] + sf2 [dist * 2];
+		const DataType	p_n = sf2 [0       ] - sf2 [dist * 2];
+		const DataType	q_0 = sf2 [dist * 4] + sf2 [dist * 6];
+		const DataType	q_n = sf2 [dist * 4] - sf2 [dist * 6];
+		df2 [0       ] = p_0 + q_0;
+		df2 [dist * 4] = p_0 - q_0;
+		df2 [dist * 2] = p_n;
+		df2 [dist * 6] = q_n;
+
+		const DataType	w1 = (sf2 [dist * 5] - sf2 [dist * 7]) * sqrt2_2;
+		const DataType	w2 = (sf2 [dist * 5] + sf2 [dist * 7]) * sqrt2_2;
+		df2 [dist    ] = sf2 [dist    ] + w1;
+		df2 [dist * 3] = sf2 [dist    ] - w1;
+		df2 [dist * 5] = w2 + sf2 [dist * 3];
+		df2 [dist * 7] = w2 - sf2 [dist * 3];
+
+		// Leading coefficients, so the vector loop runs on full vectors
+		long				i = 1;
+		for ( ; i < 8 && i < i_end; ++i)
+		{
+			butterfly_direct_r4 (
+				df2, sf2, dist, i,
+				cos1_ptr [i], sin1_ptr [i], cos2_ptr [i], sin2_ptr [i]
+			);
+		}
+
+		for ( ; i < i_end; i += 8)
+		{
+			const __m256	c1 = _mm256_loadu_ps (cos1_ptr + i);
+			const __m256	s1 = _mm256_loadu_ps (sin1_ptr + i);
+			const __m256	c2 = _mm256_loadu_ps (cos2_ptr + i);
+			const __m256	s2 = _mm256_loadu_ps (sin2_ptr + i);
+
+			const __m256	a_r = _mm256_loadu_ps (sf2            + i);
+			const __m256	a_i = _mm256_loadu_ps (sf2 + dist     + i);
+			const __m256	b_r = _mm256_loadu_ps (sf2 + dist * 2 + i);
+			const __m256	b_i = _mm256_loadu_ps (sf2 + dist * 3 + i);
+			const __m256	c_r = _mm256_loadu_ps (sf2 + dist * 4 + i);
+			const __m256	c_i = _mm256_loadu_ps (sf2 + dist * 5 + i);
+			const __m256	e_r = _mm256_loadu_ps (sf2 + dist * 6 + i);
+			const __m256	e_i = _mm256_loadu_ps (sf2 + dist * 7 + i);
+
+			// First pass
+			const __m256	v1 = _mm256_sub_ps (_mm256_mul_ps (b_r, c1), _mm256_mul_ps (b_i, s1));
+			const __m256	v2 = _mm256_add_ps (_mm256_mul_ps (b_r, s1), _mm256_mul_ps (b_i, c1));
+			const __m256	u1 = _mm256_sub_ps (_mm256_mul_ps (e_r, c1), _mm256_mul_ps (e_i, s1));
+			const __m256	u2 = _mm256_add_ps (_mm256_mul_ps (e_r, s1), _mm256_mul_ps (e_i, c1));
+
+			const __m256	p_r_0 = _mm256_add_ps (a_r, v1);
+			const __m256	p_r_1 = _mm256_sub_ps (a_r, v1);
+			const __m256	p_i_0 = _mm256_add_ps (v2, a_i);
+			const __m256	p_i_1 = _mm256_sub_ps (v2, a_i);
+			const __m256	q_r_0 = _mm256_add_ps (c_r, u1);
+			const __m256	q_r_1 = _mm256_sub_ps (c_r, u1);
+			const __m256	q_i_0 = _mm256_add_ps (u2, c_i);
+			const __m256	q_i_1 = _mm256_sub_ps (u2, c_i);
+
+			// Second pass, coefficients i
+			const __m256	x1 = _mm256_sub_ps (_mm256_mul_ps (q_r_0, c2), _mm256_mul_ps (q_i_0, s2));
+			const __m256	x2 = _mm256_add_ps (_mm256_mul_ps (q_r_0, s2), _mm256_mul_ps (q_i_0, c2));
+			const __m256	d_4m = _mm256_sub_ps (p_r_0, x1);
+			const __m256	d_8m = _mm256_sub_ps (x2, p_i_0);
+			_mm256_storeu_ps (df2            + i, _mm256_add_ps (p_r_0, x1));
+			_mm256_storeu_ps (df2 + dist * 4 + i, _mm256_add_ps (x2, p_i_0));
+
+			// Second pass, coefficients 2 * dist - i
+			const __m256	y1 = _mm256_sub_ps (_mm256_mul_ps (q_r_1, s2), _mm256_mul_ps (q_i_1, c2));
+			const __m256	y2 = _mm256_add_ps (_mm256_mul_ps (q_r_1, c2), _mm256_mul_ps (q_i_1, s2));
+			const __m256	d_2m = _mm256_add_ps (p_r_1, y1);
+			const __m256	d_6m = _mm256_add_ps (y2, p_i_1);
+			_mm256_storeu_ps (df2 + dist * 2 + i, _mm256_sub_ps (p_r_1, y1));
+			_mm256_storeu_ps (df2 + dist * 6 + i, _mm256_sub_ps (y2, p_i_1));
+
+			// Descending indexes: store reversed
+			_mm256_storeu_ps (df2 + dist * 2 - i - 7, _mm256_permutevar8x32_ps (d_2m, rev));
+			_mm256_storeu_ps (df2 + dist * 4 - i - 7, _mm256_permutevar8x32_ps (d_4m, rev));
+			_mm256_storeu_ps (df2 + dist * 6 - i - 7, _mm256_permutevar8x32_ps (d_6m, rev));
+			_mm256_storeu_ps (df2 + dist * 8 - i - 7, _mm256_permutevar8x32_ps (d_8m, rev));
+		}
+
+		coef_index += dist * 8;
+	}
+	while (coef_index < len);
+}
+
+
+
+FFTRealSimd_TARGET_AVX2
+void	FFTRealSimd::direct_pass_n_avx2 (long len, DataType df [], const DataType sf [], long dist, long i_end, const DataType tw_ptr [])
+{
+	const long		c1_r = 0;
+	const long		c1_i = dist;
+	const long		c2_r = dist * 2;
+	const long		c2_i = dist * 3;
+	const long		cend = dist * 4;
+	const DataType	* const	cos_ptr = tw_ptr;
+	const DataType	* const	sin_ptr = tw_ptr + dist;
+	const __m256i	rev = _mm256_setr_epi32 (7, 6, 5, 4, 3, 2, 1, 0);
+
+	long				coef_index = 0;
+	do
+	{
+		const DataType	* const	sf2 = sf + coef_index;
+		DataType			* const	df2 = df + coef_index;
+
+		// Extreme coefficients are always real
+		df2 [c1_r] = sf2 [c1_r] + sf2 [c2_r];
+		df2 [c2_r] = sf2 [c1_r] - sf2 [c2_r];
+		df2 [c1_i] = sf2 [c1_i];
+		df2 [c2_i] = sf2 [c2_i];
+
+		long				i = 1;
+		for ( ; i < 4; ++i)
+		{
+			butterfly_direct (df2, sf2, dist, i, cos_ptr [i], sin_ptr [i]);
+		}
+
+		// Indexes 4 to 7 if dist is large enough, then full 8-float vectors
+		if (i < i_end)
+		{
+			const __m128	c = _mm_loadu_ps (cos_ptr + i);
+			const __m128	s = _mm_loadu_ps (sin_ptr + i);
+			const __m128	sf_r_i = _mm_loadu_ps (sf2 + c1_r + i);
+			const __m128	sf_i_i = _mm_loadu_ps (sf2 + c1_i + i);
+			const __m128	sf_2r = _mm_loadu_ps (sf2 + c2_r + i);
+			const __m128	sf_2i = _mm_loadu_ps (sf2 + c2_i + i);
+
+			const __m128	v1 = _mm_sub_ps (_mm_mul_ps (sf_2r, c), _mm_mul_ps (sf_2i, s));
+			const __m128	v2 = _mm_add_ps (_mm_mul_ps (sf_2r, s), _mm_mul_ps (sf_2i, c));
+
+			const __m128	d_1 = _mm_sub_ps (sf_r_i, v1);
+			const __m128	d_3 = _mm_sub_ps (v2, sf_i_i);
+
+			_mm_storeu_ps (df2 + c1_r + i, _mm_add_ps (sf_r_i, v1));
+			_mm_storeu_ps (df2 + c2_r - i - 3, _mm_shuffle_ps (d_1, d_1, _MM_SHUFFLE (0, 1, 2, 3)));
+			_mm_storeu_ps (df2 + c2_r + i, _mm_add_ps (v2, sf_i_i));
+			_mm_storeu_ps (df2 + cend - i - 3, _mm_shuffle_ps (d_3, d_3, _MM_SHUFFLE (0, 1, 2, 3)));
+
+			i += 4;
+		}
+
+		for ( ; i < i_end; i += 8)
+		{
+			const __m256	c = _mm256_loadu_ps (cos_ptr + i);
+			const __m256	s = _mm256_loadu_ps (sin_ptr + i);
+			const __m256	sf_r_i = _mm256_loadu_ps (sf2 + c1_r + i);
+			const __m256	sf_i_i = _mm256_loadu_ps (sf2 + c1_i + i);
+			const __m256	sf_2r = _mm256_loadu_ps (sf2 + c2_r + i);
+			const __m256	sf_2i = _mm256_loadu_ps (sf2 + c2_i + i);
+
+			const __m256	v1 = _mm256_sub_ps (_mm256_mul_ps (sf_2r, c), _mm256_mul_ps (sf_2i, s));
+			const __m256	v2 = _mm256_add_ps (_mm256_mul_ps (sf_2r, s), _mm256_mul_ps (sf_2i, c));
+
+			const __m256	d_1 = _mm256_sub_ps (sf_r_i, v1);
+			const __m256	d_3 = _mm256_sub_ps (v2, sf_i_i);
+
+			_mm256_storeu_ps (df2 + c1_r + i, _mm256_add_ps (sf_r_i, v1));
+			_mm256_storeu_ps (df2 + c2_r - i - 7, _mm256_permutevar8x32_ps (d_1, rev));
+			_mm256_storeu_ps (df2 + c2_r + i, _mm256_add_ps (v2, sf_i_i));
+			_mm256_storeu_ps (df2 + cend - i - 7, _mm256_permutevar8x32_ps (d_3, rev));
+		}
+
+		coef_index += cend;
+	}
+	while (coef_index < len);
+}
+
+
+
+FFTRealSimd_TARGET_SSE2
+void	FFTRealSimd::inverse_pass_n_sse2 (long len, DataType df [], const DataType sf [], long dist, const DataType tw_ptr [])
+{
+	const long		c1_r = 0;
+	const long		c1_i = dist;
+	const long		c2_r = dist * 2;
+	const long		c2_i = dist * 3;
+	const long		cend = dist * 4;
+	const DataType	* const	cos_ptr = tw_ptr;
+	const DataType	* const	sin_ptr = tw_ptr + dist;
+
+	long				coef_index = 0;
+	do
+	{
+		const DataType	* const	sf2 = sf + coef_index;
+		DataType			* const	df2 = df + coef_index;
+
+		// Extreme coefficients are always real
+		df2 [c1_r] = sf2 [c1_r] + sf2 [c2_r];
+		df2 [c2_r] = sf2 [c1_r] - sf2 [c2_r];
+		df2 [c1_i] = sf2 [c1_i] * 2;
+		df2 [c2_i] = sf2 [c2_i] * 2;
+
+		for (long i = 1; i < 4; ++i)
+		{
+			butterfly_inverse (df2, sf2, dist, i, cos_ptr [i], sin_ptr [i]);
+		}
+
+		for (long i = 4; i < dist; i += 4)
+		{
+			const __m128	c = _mm_loadu_ps (cos_ptr + i);
+			const __m128	s = _mm_loadu_ps (sin_ptr + i);
+
+			// Descending indexes: load reversed
+			const __m128	b_rev = _mm_loadu_ps (sf2 + c2_r - i - 3);
+			const __m128	d_rev = _mm_loadu_ps (sf2 + cend - i - 3);
+			const __m128	a = _mm_loadu_ps (sf2 + c1_r + i);
+			const __m128	b = _mm_shuffle_ps (b_rev, b_rev, _MM_SHUFFLE (0, 1, 2, 3));
+			const __m128	e = _mm_loadu_ps (sf2 + c2_r + i);
+			const __m128	d = _mm_shuffle_ps (d_rev, d_rev, _MM_SHUFFLE (0, 1, 2, 3));
+
+			_mm_storeu_ps (df2 + c1_r + i, _mm_add_ps (a, b));
+			_mm_storeu_ps (df2 + c1_i + i, _mm_sub_ps (e, d));
+
+			const __m128	vr = _mm_sub_ps (a, b);
+			const __m128	vi = _mm_add_ps (e, d);
+
+			_mm_storeu_ps (df2 + c2_r + i, _mm_add_ps (_mm_mul_ps (vr, c), _mm_mul_ps (vi, s)));
+			_mm_storeu_ps (df2 + c2_i + i, _mm_sub_ps (_mm_mul_ps (vi, c), _mm_mul_ps (vr, s)));
+		}
+
+		coef_index += cend;
+	}
+	while (coef_index < len);
+}
+
+
+
+FFTRealSimd_TARGET_AVX2
+void	FFTRealSimd::inverse_pass_n_avx2 (long len, DataType df [], const DataType sf [], long dist, const DataType tw_ptr [])
+{
+	const long		c1_r = 0;
+	const long		c1_i = dist;
+	const long		c2_r = dist * 2;
+	const long		c2_i = dist * 3;
+	const long		cend = dist * 4;
+	const DataType	* const	cos_ptr = tw_ptr;
+	const DataType	* const	sin_ptr = tw_ptr + dist;
+	const __m256i	rev = _mm256_setr_epi32 (7, 6, 5, 4, 3, 2, 1, 0);
+
+	long				coef_index = 0;
+	do
+	{
+		const DataType	* const	sf2 = sf + coef_index;
+		DataType			* const	df2 = df + coef_index;
+
+		// Extreme coefficients are always real
+		df2 [c1_r] = sf2 [c1_r] + sf2 [c2_r];
+		df2 [c2_r] = sf2 [c1_r] - sf2 [c2_r];
+		df2 [c1_i] = sf2 [c1_i] * 2;
+		df2 [c2_i] = sf2 [c2_i] * 2;
+
+		long				i = 1;
+		for ( ; i < 4; ++i)
+		{
+			butterfly_inverse (df2, sf2, dist, i, cos_ptr [i], sin_ptr [i]);
+		}
+
+		if (i < dist)
+		{
+			const __m128	c = _mm_loadu_ps (cos_ptr + i);
+			const __m128	s = _mm_loadu_ps (sin_ptr + i);
+
+			const __m128	b_rev = _mm_loadu_ps (sf2 + c2_r - i - 3);
+			const __m128	d_rev = _mm_loadu_ps (sf2 + cend - i - 3);
+			const __m128	a = _mm_loadu_ps (sf2 + c1_r + i);
+			const __m128	b = _mm_shuffle_ps (b_rev, b_rev, _MM_SHUFFLE (0, 1, 2, 3));
+			const __m128	e = _mm_loadu_ps (sf2 + c2_r + i);
+			const __m128	d = _mm_shuffle_ps (d_rev, d_rev, _MM_SHUFFLE (0, 1, 2, 3));
+
+			_mm_storeu_ps (df2 + c1_r + i, _mm_add_ps (a, b));
+			_mm_storeu_ps (df2 + c1_i + i, _mm_sub_ps (e, d));
+
+			const __m128	vr = _mm_sub_ps (a, b);
+			const __m128	vi = _mm_add_ps (e, d);
+
+			_mm_storeu_ps (df2 + c2_r + i, _mm_add_ps (_mm_mul_ps (vr, c), _mm_mul_ps (vi, s)));
+			_mm_storeu_ps (df2 + c2_i + i, _mm_sub_ps (_mm_mul_ps (vi, c), _mm_mul_ps (vr, s)));
+
+			i += 4;
+		}
+
+		for ( ; i < dist; i += 8)
+		{
+			const __m256	c = _mm256_loadu_ps (cos_ptr + i);
+			const __m256	s = _mm256_loadu_ps (sin_ptr + i);
+
+			const __m256	a = _mm256_loadu_ps (sf2 + c1_r + i);
+			const __m256	b = _mm256_permutevar8x32_ps (_mm256_loadu_ps (sf2 + c2_r - i - 7), rev);
+			const __m256	e = _mm256_loadu_ps (sf2 + c2_r + i);
+			const __m256	d = _mm256_permutevar8x32_ps (_mm256_loadu_ps (sf2 + cend - i - 7), rev);
+
+			_mm256_storeu_ps (df2 + c1_r + i, _mm256_add_ps (a, b));
+			_mm256_storeu_ps (df2 + c1_i + i, _mm256_sub_ps (e, d));
+
+			const __m256	vr = _mm256_sub_ps (a, b);
+			const __m256	vi = _mm256_add_ps (e, d);
+
+			_mm256_storeu_ps (df2 + c2_r + i, _mm256_add_ps (_mm256_mul_ps (vr, c), _mm256_mul_ps (vi, s)));
+			_mm256_storeu_ps (df2 + c2_i + i, _mm256_sub_ps (_mm256_mul_ps (vi, c), _mm256_mul_ps (vr, s)));
+		}
+
+		coef_index += cend;
+	}
+	while (coef_index < len);
+}
+
+
+
+FFTRealSimd_TARGET_SSE2
+void	FFTRealSimd::inverse_pass_3_sse2 (long len, DataType df [], const DataType sf [])
+{
+	const __m128	sqrt2_2 = _mm_set1_ps (DataType (SQRT2 * 0.5));
+	const __m128	two = _mm_set1_ps (2);
+
+	long				coef_index = 0;
+	do
+	{
+		const DataType	* const	sf2 = sf + coef_index;
+		DataType			* const	df2 = df + coef_index;
+
+		__m128			a_0 = _mm_loadu_ps (sf2     );
+		__m128			a_1 = _mm_loadu_ps (sf2 +  8);
+		__m128			a_2 = _mm_loadu_ps (sf2 + 16);
+		__m128			a_3 = _mm_loadu_ps (sf2 + 24);
+		_MM_TRANSPOSE4_PS (a_0, a_1, a_2, a_3);
+
+		__m128			b_0 = _mm_loadu_ps (sf2 +  4);
+		__m128			b_1 = _mm_loadu_ps (sf2 + 12);
+		__m128			b_2 = _mm_loadu_ps (sf2 + 20);
+		__m128			b_3 = _mm_loadu_ps (sf2 + 28);
+		_MM_TRANSPOSE4_PS (b_0, b_1, b_2, b_3);
+
+		const __m128	vr = _mm_sub_ps (a_1, a_3);
+		const __m128	vi = _mm_add_ps (b_1, b_3);
+
+		__m128			d_0 = _mm_add_ps (a_0, b_0);
+		__m128			d_1 = _mm_add_ps (a_1, a_3);
+		__m128			d_2 = _mm_mul_ps (a_2, two);
+		__m128			d_3 = _mm_sub_ps (b_1, b_3);
+		__m128			d_4 = _mm_sub_ps (a_0, b_0);
+		__m128			d_5 = _mm_mul_ps (_mm_add_ps (vr, vi), sqrt2_2);
+		__m128			d_6 = _mm_mul_ps (b_2, two);
+		__m128			d_7 = _mm_mul_ps (_mm_sub_ps (vi, vr), sqrt2_2);
+		_MM_TRANSPOSE4_PS (d_0, d_1, d_2, d_3);
+		_MM_TRANSPOSE4_PS (d_4, d_5, d_6, d_7);
+
+		_mm_storeu_ps (df2     , d_0);
+		_mm_storeu_ps (df2 +  4, d_4);
+		_mm_storeu_ps (df2 +  8, d_1);
+		_mm_storeu_ps (df2 + 12, d_5);
+		_mm_storeu_ps (df2 + 16, d_2);
+		_mm_storeu_ps (df2 + 20, d_6);
+		_mm_storeu_ps (df2 + 24, d_3);
+		_mm_storeu_ps (df2 + 28, d_7);
+
+		coef_index += 32;
+	}
+	while (coef_index < len);
+}
+
+
+
+FFTRealSimd_TARGET_SSE2
+void	FFTRealSimd::inverse_pass_1_2_sse2 (long len, DataType x [], const DataType sf [], const long br_ptr [])
+{
+	const long		qlen = len >> 2;
+	const __m128	two = _mm_set1_ps (2);
+
+	long				coef_index = 0;
+	do
+	{
+		const DataType	* const	sf2 = sf + coef_index;
+
+		__m128			s_0 = _mm_loadu_ps (sf2     );
+		__m128			s_1 = _mm_loadu_ps (sf2 +  4);
+		__m128			s_2 = _mm_loadu_ps (sf2 +  8);
+		__m128			s_3 = _mm_loadu_ps (sf2 + 12);
+		_MM_TRANSPOSE4_PS (s_0, s_1, s_2, s_3);
+
+		const __m128	b_0 = _mm_add_ps (s_0, s_2);
+		const __m128	b_2 = _mm_sub_ps (s_0, s_2);
+		const __m128	b_1 = _mm_mul_ps (s_1, two);
+		const __m128	b_3 = _mm_mul_ps (s_3, two);
+
+		// Results are scattered with the bit-reversal table
+		DataType			res [4] [4];
+		_mm_storeu_ps (res [0], _mm_add_ps (b_0, b_1));
+		_mm_storeu_ps (res [1], _mm_sub_ps (b_0, b_1));
+		_mm_storeu_ps (res [2], _mm_add_ps (b_2, b_3));
+		_mm_storeu_ps (res [3], _mm_sub_ps (b_2, b_3));
+
+		const long * const	br2 = br_ptr + (coef_index >> 2);
+		for (int k = 0; k < 4; ++k)
+		{
+			const long		ri_0 = br2 [k];
+			x [ri_0           ] = res [0] [k];
+			x [ri_0 + 2 * qlen] = res [1] [k];
+			x [ri_0 + 1 * qlen] = res [2] [k];
+			x [ri_0 + 3 * qlen] = res [3] [k];
+		}
+
+		coef_index += 16;
+	}
+	while (coef_index < len);
+}
+
+
+
+
+
+FFTRealSimd_TARGET_SSE2
+void	FFTRealSimd::direct_pass_power_sse2 (long len, DataType p [], const DataType sf [], long i_end, const DataType tw_ptr [])
+{
+	const long		dist = len >> 2;
+	const long		c1_r = 0;
+	const long		c1_i = dist;
+	const long		c2_r = dist * 2;
+	const long		c2_i = dist * 3;
+	const DataType	* const	cos_ptr = tw_ptr;
+	const DataType	* const	sin_ptr = tw_ptr + dist;
+
+	// Extreme coefficients are always real, the middle one is
+	// sf [c1_i] + j * sf [c2_i]
+	const DataType	dc = sf [c1_r] + sf [c2_r];
+	const DataType	ny = sf [c1_r] - sf [c2_r];
+	p [c1_r] = dc * dc;
+	p [c2_r] = ny * ny;
+	p [c1_i] = sf [c1_i] * sf [c1_i] + sf [c2_i] * sf [c2_i];
+
+	for (long i = 1; i < 4; ++i)
+	{
+		butterfly_power (p, sf, dist, i, cos_ptr [i], sin_ptr [i]);
+	}
+
+	for (long i = 4; i < i_end; i += 4)
+	{
+		const __m128	c = _mm_loadu_ps (cos_ptr + i);
+		const __m128	s = _mm_loadu_ps (sin_ptr + i);
+		const __m128	sf_r_i = _mm_loadu_ps (sf + c1_r + i);
+		const __m128	sf_i_i = _mm_loadu_ps (sf + c1_i + i);
+		const __m128	sf_2r = _mm_loadu_ps (sf + c2_r + i);
+		const __m128	sf_2i = _mm_loadu_ps (sf + c2_i + i);
+
+		const __m128	v1 = _mm_sub_ps (_mm_mul_ps (sf_2r, c), _mm_mul_ps (sf_2i, s));
+		const __m128	v2 = _mm_add_ps (_mm_mul_ps (sf_2r, s), _mm_mul_ps (sf_2i, c));
+
+		const __m128	re_1 = _mm_add_ps (sf_r_i, v1);
+		const __m128	im_1 = _mm_add_ps (v2, sf_i_i);
+		const __m128	re_2 = _mm_sub_ps (sf_r_i, v1);
+		const __m128	im_2 = _mm_sub_ps (v2, sf_i_i);
+		const __m128	p_1 = _mm_add_ps (_mm_mul_ps (re_1, re_1), _mm_mul_ps (im_1, im_1));
+		const __m128	p_2 = _mm_add_ps (_mm_mul_ps (re_2, re_2), _mm_mul_ps (im_2, im_2));
+
+		// Descending indexes: store reversed
+		_mm_storeu_ps (p + i, p_1);
+		_mm_storeu_ps (p + c2_r - i - 3, _mm_shuffle_ps (p_2, p_2, _MM_SHUFFLE (0, 1, 2, 3)));
+	}
+}
+
+
+
+FFTRealSimd_TARGET_SSE2
+void	FFTRealSimd::power_to_log_sse2 (long nbr_bins, DataType buf [], DataType scale)
+{
+	// ln (sqrt (x)) = 0.5 * ln (x)
+	const __m128	mul = _mm_set1_ps (scale * 0.5f);
+	const __m128	min_val = _mm_set1_ps (FLT_MIN);
+
+	long				pos = 0;
+	for ( ; pos + 4 <= nbr_bins; pos += 4)
+	{
+		const __m128	x = _mm_max_ps (_mm_loadu_ps (buf + pos), min_val);
+		_mm_storeu_ps (buf + pos, _mm_mul_ps (log_sse2 (x), mul));
+	}
+
+	// Remaining values, through a padded vector
+	if (pos < nbr_bins)
+	{
+		float				tmp [4] = { 1, 1, 1, 1 };
+		const long		nbr_rem = nbr_bins - pos;
+		for (long k = 0; k < nbr_rem; ++k)
+		{
+			tmp [k] = buf [pos + k];
+		}
+		const __m128	x = _mm_max_ps (_mm_loadu_ps (tmp), min_val);
+		_mm_storeu_ps (tmp, _mm_mul_ps (log_sse2 (x), mul));
+		for (long k = 0; k < nbr_rem; ++k)
+		{
+			buf [pos + k] = tmp [k];
+		}
+	}
+}
+
+
+
+// Natural logarithm of normalised, positive numbers (Cephes logf algorithm)
+FFTRealSimd_TARGET_SSE2
+__m128	FFTRealSimd::log_sse2 (__m128 x)
+{
+	const __m128	one = _mm_set1_ps (1.0f);
+
+	// x = m * 2^e, m in [0.5 ; 1[
+	const __m128i	xi = _mm_castps_si128 (x);
+	__m128			e = _mm_cvtepi32_ps (_mm_sub_epi32 (
+		_mm_srli_epi32 (xi, 23),
+		_mm_set1_epi32 (126)
+	));
+	__m128			m = _mm_castsi128_ps (_mm_or_si128 (
+		_mm_and_si128 (xi, _mm_set1_epi32 (0x007FFFFF)),
+		_mm_set1_epi32 (0x3F000000)
+	));
+
+	// Brings m in [sqrt(0.5) ; sqrt(2)[ and takes m - 1
+	const __m128	lt_mask = _mm_cmplt_ps (m, _mm_set1_ps (0.707106781186547524f));
+	e = _mm_sub_ps (e, _mm_and_ps (one, lt_mask));
+	m = _mm_add_ps (_mm_sub_ps (m, one), _mm_and_ps (m, lt_mask));
+
+	const __m128	z = _mm_mul_ps (m, m);
+	__m128			y = _mm_set1_ps (7.0376836292E-2f);
+	y = _mm_add_ps (_mm_mul_ps (y, m), _mm_set1_ps (-1.1514610310E-1f));
+	y = _mm_add_ps (_mm_mul_ps (y, m), _mm_set1_ps ( 1.1676998740E-1f));
+	y = _mm_add_ps (_mm_mul_ps (y, m), _mm_set1_ps (-1.2420140846E-1f));
+	y = _mm_add_ps (_mm_mul_ps (y, m), _mm_set1_ps ( 1.4249322787E-1f));
+	y = _mm_add_ps (_mm_mul_ps (y, m), _mm_set1_ps (-1.6668057665E-1f));
+	y = _mm_add_ps (_mm_mul_ps (y, m), _mm_set1_ps ( 2.0000714765E-1f));
+	y = _mm_add_ps (_mm_mul_ps (y, m), _mm_set1_ps (-2.4999993993E-1f));
+	y = _mm_add_ps (_mm_mul_ps (y, m), _mm_set1_ps ( 3.3333331174E-1f));
+	y = _mm_mul_ps (_mm_mul_ps (y, m), z);
+
+	// ln (2) is split in two parts to keep the precision
+	y = _mm_add_ps (y, _mm_mul_ps (e, _mm_set1_ps (-2.12194440E-4f)));
+	y = _mm_sub_ps (y, _mm_mul_ps (z, _mm_set1_ps (0.5f)));
+	__m128			r = _mm_add_ps (m, y);
+	r = _mm_add_ps (r, _mm_mul_ps (e, _mm_set1_ps (0.693359375f)));
+
+	return (r);
+}
+
+
+
+#endif	// FFTRealSimd_X86
+
+
+
+#endif	// FFTRealSimd_CODEHEADER_INCLUDED
+
+#undef FFTRealSimd_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
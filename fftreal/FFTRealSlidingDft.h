@@ -0,0 +1,132 @@
+/*****************************************************************************
+
+        FFTRealSlidingDft.h
+
+Sliding DFT: keeps a range of bins of the DFT of the last length samples
+up to date, sample by sample. Each new sample costs one complex
+multiplication per bin, instead of a whole FFT per analysis hop:
+
+	X' [k] = (X [k] + x [new] - x [oldest]) * exp (j * 2 * PI * k / length)
+
+The bins are those of a rectangular window. A Hann window can be applied
+when reading them, by combining each bin with its two neighbours, which are
+tracked too. The recursion runs in double precision so its rounding errors
+stay far below the ones of DataType, even after hours of signal.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealSlidingDft_HEADER_INCLUDED)
+#define	FFTRealSlidingDft_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"DynArray.h"
+
+
+
+template <class DT>
+class FFTRealSlidingDft
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+
+						FFTRealSlidingDft (long length, long bin_beg, long bin_end);
+	virtual			~FFTRealSlidingDft () {}
+
+	long				get_length () const;
+	long				get_bin_beg () const;
+	long				get_bin_end () const;
+
+	void				clear ();
+	inline void		process_sample (DataType x);
+	void				process_block (const DataType x [], long nbr_spl);
+
+	void				get_bins (DataType re [], DataType im [], bool hann_flag = false) const;
+	void				get_power_spectrum (DataType p [], bool hann_flag = false) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	inline void		get_bin (double &re, double &im, long bin, bool hann_flag) const;
+
+	const long		_length;
+	const long		_bin_beg;
+	const long		_bin_end;
+	const long		_nbr_state;		// Bins _bin_beg - 1 to _bin_end
+	DynArray <double>
+						_state_re;
+	DynArray <double>
+						_state_im;
+	DynArray <double>
+						_cos;
+	DynArray <double>
+						_sin;
+	DynArray <DataType>
+						_hist;			// Last _length samples, circular
+	long				_hist_pos;		// Oldest sample
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealSlidingDft ();
+						FFTRealSlidingDft (const FFTRealSlidingDft &other);
+	FFTRealSlidingDft &
+						operator = (const FFTRealSlidingDft &other);
+	bool				operator == (const FFTRealSlidingDft &other);
+	bool				operator != (const FFTRealSlidingDft &other);
+
+};	// class FFTRealSlidingDft
+
+
+
+#include	"FFTRealSlidingDft.hpp"
+
+
+
+#endif	// FFTRealSlidingDft_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,310 @@
+/*****************************************************************************
+
+        FFTRealSlidingDft.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealSlidingDft_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealSlidingDft code header.
+#endif
+#define	FFTRealSlidingDft_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealSlidingDft_CODEHEADER_INCLUDED)
+#define	FFTRealSlidingDft_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Description:
+	The history starts with length null samples.
+Input parameters:
+	- length: number of samples of the analysis window. Range: > 1.
+	- bin_beg: first bin to track.
+	- bin_end: last bin to track + 1. Range: ]bin_beg ; length/2 + 1].
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+FFTRealSlidingDft <DT>::FFTRealSlidingDft (long length, long bin_beg, long bin_end)
+:	_length (length)
+,	_bin_beg (bin_beg)
+,	_bin_end (bin_end)
+,	_nbr_state (bin_end - bin_beg + 2)
+,	_state_re (_nbr_state)
+,	_state_im (_nbr_state)
+,	_cos (_nbr_state)
+,	_sin (_nbr_state)
+,	_hist (length)
+,	_hist_pos (0)
+{
+	assert (length > 1);
+	assert (bin_beg >= 0);
+	assert (bin_beg < bin_end);
+	assert (bin_end <= length / 2 + 1);
+
+	using namespace std;
+
+	for (long pos = 0; pos < _nbr_state; ++pos)
+	{
+		const long		bin = _bin_beg - 1 + pos;
+		const double	angle = (2 * PI) * bin / _length;
+		_cos [pos] = cos (angle);
+		_sin [pos] = sin (angle);
+	}
+
+	clear ();
+}
+
+
+
+template <class DT>
+long	FFTRealSlidingDft <DT>::get_length () const
+{
+	return (_length);
+}
+
+
+
+template <class DT>
+long	FFTRealSlidingDft <DT>::get_bin_beg () const
+{
+	return (_bin_beg);
+}
+
+
+
+template <class DT>
+long	FFTRealSlidingDft <DT>::get_bin_end () const
+{
+	return (_bin_end);
+}
+
+
+
+/*
+==============================================================================
+Name: clear
+Description:
+	Fills the history with null samples.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealSlidingDft <DT>::clear ()
+{
+	for (long pos = 0; pos < _nbr_state; ++pos)
+	{
+		_state_re [pos] = 0;
+		_state_im [pos] = 0;
+	}
+	for (long pos = 0; pos < _length; ++pos)
+	{
+		_hist [pos] = 0;
+	}
+	_hist_pos = 0;
+}
+
+
+
+/*
+==============================================================================
+Name: process_sample
+Description:
+	Adds a sample to the window, removing the oldest one, and updates the
+	tracked bins. Costs one complex multiplication per bin.
+Input parameters:
+	- x: new sample.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealSlidingDft <DT>::process_sample (DataType x)
+{
+	const double	delta = double (x) - double (_hist [_hist_pos]);
+	_hist [_hist_pos] = x;
+	++ _hist_pos;
+	if (_hist_pos == _length)
+	{
+		_hist_pos = 0;
+	}
+
+	double * const	re_ptr = &_state_re [0];
+	double * const	im_ptr = &_state_im [0];
+	const double * const	cos_ptr = &_cos [0];
+	const double * const	sin_ptr = &_sin [0];
+	for (long pos = 0; pos < _nbr_state; ++pos)
+	{
+		const double	re = re_ptr [pos] + delta;
+		const double	im = im_ptr [pos];
+		re_ptr [pos] = re * cos_ptr [pos] - im * sin_ptr [pos];
+		im_ptr [pos] = re * sin_ptr [pos] + im * cos_ptr [pos];
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: process_block
+Description:
+	Same as calling process_sample () for each sample of the block.
+Input parameters:
+	- x: new samples, oldest first.
+	- nbr_spl: number of samples. Range: >= 0.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealSlidingDft <DT>::process_block (const DataType x [], long nbr_spl)
+{
+	assert (nbr_spl >= 0);
+	assert (x != 0 || nbr_spl == 0);
+
+	for (long pos = 0; pos < nbr_spl; ++pos)
+	{
+		process_sample (x [pos]);
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: get_bins
+Description:
+	Returns the tracked bins of the DFT of the window, the oldest sample
+	having index 0:
+	X [k] = sum (x [n] * exp (-j * 2 * PI * k * n / length), n = 0...length-1)
+	Note that FFTReal stores the opposite of the imaginary parts.
+Input parameters:
+	- hann_flag: true to apply a Hann window (periodic, length samples) to
+		the history instead of a rectangular one.
+Output parameters:
+	- re: real parts of bins get_bin_beg () to get_bin_end () - 1.
+	- im: imaginary parts of the same bins.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealSlidingDft <DT>::get_bins (DataType re [], DataType im [], bool hann_flag) const
+{
+	assert (re != 0);
+	assert (im != 0);
+
+	for (long bin = _bin_beg; bin < _bin_end; ++bin)
+	{
+		double			b_re;
+		double			b_im;
+		get_bin (b_re, b_im, bin, hann_flag);
+		re [bin - _bin_beg] = DataType (b_re);
+		im [bin - _bin_beg] = DataType (b_im);
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: get_power_spectrum
+Description:
+	Returns the squared magnitudes of the tracked bins.
+Input parameters:
+	- hann_flag: true to apply a Hann window, see get_bins ().
+Output parameters:
+	- p: |X [k]|^2 for bins get_bin_beg () to get_bin_end () - 1.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealSlidingDft <DT>::get_power_spectrum (DataType p [], bool hann_flag) const
+{
+	assert (p != 0);
+
+	for (long bin = _bin_beg; bin < _bin_end; ++bin)
+	{
+		double			b_re;
+		double			b_im;
+		get_bin (b_re, b_im, bin, hann_flag);
+		p [bin - _bin_beg] = DataType (b_re * b_re + b_im * b_im);
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// The Hann window 0.5 - 0.5 * cos (2 * PI * n / length) is applied in the
+// frequency domain: 0.5 * X [k] - 0.25 * (X [k - 1] + X [k + 1]).
+template <class DT>
+void	FFTRealSlidingDft <DT>::get_bin (double &re, double &im, long bin, bool hann_flag) const
+{
+	const long		pos = bin - _bin_beg + 1;
+	assert (pos > 0);
+	assert (pos < _nbr_state - 1);
+
+	if (hann_flag)
+	{
+		re =   0.5  *  _state_re [pos]
+		     - 0.25 * (_state_re [pos - 1] + _state_re [pos + 1]);
+		im =   0.5  *  _state_im [pos]
+		     - 0.25 * (_state_im [pos - 1] + _state_im [pos + 1]);
+	}
+	else
+	{
+		re = _state_re [pos];
+		im = _state_im [pos];
+	}
+}
+
+
+
+#endif	// FFTRealSlidingDft_CODEHEADER_INCLUDED
+
+#undef FFTRealSlidingDft_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
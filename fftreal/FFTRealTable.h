@@ -0,0 +1,144 @@
+/*****************************************************************************
+
+        FFTRealTable.h
+
+Read-only lookup table shared by all the objects of the process that need
+the same contents. A table is identified by the function building it and by
+a parameter (typically the FFT length or its log2); the first object asking
+for it builds it, the following ones only increment a reference count. The
+table is freed when the last object using it is destroyed.
+
+The registry is protected by a mutex, so objects can be created and
+destroyed from any thread. Once built, a table is never written again.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealTable_HEADER_INCLUDED)
+#define	FFTRealTable_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"DynArray.h"
+
+#include	<map>
+#include	<mutex>
+
+
+
+template <class T>
+class FFTRealTable
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	T	DataType;
+	typedef	void (*BuildFnc) (DataType table_ptr [], long size, long param);
+
+						FFTRealTable (BuildFnc build_fnc_ptr, long size, long param);
+						~FFTRealTable ();
+
+	inline long		size () const;
+	inline const DataType &
+						operator [] (long pos) const;
+
+	static inline long
+						get_nbr_tables ();
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	class Key
+	{
+	public:
+		inline			Key (BuildFnc build_fnc_ptr, long size, long param);
+		inline bool		operator < (const Key &other) const;
+
+		BuildFnc			_build_fnc_ptr;
+		long				_size;
+		long				_param;
+	};
+
+	class Entry
+	{
+	public:
+		explicit inline
+							Entry (long size);
+
+		DynArray <DataType>
+							_data;
+		long				_ref_cnt;
+	};
+
+	typedef	std::map <Key, Entry *>	Registry;
+
+	static inline std::mutex &
+						use_mutex ();
+	static inline Registry &
+						use_registry ();
+
+	const Key		_key;
+	Entry *			_entry_ptr;
+	const DataType *
+						_data_ptr;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealTable ();
+						FFTRealTable (const FFTRealTable &other);
+	FFTRealTable &	operator = (const FFTRealTable &other);
+	bool				operator == (const FFTRealTable &other);
+	bool				operator != (const FFTRealTable &other);
+
+};	// class FFTRealTable
+
+
+
+#include	"FFTRealTable.hpp"
+
+
+
+#endif	// FFTRealTable_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,249 @@
+/*****************************************************************************
+
+        FFTRealTable.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealTable_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealTable code header.
+#endif
+#define	FFTRealTable_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealTable_CODEHEADER_INCLUDED)
+#define	FFTRealTable_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<functional>
+#include	<utility>
+
+#include	<cassert>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Description:
+	Gets a reference on the table built by build_fnc_ptr with the given size
+	and parameter. The table is built if no other object holds it yet.
+Input parameters:
+	- build_fnc_ptr: function filling the table. It receives the table, its
+		size and param, and must always give the same result for the same
+		arguments.
+	- size: number of elements of the table, >= 0.
+	- param: any value the build function needs, typically the FFT length.
+Throws: std::bad_alloc, std::system_error
+==============================================================================
+*/
+
+template <class T>
+FFTRealTable <T>::FFTRealTable (BuildFnc build_fnc_ptr, long size, long param)
+:	_key (build_fnc_ptr, size, param)
+,	_entry_ptr (0)
+,	_data_ptr (0)
+{
+	assert (build_fnc_ptr != 0);
+	assert (size >= 0);
+
+	std::lock_guard <std::mutex>	lock (use_mutex ());
+
+	Registry &		registry = use_registry ();
+	typename Registry::iterator	it = registry.find (_key);
+	if (it == registry.end ())
+	{
+		Entry *			entry_ptr = new Entry (size);
+		try
+		{
+			if (size > 0)
+			{
+				build_fnc_ptr (&entry_ptr->_data [0], size, param);
+			}
+			it = registry.insert (std::make_pair (_key, entry_ptr)).first;
+		}
+		catch (...)
+		{
+			delete entry_ptr;
+			throw;
+		}
+	}
+
+	_entry_ptr = it->second;
+	++ _entry_ptr->_ref_cnt;
+	if (size > 0)
+	{
+		_data_ptr = &_entry_ptr->_data [0];
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: dtor
+Description:
+	Releases the reference on the table, and frees it if it was the last one.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class T>
+FFTRealTable <T>::~FFTRealTable ()
+{
+	std::lock_guard <std::mutex>	lock (use_mutex ());
+
+	assert (_entry_ptr->_ref_cnt > 0);
+	-- _entry_ptr->_ref_cnt;
+	if (_entry_ptr->_ref_cnt == 0)
+	{
+		use_registry ().erase (_key);
+		delete _entry_ptr;
+	}
+	_entry_ptr = 0;
+	_data_ptr = 0;
+}
+
+
+
+template <class T>
+long	FFTRealTable <T>::size () const
+{
+	return (_key._size);
+}
+
+
+
+template <class T>
+const typename FFTRealTable <T>::DataType &	FFTRealTable <T>::operator [] (long pos) const
+{
+	assert (pos >= 0);
+	assert (pos < _key._size);
+
+	return (_data_ptr [pos]);
+}
+
+
+
+/*
+==============================================================================
+Name: get_nbr_tables
+Description:
+	Number of distinct tables of this element type currently alive in the
+	process. Mainly for diagnostics.
+Returns: The number of tables, >= 0.
+Throws: std::system_error
+==============================================================================
+*/
+
+template <class T>
+long	FFTRealTable <T>::get_nbr_tables ()
+{
+	std::lock_guard <std::mutex>	lock (use_mutex ());
+
+	return (static_cast <long> (use_registry ().size ()));
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class T>
+FFTRealTable <T>::Key::Key (BuildFnc build_fnc_ptr, long size, long param)
+:	_build_fnc_ptr (build_fnc_ptr)
+,	_size (size)
+,	_param (param)
+{
+	// Nothing
+}
+
+
+
+template <class T>
+bool	FFTRealTable <T>::Key::operator < (const Key &other) const
+{
+	// std::less gives a total order on function pointers, operator < doesn't
+	const std::less <BuildFnc>	fnc_less;
+
+	if (_build_fnc_ptr != other._build_fnc_ptr)
+	{
+		return (fnc_less (_build_fnc_ptr, other._build_fnc_ptr));
+	}
+	if (_size != other._size)
+	{
+		return (_size < other._size);
+	}
+
+	return (_param < other._param);
+}
+
+
+
+template <class T>
+FFTRealTable <T>::Entry::Entry (long size)
+:	_data (size)
+,	_ref_cnt (0)
+{
+	// Nothing
+}
+
+
+
+// Function-local statics: constructed on first use, whatever the order of
+// initialisation of the translation units.
+template <class T>
+std::mutex &	FFTRealTable <T>::use_mutex ()
+{
+	static std::mutex	mutex;
+
+	return (mutex);
+}
+
+
+
+template <class T>
+typename FFTRealTable <T>::Registry &	FFTRealTable <T>::use_registry ()
+{
+	static Registry	registry;
+
+	return (registry);
+}
+
+
+
+#endif	// FFTRealTable_CODEHEADER_INCLUDED
+
+#undef FFTRealTable_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
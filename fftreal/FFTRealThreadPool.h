@@ -0,0 +1,135 @@
+/*****************************************************************************
+
+        FFTRealThreadPool.h
+
+Set of worker threads running the same task together, to spread the passes
+of a long transform over several cores. run () calls the task function once
+per thread with the index of the part to process, the calling thread
+processing part 0, and returns when all the parts are done.
+
+The workers spin a short while before going to sleep, so consecutive calls
+(one per FFT pass) don't pay for a full wake-up each time. A pool can be
+shared by several FFT objects; calls to run () from different threads are
+serialised.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (FFTRealThreadPool_HEADER_INCLUDED)
+#define	FFTRealThreadPool_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"DynArray.h"
+
+#include	<atomic>
+#include	<condition_variable>
+#include	<mutex>
+#include	<thread>
+
+
+
+class FFTRealThreadPool
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	void (*TaskFnc) (void *ctx_ptr, int part, int nbr_parts);
+
+	// Number of checks for new work or for the end of the work before
+	// sleeping.
+	enum {			SPIN_COUNT		= 2000	};
+
+	explicit inline
+						FFTRealThreadPool (int nbr_threads);
+	inline			~FFTRealThreadPool ();
+
+	inline int		get_nbr_threads () const;
+	inline void		run (TaskFnc fnc_ptr, void *ctx_ptr);
+
+	static inline int
+						get_nbr_cores ();
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	inline void		process_worker (int part);
+
+	const int		_nbr_threads;
+	std::mutex		_run_mutex;			// Serialises the calls to run ()
+	std::mutex		_mutex;				// Protects the sleeping states
+	std::condition_variable
+						_cond_start;
+	std::condition_variable
+						_cond_done;
+	std::atomic <long>
+						_generation;		// Incremented for each task
+	std::atomic <int>
+						_nbr_pending;		// Workers still busy with the task
+	TaskFnc			_fnc_ptr;
+	void *			_ctx_ptr;
+	bool				_quit_flag;
+	DynArray <std::thread>
+						_thread_arr;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealThreadPool ();
+						FFTRealThreadPool (const FFTRealThreadPool &other);
+	FFTRealThreadPool &
+						operator = (const FFTRealThreadPool &other);
+	bool				operator == (const FFTRealThreadPool &other);
+	bool				operator != (const FFTRealThreadPool &other);
+
+};	// class FFTRealThreadPool
+
+
+
+#include	"FFTRealThreadPool.hpp"
+
+
+
+#endif	// FFTRealThreadPool_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
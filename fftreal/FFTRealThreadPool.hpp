@@ -0,0 +1,262 @@
+/*****************************************************************************
+
+        FFTRealThreadPool.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealThreadPool_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealThreadPool code header.
+#endif
+#define	FFTRealThreadPool_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealThreadPool_CODEHEADER_INCLUDED)
+#define	FFTRealThreadPool_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Description:
+	Starts nbr_threads - 1 worker threads. With a single thread, run () only
+	calls the task function from the calling thread.
+Input parameters:
+	- nbr_threads: number of threads sharing a task, the calling thread
+		included. Range: > 0, see get_nbr_cores ().
+Throws: std::bad_alloc, std::system_error
+==============================================================================
+*/
+
+FFTRealThreadPool::FFTRealThreadPool (int nbr_threads)
+:	_nbr_threads (nbr_threads)
+,	_run_mutex ()
+,	_mutex ()
+,	_cond_start ()
+,	_cond_done ()
+,	_generation (0)
+,	_nbr_pending (0)
+,	_fnc_ptr (0)
+,	_ctx_ptr (0)
+,	_quit_flag (false)
+,	_thread_arr (nbr_threads - 1)
+{
+	assert (nbr_threads > 0);
+
+	int				nbr_started = 0;
+	try
+	{
+		for ( ; nbr_started < nbr_threads - 1; ++ nbr_started)
+		{
+			_thread_arr [nbr_started] = std::thread (
+				&FFTRealThreadPool::process_worker, this, nbr_started + 1
+			);
+		}
+	}
+	catch (...)
+	{
+		{
+			std::lock_guard <std::mutex>	lock (_mutex);
+			_quit_flag = true;
+			++ _generation;
+		}
+		_cond_start.notify_all ();
+		for (int i = 0; i < nbr_started; ++i)
+		{
+			_thread_arr [i].join ();
+		}
+		throw;
+	}
+}
+
+
+
+FFTRealThreadPool::~FFTRealThreadPool ()
+{
+	{
+		std::lock_guard <std::mutex>	lock (_mutex);
+		_quit_flag = true;
+		++ _generation;
+	}
+	_cond_start.notify_all ();
+
+	for (int i = 0; i < _nbr_threads - 1; ++i)
+	{
+		_thread_arr [i].join ();
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: get_nbr_threads
+Returns: The number of threads sharing a task, the calling thread included.
+Throws: Nothing
+==============================================================================
+*/
+
+int	FFTRealThreadPool::get_nbr_threads () const
+{
+	return (_nbr_threads);
+}
+
+
+
+/*
+==============================================================================
+Name: run
+Description:
+	Calls fnc_ptr (ctx_ptr, part, get_nbr_threads ()) for each part in
+	[0 ; get_nbr_threads ()[, each one from a different thread, and waits
+	for all of them to return. The function must not throw.
+Input parameters:
+	- fnc_ptr: task function.
+	- ctx_ptr: parameter passed to the task function.
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealThreadPool::run (TaskFnc fnc_ptr, void *ctx_ptr)
+{
+	assert (fnc_ptr != 0);
+
+	if (_nbr_threads == 1)
+	{
+		fnc_ptr (ctx_ptr, 0, 1);
+		return;
+	}
+
+	std::lock_guard <std::mutex>	run_lock (_run_mutex);
+
+	_fnc_ptr = fnc_ptr;
+	_ctx_ptr = ctx_ptr;
+	_nbr_pending.store (_nbr_threads - 1, std::memory_order_relaxed);
+	{
+		std::lock_guard <std::mutex>	lock (_mutex);
+		_generation.fetch_add (1, std::memory_order_release);
+	}
+	_cond_start.notify_all ();
+
+	fnc_ptr (ctx_ptr, 0, _nbr_threads);
+
+	for (int spin = 0
+	;	spin < SPIN_COUNT && _nbr_pending.load (std::memory_order_acquire) > 0
+	;	++ spin)
+	{
+		std::this_thread::yield ();
+	}
+	if (_nbr_pending.load (std::memory_order_acquire) > 0)
+	{
+		std::unique_lock <std::mutex>	lock (_mutex);
+		while (_nbr_pending.load (std::memory_order_acquire) > 0)
+		{
+			_cond_done.wait (lock);
+		}
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: get_nbr_cores
+Description:
+	Number of threads the hardware can run at the same time.
+Returns: The number of threads, > 0.
+Throws: Nothing
+==============================================================================
+*/
+
+int	FFTRealThreadPool::get_nbr_cores ()
+{
+	const int		nbr_cores = int (std::thread::hardware_concurrency ());
+
+	return ((nbr_cores > 0) ? nbr_cores : 1);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+void	FFTRealThreadPool::process_worker (int part)
+{
+	long				last_gen = 0;
+
+	for ( ; ; )
+	{
+		long				gen = _generation.load (std::memory_order_acquire);
+		for (int spin = 0; spin < SPIN_COUNT && gen == last_gen; ++ spin)
+		{
+			std::this_thread::yield ();
+			gen = _generation.load (std::memory_order_acquire);
+		}
+		if (gen == last_gen)
+		{
+			std::unique_lock <std::mutex>	lock (_mutex);
+			while (_generation.load (std::memory_order_acquire) == last_gen)
+			{
+				_cond_start.wait (lock);
+			}
+			gen = _generation.load (std::memory_order_acquire);
+		}
+		last_gen = gen;
+
+		// Written before the generation change, so it is visible now
+		if (_quit_flag)
+		{
+			break;
+		}
+
+		_fnc_ptr (_ctx_ptr, part, _nbr_threads);
+
+		if (_nbr_pending.fetch_sub (1, std::memory_order_acq_rel) == 1)
+		{
+			std::lock_guard <std::mutex>	lock (_mutex);
+			_cond_done.notify_one ();
+		}
+	}
+}
+
+
+
+#endif	// FFTRealThreadPool_CODEHEADER_INCLUDED
+
+#undef FFTRealThreadPool_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -53,6 +53,8 @@ public:
 
 	FORCEINLINE void
 						set_step (double angle_rad);
+	FORCEINLINE void
+						set_phase (double angle_rad);
 
 	FORCEINLINE DataType
 						get_cos () const;
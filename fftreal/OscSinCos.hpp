@@ -68,6 +68,17 @@ void	OscSinCos <T>::set_step (double angle_rad)
 
 
 
+template <class T>
+void	OscSinCos <T>::set_phase (double angle_rad)
+{
+	using namespace std;
+
+	_pos_cos = static_cast <DataType> (cos (angle_rad));
+	_pos_sin = static_cast <DataType> (sin (angle_rad));
+}
+
+
+
 template <class T>
 typename OscSinCos <T>::DataType	OscSinCos <T>::get_cos () const
 {
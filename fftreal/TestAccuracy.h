@@ -35,6 +35,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
+#include	<vector>
+
 
 
 template <class FO>
@@ -68,8 +70,16 @@ private:
 	enum {			NBR_ACC_TESTS	= 10 * 1000 * 1000	};
    enum {         MAX_NBR_TESTS  = 10000  };
 
-   static void		compute_tf (DataType s [], const DataType x [], long length);
-	static void		compute_itf (DataType x [], const DataType s [], long length);
+	// Longer transforms are only checked on NBR_CHECKED_PTS evenly spaced
+	// points, the direct transform costing length operations per point.
+	enum {			MAX_FULL_LEN	= 1 << 13	};
+	enum {			NBR_CHECKED_PTS	= 1 << 10	};
+
+	static long		get_check_step (long length);
+	static void		pack_checked (DataType x [], long length, long step);
+	static void		build_trigo_table (std::vector <BigFloat> &cos_arr, std::vector <BigFloat> &sin_arr, long length);
+   static void		compute_tf (DataType s [], const DataType x [], long length, long step);
+	static void		compute_itf (DataType x [], const DataType s [], long length, long step);
 	static int		compare_vect_display (const DataType x_ptr [], const DataType y_ptr [], long len, BigFloat &max_err_rel);
 	static BigFloat
 						compute_power (const DataType x_ptr [], long len);
@@ -106,6 +106,9 @@ int	TestAccuracy <FO>::perform_test_d (FO &fft, const char *class_name_0)
       static_cast <long> (MAX_NBR_TESTS)
    );
 
+	const long		step = get_check_step (len);
+	const long		nbr_checked = (len + step - 1) / step;
+
 	printf ("Testing %s::do_fft () [%ld samples]... ", class_name_0, len);
 	fflush (stdout);
 	TestWhiteNoiseGen <DataType>	noise;
@@ -118,10 +121,12 @@ int	TestAccuracy <FO>::perform_test_d (FO &fft, const char *class_name_0)
 	{
 		noise.generate (&x [0], len);
 		fft.do_fft (&s1 [0], &x [0]);
-		compute_tf (&s2 [0], &x [0], len);
+		compute_tf (&s2 [0], &x [0], len, step);
+		pack_checked (&s1 [0], len, step);
+		pack_checked (&s2 [0], len, step);
 
 		BigFloat			max_err;
-		compare_vect_display (&s1 [0], &s2 [0], len, max_err);
+		ret_val = compare_vect_display (&s1 [0], &s2 [0], nbr_checked, max_err);
 		err_avg += max_err;
 	}
 	err_avg /= NBR_ACC_TESTS;
@@ -154,6 +159,9 @@ int	TestAccuracy <FO>::perform_test_i (FO &fft, const char *class_name_0)
       static_cast <long> (MAX_NBR_TESTS)
    );
 
+	const long		step = get_check_step (len);
+	const long		nbr_checked = (len + step - 1) / step;
+
 	printf ("Testing %s::do_ifft () [%ld samples]... ", class_name_0, len);
 	fflush (stdout);
 	TestWhiteNoiseGen <DataType>	noise;
@@ -166,10 +174,12 @@ int	TestAccuracy <FO>::perform_test_i (FO &fft, const char *class_name_0)
 	{
 		noise.generate (&s [0], len);
 		fft.do_ifft (&s [0], &x1 [0]);
-		compute_itf (&x2 [0], &s [0], len);
+		compute_itf (&x2 [0], &s [0], len, step);
+		pack_checked (&x1 [0], len, step);
+		pack_checked (&x2 [0], len, step);
 
 		BigFloat			max_err;
-		compare_vect_display (&x1 [0], &x2 [0], len, max_err);
+		ret_val = compare_vect_display (&x1 [0], &x2 [0], nbr_checked, max_err);
 		err_avg += max_err;
 	}
 	err_avg /= NBR_ACC_TESTS;
@@ -222,7 +232,7 @@ int	TestAccuracy <FO>::perform_test_di (FO &fft, const char *class_name_0)
 		fft.rescale (&y [0]);
 
 		BigFloat			max_err;
-		compare_vect_display (&x [0], &y [0], len, max_err);
+		ret_val = compare_vect_display (&x [0], &y [0], len, max_err);
 		err_avg += max_err;
 	}
 	err_avg /= NBR_ACC_TESTS;
@@ -247,48 +257,118 @@ int	TestAccuracy <FO>::perform_test_di (FO &fft, const char *class_name_0)
 
 
 
+// 1 for the transforms checked on all their points, otherwise the distance
+// between two checked points
+template <class FO>
+long	TestAccuracy <FO>::get_check_step (long length)
+{
+	assert (length > 0);
+
+	long				step = 1;
+	if (length > MAX_FULL_LEN)
+	{
+		step = length / NBR_CHECKED_PTS;
+	}
+
+	return (step);
+}
+
+
+
+// Moves the points which are multiples of step to the beginning of the array
+template <class FO>
+void	TestAccuracy <FO>::pack_checked (DataType x [], long length, long step)
+{
+	assert (x != 0);
+	assert (length > 0);
+	assert (step > 0);
+
+	for (long pos = 0; pos * step < length; ++pos)
+	{
+		x [pos] = x [pos * step];
+	}
+}
+
+
+
+// cos_arr [k] = cos (2 * PI * k / length), same for sin_arr
+template <class FO>
+void	TestAccuracy <FO>::build_trigo_table (std::vector <BigFloat> &cos_arr, std::vector <BigFloat> &sin_arr, long length)
+{
+	assert (&cos_arr != 0);
+	assert (&sin_arr != 0);
+	assert (length > 0);
+
+	cos_arr.resize (length);
+	sin_arr.resize (length);
+	const BigFloat	m = static_cast <BigFloat> (2 * PI) / length;
+	for (long k = 0; k < length; ++k)
+	{
+		using namespace std;
+
+		const BigFloat	phase = k * m;
+		cos_arr [k] = cos (phase);
+		sin_arr [k] = sin (phase);
+	}
+}
+
+
+
 // Positive transform
+// Odd lengths have no Nyquist bin: the imaginary parts follow the real
+// parts of bins 0 to length/2.
+// Only the points which are multiples of step are computed, step must
+// divide length/2.
 template <class FO>
-void	TestAccuracy <FO>::compute_tf (DataType s [], const DataType x [], long length)
+void	TestAccuracy <FO>::compute_tf (DataType s [], const DataType x [], long length, long step)
 {
 	assert (s != 0);
 	assert (x != 0);
 	assert (length >= 2);
-	assert ((length & 1) == 0);
+	assert (step > 0);
+	assert ((length >> 1) % step == 0);
 
 	const long		nbr_bins = length >> 1;
+	const bool		odd_flag = ((length & 1) != 0);
+	const long		end_bin = (odd_flag) ? nbr_bins + 1 : nbr_bins;
 
 	// DC and Nyquist
 	BigFloat			dc = 0;
 	BigFloat			ny = 0;
-	for (long pos = 0; pos < length; pos += 2)
+	for (long pos = 0; pos < length; ++pos)
 	{
-		const BigFloat	even = x [pos    ];
-		const BigFloat	odd  = x [pos + 1];
-		dc += even + odd;
-		ny += even - odd;
+		const BigFloat	val = x [pos];
+		dc += val;
+		ny += ((pos & 1) == 0) ? val : -val;
 	}
 	s [0       ] = static_cast <DataType> (dc);
-	s [nbr_bins] = static_cast <DataType> (ny);
+	if (! odd_flag)
+	{
+		s [nbr_bins] = static_cast <DataType> (ny);
+	}
 
 	// Regular bins
-	for (long bin = 1; bin < nbr_bins; ++ bin)
+	std::vector <BigFloat>	cos_arr;
+	std::vector <BigFloat>	sin_arr;
+	build_trigo_table (cos_arr, sin_arr, length);
+
+	for (long bin = step; bin < end_bin; bin += step)
 	{
 		BigFloat			sum_r = 0;
 		BigFloat			sum_i = 0;
 
-		const BigFloat	m = bin * static_cast <BigFloat> (2 * PI) / length;
-
+		// Index of the phase bin * pos, modulo length
+		long				index = 0;
 		for (long pos = 0; pos < length; ++pos)
 		{
-			using namespace std;
-
-			const BigFloat	phase = pos * m;
-			const BigFloat	e_r = cos (phase);
-			const BigFloat	e_i = sin (phase);
-
-			sum_r += x [pos] * e_r;
-			sum_i += x [pos] * e_i;
+			sum_r += x [pos] * cos_arr [index];
+			sum_i += x [pos] * sin_arr [index];
+
+			index += bin;
+			if (index >= length)
+			{
+				index -= length;
+			}
 		}
 
 		s [           bin] = static_cast <DataType> (sum_r);
@@ -299,37 +379,45 @@ void	TestAccuracy <FO>::compute_tf (DataType s [], const DataType x [], long len
 
 
 // Negative transform
+// Only the points which are multiples of step are computed.
 template <class FO>
-void	TestAccuracy <FO>::compute_itf (DataType x [], const DataType s [], long length)
+void	TestAccuracy <FO>::compute_itf (DataType x [], const DataType s [], long length, long step)
 {
 	assert (s != 0);
 	assert (x != 0);
 	assert (length >= 2);
-	assert ((length & 1) == 0);
+	assert (step > 0);
 
 	const long		nbr_bins = length >> 1;
+	const bool		odd_flag = ((length & 1) != 0);
+	const long		end_bin = (odd_flag) ? nbr_bins + 1 : nbr_bins;
 
 	// DC and Nyquist
-	BigFloat			dc = s [0       ];
-	BigFloat			ny = s [nbr_bins];
+	BigFloat			dc = s [0];
+	BigFloat			ny = (odd_flag) ? 0 : s [nbr_bins];
+
+	std::vector <BigFloat>	cos_arr;
+	std::vector <BigFloat>	sin_arr;
+	build_trigo_table (cos_arr, sin_arr, length);
 
 	// Regular bins
-	for (long pos = 0; pos < length; ++pos)
+	for (long pos = 0; pos < length; pos += step)
 	{
 		BigFloat				sum = dc + ny * (1 - 2 * (pos & 1));
 
-		const BigFloat		m = pos * static_cast <BigFloat> (-2 * PI) / length;
-
-		for (long bin = 1; bin < nbr_bins; ++ bin)
+		// Index of the phase bin * pos, modulo length. The phase is
+		// negative, so its sine is -sin_arr [index].
+		long					index = 0;
+		for (long bin = 1; bin < end_bin; ++ bin)
 		{
-			using namespace std;
-
-			const BigFloat	phase = bin * m;
-			const BigFloat	e_r = cos (phase);
-			const BigFloat	e_i = sin (phase);
-
-			sum += 2 * (  e_r * s [bin           ]
-			            - e_i * s [bin + nbr_bins]);
+			index += pos;
+			if (index >= length)
+			{
+				index -= length;
+			}
+
+			sum += 2 * (  cos_arr [index] * s [bin           ]
+			            + sin_arr [index] * s [bin + nbr_bins]);
 		}
 
 		x [pos] = static_cast <DataType> (sum);
@@ -372,6 +460,7 @@ int	TestAccuracy <FO>::compare_vect_display (const DataType x_ptr [], const Data
 
 	if (power_err_rel > 0.001)
 	{
+		ret_val = -1;
 		printf ("Power error  : %f (%.6f %%)\n",
 			static_cast <double> (power_err_rel),
 			static_cast <double> (power_err_rel * 100)
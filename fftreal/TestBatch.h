@@ -0,0 +1,103 @@
+/*****************************************************************************
+
+        TestBatch.h
+
+Checks that FFTRealBatch and FFTRealWrapper::calculateFFTBatch () give
+the same results as one FFTReal::do_fft () or FFTRealWrapper::calculateFFT ()
+call per frame, for contiguous and overlapping frames. The frame counts are
+not multiples of FFTRealBatch::NBR_LANES, so the last group is partial.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (TestBatch_HEADER_INCLUDED)
+#define	TestBatch_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"test_settings.h"
+#include	"FFTRealBatch.h"
+
+
+
+class TestBatch
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	FFTRealBatch::DataType	DataType;
+
+	static inline void
+						perform_test (int &ret_val);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	static inline int	perform_test_batch (long len, long nbr_frames, long f_stride, long x_stride);
+#if defined (test_settings_WRAPPER_TEST_ENABLED)
+	static inline int	perform_test_wrapper (int len, int nbr_frames, int in_stride, int out_stride);
+#endif
+	static inline int	check_err (double err_max);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						TestBatch ();
+						~TestBatch ();
+						TestBatch (const TestBatch &other);
+	TestBatch &
+						operator = (const TestBatch &other);
+	bool				operator == (const TestBatch &other);
+	bool				operator != (const TestBatch &other);
+
+};	// class TestBatch
+
+
+
+#include	"TestBatch.hpp"
+
+
+
+#endif	// TestBatch_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
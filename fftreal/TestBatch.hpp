@@ -0,0 +1,237 @@
+/*****************************************************************************
+
+        TestBatch.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (TestBatch_CURRENT_CODEHEADER)
+	#error Recursive inclusion of TestBatch code header.
+#endif
+#define	TestBatch_CURRENT_CODEHEADER
+
+#if ! defined (TestBatch_CODEHEADER_INCLUDED)
+#define	TestBatch_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"FFTReal.h"
+#include	"test_fnc.h"
+#include	"TestWhiteNoiseGen.h"
+#if defined (test_settings_WRAPPER_TEST_ENABLED)
+	#include	"fftreal_wrapper.h"
+#endif
+
+#include	<algorithm>
+#include	<vector>
+
+#include	<cassert>
+#include	<cstdio>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+void	TestBatch::perform_test (int &ret_val)
+{
+	const int		len_arr [] = { 3, 4, 5, 10, 12 };
+	const int		nbr_len = sizeof (len_arr) / sizeof (len_arr [0]);
+	const long		frm_arr [] = { 3, 7 };
+	const int		nbr_frm = sizeof (frm_arr) / sizeof (frm_arr [0]);
+	for (int k = 0; k < nbr_len && ret_val == 0; ++k)
+	{
+		const long		len = 1L << (len_arr [k]);
+		for (int f = 0; f < nbr_frm && ret_val == 0; ++f)
+		{
+			// Contiguous frames, then padded output frames and source frames
+			// overlapping by 3/4
+			ret_val = perform_test_batch (len, frm_arr [f], len, len);
+			if (ret_val == 0)
+			{
+				ret_val = perform_test_batch (len, frm_arr [f], len + 3, len / 4);
+			}
+		}
+	}
+
+#if defined (test_settings_WRAPPER_TEST_ENABLED)
+	// Powers of 2 use FFTRealBatch, 441 = 3^2 * 7^2 falls back to one
+	// transform per frame
+	const int		wlen_arr [] = { 256, 4096, 441 };
+	const int		nbr_wlen = sizeof (wlen_arr) / sizeof (wlen_arr [0]);
+	for (int k = 0; k < nbr_wlen && ret_val == 0; ++k)
+	{
+		const int		len = wlen_arr [k];
+		ret_val = perform_test_wrapper (len, 7, len, len);
+		if (ret_val == 0)
+		{
+			ret_val = perform_test_wrapper (len, 7, len + 3, len / 4);
+		}
+	}
+#endif
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+int	TestBatch::perform_test_batch (long len, long nbr_frames, long f_stride, long x_stride)
+{
+	assert (len > 0);
+	assert (nbr_frames > 0);
+	assert (f_stride >= len);
+	assert (x_stride > 0);
+
+	printf (
+		"Testing FFTRealBatch::do_fft () [%ld samples, %ld frames, strides %ld / %ld]... ",
+		len,
+		nbr_frames,
+		f_stride,
+		x_stride
+	);
+	fflush (stdout);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	x ((nbr_frames - 1) * x_stride + len);
+	std::vector <DataType>	f ((nbr_frames - 1) * f_stride + len);
+	std::vector <DataType>	f_ref (len);
+	noise.generate (&x [0], long (x.size ()));
+
+	FFTRealBatch	batch (len);
+	if (f_stride == len && x_stride == len)
+	{
+		batch.do_fft (&f [0], &x [0], nbr_frames);
+	}
+	else
+	{
+		batch.do_fft (&f [0], f_stride, &x [0], x_stride, nbr_frames);
+	}
+
+	FFTReal <DataType>	fft (len);
+	double			err_max = 0;
+	for (long frame = 0; frame < nbr_frames; ++frame)
+	{
+		fft.do_fft (&f_ref [0], &x [frame * x_stride]);
+		const double	err =
+			compute_rel_err (&f [frame * f_stride], &f_ref [0], len);
+		err_max = std::max (err_max, err);
+	}
+
+	return (check_err (err_max));
+}
+
+
+
+#if defined (test_settings_WRAPPER_TEST_ENABLED)
+
+int	TestBatch::perform_test_wrapper (int len, int nbr_frames, int in_stride, int out_stride)
+{
+	assert (len > 0);
+	assert (nbr_frames > 0);
+	assert (in_stride >= len);
+	assert (out_stride > 0);
+
+	printf (
+		"Testing FFTRealWrapper::calculateFFTBatch () [%d samples, %d frames, strides %d / %d]... ",
+		len,
+		nbr_frames,
+		in_stride,
+		out_stride
+	);
+	fflush (stdout);
+
+	FFTRealWrapper *	wrapper_ptr = FFTRealWrapper::create (len);
+	if (wrapper_ptr == 0)
+	{
+		printf ("\n*** Length not supported.\n");
+		return (-1);
+	}
+
+	// The wrapper writes to in [] and reads from out [].
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	out ((nbr_frames - 1) * out_stride + len);
+	std::vector <DataType>	in ((nbr_frames - 1) * in_stride + len);
+	std::vector <DataType>	in_ref (len);
+	noise.generate (&out [0], long (out.size ()));
+
+	if (in_stride == len && out_stride == len)
+	{
+		wrapper_ptr->calculateFFTBatch (&in [0], &out [0], nbr_frames);
+	}
+	else
+	{
+		wrapper_ptr->calculateFFTBatch (
+			&in [0], in_stride, &out [0], out_stride, nbr_frames
+		);
+	}
+
+	double			err_max = 0;
+	for (int frame = 0; frame < nbr_frames; ++frame)
+	{
+		wrapper_ptr->calculateFFT (&in_ref [0], &out [frame * out_stride]);
+		const double	err =
+			compute_rel_err (&in [frame * in_stride], &in_ref [0], len);
+		err_max = std::max (err_max, err);
+	}
+
+	delete wrapper_ptr;
+
+	return (check_err (err_max));
+}
+
+#endif	// test_settings_WRAPPER_TEST_ENABLED
+
+
+
+// err_max: maximum RMS error of a frame, relative to the reference
+int	TestBatch::check_err (double err_max)
+{
+	int				ret_val = 0;
+	const double	max_rel_err = 1e-5;
+
+	printf ("done.\n");
+	printf ("Maximum relative error: %g\n\n", err_max);
+	if (err_max > max_rel_err)
+	{
+		printf ("*** Results differ from the ones of a single frame.\n");
+		ret_val = -1;
+	}
+
+	return (ret_val);
+}
+
+
+
+#endif	// TestBatch_CODEHEADER_INCLUDED
+
+#undef TestBatch_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
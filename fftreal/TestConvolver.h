@@ -0,0 +1,104 @@
+/*****************************************************************************
+
+        TestConvolver.h
+
+Checks that FFTRealConvolver and the wrapper give the direct convolution
+of a stream, for filters shorter and longer than a block.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (TestConvolver_HEADER_INCLUDED)
+#define	TestConvolver_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"test_settings.h"
+#include	"FFTRealConvolver.h"
+
+
+
+class TestConvolver
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	FFTRealFixLenParam::DataType	DataType;
+
+	static inline void
+						perform_test (int &ret_val);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	template <int LL2>
+	static inline int	perform_test_block (long filter_len);
+#if defined (test_settings_WRAPPER_TEST_ENABLED)
+	static inline int	perform_test_wrapper (int block_len, int filter_len);
+#endif
+	static inline void
+						compute_conv_ref (DataType dst [], const DataType x [], long len, const DataType h [], long filter_len);
+	static inline int	check_err (double err);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						TestConvolver ();
+						~TestConvolver ();
+						TestConvolver (const TestConvolver &other);
+	TestConvolver &
+						operator = (const TestConvolver &other);
+	bool				operator == (const TestConvolver &other);
+	bool				operator != (const TestConvolver &other);
+
+};	// class TestConvolver
+
+
+
+#include	"TestConvolver.hpp"
+
+
+
+#endif	// TestConvolver_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
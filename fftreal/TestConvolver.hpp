@@ -0,0 +1,251 @@
+/*****************************************************************************
+
+        TestConvolver.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (TestConvolver_CURRENT_CODEHEADER)
+	#error Recursive inclusion of TestConvolver code header.
+#endif
+#define	TestConvolver_CURRENT_CODEHEADER
+
+#if ! defined (TestConvolver_CODEHEADER_INCLUDED)
+#define	TestConvolver_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"test_fnc.h"
+#include	"TestWhiteNoiseGen.h"
+#if defined (test_settings_WRAPPER_TEST_ENABLED)
+	#include	"fftreal_wrapper.h"
+#endif
+
+#include	<algorithm>
+#include	<vector>
+
+#include	<cassert>
+#include	<cstdio>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// Filters of 3.5 blocks span 4 partitions, the last one partial. The others
+// fit in a single partition.
+void	TestConvolver::perform_test (int &ret_val)
+{
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_block <2> (3);
+	}
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_block <2> (14);
+	}
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_block <4> (56);
+	}
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_block <6> (64);
+	}
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_block <6> (224);
+	}
+
+#if defined (test_settings_WRAPPER_TEST_ENABLED)
+	const int		wblock_arr [] = { 128, 1024 };
+	const int		wfilter_arr [] = { 1000, 3000 };
+	const int		nbr_wblock = sizeof (wblock_arr) / sizeof (wblock_arr [0]);
+	for (int k = 0; k < nbr_wblock && ret_val == 0; ++k)
+	{
+		ret_val = perform_test_wrapper (wblock_arr [k], wfilter_arr [k]);
+	}
+#endif
+
+	if (ret_val == 0)
+	{
+		printf ("\n");
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// The stream is filtered twice, the second time in place after clear (). It
+// lasts a few blocks more than the filter, so the output goes through the
+// whole delay line. The latency is the block buffering only: output sample n
+// is aligned with input sample n.
+template <int LL2>
+int	TestConvolver::perform_test_block (long filter_len)
+{
+	assert (filter_len > 0);
+
+	typedef	FFTRealConvolver <LL2>	ConvType;
+	const long		block_len = ConvType::BLOCK_LEN;
+
+	printf (
+		"Testing FFTRealConvolver <%d>::process_block () [%ld taps]... ",
+		LL2,
+		filter_len
+	);
+	fflush (stdout);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	h (filter_len);
+	noise.generate (&h [0], filter_len);
+
+	ConvType			conv (&h [0], filter_len);
+	const long		nbr_blocks = conv.get_nbr_parts () + 3;
+	const long		len = nbr_blocks * block_len;
+	std::vector <DataType>	x (len);
+	std::vector <DataType>	y (len);
+	std::vector <DataType>	y_ref (len);
+	noise.generate (&x [0], len);
+	compute_conv_ref (&y_ref [0], &x [0], len, &h [0], filter_len);
+
+	for (long pos = 0; pos < len; pos += block_len)
+	{
+		conv.process_block (&y [pos], &x [pos]);
+	}
+	double			err = compute_rel_err (&y [0], &y_ref [0], len);
+
+	conv.clear ();
+	y = x;
+	for (long pos = 0; pos < len; pos += block_len)
+	{
+		conv.process_block (&y [pos], &y [pos]);
+	}
+	err = std::max (err, compute_rel_err (&y [0], &y_ref [0], len));
+
+	return (check_err (err));
+}
+
+
+
+#if defined (test_settings_WRAPPER_TEST_ENABLED)
+
+int	TestConvolver::perform_test_wrapper (int block_len, int filter_len)
+{
+	assert (block_len > 0);
+	assert (filter_len > 0);
+
+	printf (
+		"Testing FFTRealConvolverWrapper::process () [%d samples, %d taps]... ",
+		block_len,
+		filter_len
+	);
+	fflush (stdout);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	h (filter_len);
+	noise.generate (&h [0], filter_len);
+
+	FFTRealConvolverWrapper *	conv_ptr =
+		FFTRealConvolverWrapper::create (block_len, &h [0], filter_len);
+	if (conv_ptr == 0)
+	{
+		printf ("\n*** Block length not supported.\n");
+		return (-1);
+	}
+
+	const int		nbr_blocks = (filter_len + block_len - 1) / block_len + 3;
+	const int		len = nbr_blocks * block_len;
+	std::vector <DataType>	x (len);
+	std::vector <DataType>	y (len);
+	std::vector <DataType>	y_ref (len);
+	noise.generate (&x [0], len);
+	compute_conv_ref (&y_ref [0], &x [0], len, &h [0], filter_len);
+
+	for (int pos = 0; pos < len; pos += block_len)
+	{
+		conv_ptr->process (&y [pos], &x [pos]);
+	}
+
+	delete conv_ptr;
+
+	return (check_err (compute_rel_err (&y [0], &y_ref [0], len)));
+}
+
+#endif	// test_settings_WRAPPER_TEST_ENABLED
+
+
+
+// dst [n] = sum (h [k] * x [n - k]), the stream being preceded by silence
+void	TestConvolver::compute_conv_ref (DataType dst [], const DataType x [], long len, const DataType h [], long filter_len)
+{
+	assert (dst != 0);
+	assert (x != 0);
+	assert (len > 0);
+	assert (h != 0);
+	assert (filter_len > 0);
+
+	for (long n = 0; n < len; ++n)
+	{
+		const long		k_end = std::min (filter_len, n + 1);
+		long double		sum = 0;
+		for (long k = 0; k < k_end; ++k)
+		{
+			sum += (long double) (h [k]) * (long double) (x [n - k]);
+		}
+		dst [n] = DataType (sum);
+	}
+}
+
+
+
+int	TestConvolver::check_err (double err)
+{
+	printf ("done.\n");
+	printf ("Relative error: %g\n", err);
+
+	int				ret_val = 0;
+	if (err > 1e-5)
+	{
+		printf ("*** Results differ from the direct convolution.\n");
+		ret_val = -1;
+	}
+
+	return (ret_val);
+}
+
+
+
+#endif	// TestConvolver_CODEHEADER_INCLUDED
+
+#undef TestConvolver_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,104 @@
+/*****************************************************************************
+
+        TestCorrelation.h
+
+Checks the correlations computed with FFTRealCorrelation and with the
+wrapper against their direct sums, including the position of the negative
+lags.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (TestCorrelation_HEADER_INCLUDED)
+#define	TestCorrelation_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"test_settings.h"
+#include	"FFTRealCorrelation.h"
+
+
+
+class TestCorrelation
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	static inline void
+						perform_test (int &ret_val);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	template <class DT>
+	static inline int	perform_test_fnc (long count, long len);
+#if defined (test_settings_WRAPPER_TEST_ENABLED)
+	static inline int	perform_test_wrapper (int count, int len);
+#endif
+	template <class DT>
+	static inline void
+						compute_corr_ref (DT dst [], const DT x [], const DT y [], long count);
+	static inline int	check_err (double err);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						TestCorrelation ();
+						~TestCorrelation ();
+						TestCorrelation (const TestCorrelation &other);
+	TestCorrelation &
+						operator = (const TestCorrelation &other);
+	bool				operator == (const TestCorrelation &other);
+	bool				operator != (const TestCorrelation &other);
+
+};	// class TestCorrelation
+
+
+
+#include	"TestCorrelation.hpp"
+
+
+
+#endif	// TestCorrelation_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
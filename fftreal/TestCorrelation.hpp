@@ -0,0 +1,265 @@
+/*****************************************************************************
+
+        TestCorrelation.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (TestCorrelation_CURRENT_CODEHEADER)
+	#error Recursive inclusion of TestCorrelation code header.
+#endif
+#define	TestCorrelation_CURRENT_CODEHEADER
+
+#if ! defined (TestCorrelation_CODEHEADER_INCLUDED)
+#define	TestCorrelation_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"FFTReal.h"
+#include	"test_fnc.h"
+#include	"TestWhiteNoiseGen.h"
+#if defined (test_settings_WRAPPER_TEST_ENABLED)
+	#include	"fftreal_wrapper.h"
+#endif
+
+#include	<algorithm>
+#include	<vector>
+
+#include	<cassert>
+#include	<cstdio>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// The FFT lengths are at least 2 * count - 1, so the circular correlation
+// holds the linear one. The wrapper uses FFTRealMixed for 441 = 3^2 * 7^2,
+// which checks the products for an odd length.
+void	TestCorrelation::perform_test (int &ret_val)
+{
+	const long		count_arr [] = { 8, 50, 100, 1000 };
+	const long		len_arr [] = { 16, 128, 256, 2048 };
+	const int		nbr_len = sizeof (len_arr) / sizeof (len_arr [0]);
+	for (int k = 0; k < nbr_len && ret_val == 0; ++k)
+	{
+		ret_val = perform_test_fnc <float> (count_arr [k], len_arr [k]);
+		if (ret_val == 0)
+		{
+			ret_val = perform_test_fnc <double> (count_arr [k], len_arr [k]);
+		}
+	}
+
+#if defined (test_settings_WRAPPER_TEST_ENABLED)
+	const int		wcount_arr [] = { 10, 128, 1000, 200 };
+	const int		wlen_arr [] = { 256, 256, 4096, 441 };
+	const int		nbr_wlen = sizeof (wlen_arr) / sizeof (wlen_arr [0]);
+	for (int k = 0; k < nbr_wlen && ret_val == 0; ++k)
+	{
+		ret_val = perform_test_wrapper (wcount_arr [k], wlen_arr [k]);
+	}
+#endif
+
+	if (ret_val == 0)
+	{
+		printf ("\n");
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// Cross-correlation is checked for all the lags, the negative ones being
+// at the end of the circular result.
+template <class DT>
+int	TestCorrelation::perform_test_fnc (long count, long len)
+{
+	assert (count > 0);
+	assert (len >= 2 * count - 1);
+
+	printf (
+		"Testing FFTRealCorrelation::mul_power () and mul_conj () [%ld samples, %ld points, %d bits]... ",
+		count,
+		len,
+		int (sizeof (DT) * 8)
+	);
+	fflush (stdout);
+
+	TestWhiteNoiseGen <DT>	noise;
+	std::vector <DT>	x (len, 0);
+	std::vector <DT>	y (len, 0);
+	noise.generate (&x [0], count);
+	noise.generate (&y [0], count);
+
+	std::vector <DT>	ref (2 * count - 1);
+	std::vector <DT>	res (2 * count - 1);
+
+	FFTReal <DT>		fft (len);
+	std::vector <DT>	f (len);
+	std::vector <DT>	g (len);
+	std::vector <DT>	c (len);
+
+	// Autocorrelation, positive lags
+	fft.do_fft (&f [0], &x [0]);
+	FFTRealCorrelation::mul_power (len, &g [0], &f [0]);
+	fft.do_ifft (&g [0], &c [0]);
+	compute_corr_ref (&ref [0], &x [0], &x [0], count);
+	double			err = compute_rel_err (&c [0], &ref [count - 1], count);
+
+	// Cross-correlation
+	if (err <= 1e-5)
+	{
+		fft.do_fft (&g [0], &y [0]);
+		FFTRealCorrelation::mul_conj (len, &f [0], &f [0], &g [0]);
+		fft.do_ifft (&f [0], &c [0]);
+		std::copy (c.end () - (count - 1), c.end (), res.begin ());
+		std::copy (c.begin (), c.begin () + count, res.begin () + count - 1);
+		compute_corr_ref (&ref [0], &x [0], &y [0], count);
+		err = compute_rel_err (&res [0], &ref [0], 2 * count - 1);
+	}
+
+	return (check_err (err));
+}
+
+
+
+#if defined (test_settings_WRAPPER_TEST_ENABLED)
+
+// b is a copy of a delayed by a few samples: crossCorrelate () of b with a
+// must peak at this positive lag.
+int	TestCorrelation::perform_test_wrapper (int count, int len)
+{
+	assert (count > 1);
+	assert (count <= len / 2);
+
+	printf (
+		"Testing FFTRealWrapper::autocorrelate () and crossCorrelate () [%d samples, %d points]... ",
+		count,
+		len
+	);
+	fflush (stdout);
+
+	FFTRealWrapper *	wrapper_ptr = FFTRealWrapper::create (len);
+	if (wrapper_ptr == 0)
+	{
+		printf ("\n*** Length not supported.\n");
+		return (-1);
+	}
+
+	typedef	FFTRealWrapper::DataType	DataType;
+
+	const int		delay = std::min (count / 4 + 1, 5);
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	a (count);
+	std::vector <DataType>	b (count, 0);
+	noise.generate (&a [0], count);
+	std::copy (a.begin (), a.end () - delay, b.begin () + delay);
+
+	std::vector <DataType>	ref (2 * count - 1);
+	std::vector <DataType>	res (2 * count - 1);
+
+	wrapper_ptr->autocorrelate (&res [0], &a [0], count);
+	compute_corr_ref (&ref [0], &a [0], &a [0], long (count));
+	double			err = compute_rel_err (&res [0], &ref [count - 1], count);
+
+	int				peak = 0;
+	if (err <= 1e-5)
+	{
+		wrapper_ptr->crossCorrelate (&res [0], &b [0], &a [0], count);
+		compute_corr_ref (&ref [0], &b [0], &a [0], long (count));
+		err = compute_rel_err (&res [0], &ref [0], 2 * count - 1);
+		peak = int (std::max_element (res.begin (), res.end ()) - res.begin ())
+		     - (count - 1);
+	}
+
+	delete wrapper_ptr;
+
+	int				ret_val = check_err (err);
+	if (ret_val == 0 && peak != delay)
+	{
+		printf ("*** Peak at lag %d instead of %d.\n", peak, delay);
+		ret_val = -1;
+	}
+
+	return (ret_val);
+}
+
+#endif	// test_settings_WRAPPER_TEST_ENABLED
+
+
+
+// dst [count - 1 + k] = sum (x [n + k] * y [n]), -count < k < count
+template <class DT>
+void	TestCorrelation::compute_corr_ref (DT dst [], const DT x [], const DT y [], long count)
+{
+	assert (dst != 0);
+	assert (x != 0);
+	assert (y != 0);
+	assert (count > 0);
+
+	for (long lag = 1 - count; lag < count; ++lag)
+	{
+		const long		beg = std::max (0L, -lag);
+		const long		end = std::min (count, count - lag);
+		long double		sum = 0;
+		for (long n = beg; n < end; ++n)
+		{
+			sum += (long double) (x [n + lag]) * (long double) (y [n]);
+		}
+		dst [count - 1 + lag] = DT (sum);
+	}
+}
+
+
+
+int	TestCorrelation::check_err (double err)
+{
+	printf ("done.\n");
+	printf ("Relative error: %g\n", err);
+
+	int				ret_val = 0;
+	if (err > 1e-5)
+	{
+		printf ("*** Results differ from the direct sums.\n");
+		ret_val = -1;
+	}
+
+	return (ret_val);
+}
+
+
+
+#endif	// TestCorrelation_CODEHEADER_INCLUDED
+
+#undef TestCorrelation_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
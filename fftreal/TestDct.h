@@ -0,0 +1,107 @@
+/*****************************************************************************
+
+        TestDct.h
+
+Checks the DCT-II, DCT-IV, MDCT and inverse MDCT of FFTRealDct and
+FFTRealDctFixLen against the direct formulas of FFTRealDctCore, and the
+reconstruction of a signal by overlap-adding windowed inverse MDCTs (time-
+domain aliasing cancellation).
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (TestDct_HEADER_INCLUDED)
+#define	TestDct_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+
+
+template <class FO>
+class TestDct
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	typename FO::DataType	DataType;
+	typedef	long double	BigFloat;
+
+   static int		perform_test_single_object (FO &dct);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	enum {			NBR_FRAMES	= 8	};
+
+	static int		perform_test_dct2 (FO &dct);
+	static int		perform_test_dct4 (FO &dct);
+	static int		perform_test_mdct (FO &dct);
+	static int		perform_test_imdct (FO &dct);
+	static int		perform_test_tdac (FO &dct);
+	static void		compute_cos_sum (DataType f [], long nbr_f, const DataType x [], long nbr_x, long len, BigFloat n_ofs, BigFloat k_ofs, bool transp_flag);
+	static int		check_err (double err);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						TestDct ();
+						~TestDct ();
+						TestDct (const TestDct &other);
+	TestDct &
+						operator = (const TestDct &other);
+	bool				operator == (const TestDct &other);
+	bool				operator != (const TestDct &other);
+
+};	// class TestDct
+
+
+
+#include	"TestDct.hpp"
+
+
+
+#endif	// TestDct_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
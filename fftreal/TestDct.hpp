@@ -0,0 +1,302 @@
+/*****************************************************************************
+
+        TestDct.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (TestDct_CURRENT_CODEHEADER)
+	#error Recursive inclusion of TestDct code header.
+#endif
+#define	TestDct_CURRENT_CODEHEADER
+
+#if ! defined (TestDct_CODEHEADER_INCLUDED)
+#define	TestDct_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"test_fnc.h"
+#include	"TestWhiteNoiseGen.h"
+
+#include	<typeinfo>
+#include	<vector>
+
+#include	<cassert>
+#include	<cmath>
+#include	<cstdio>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class FO>
+int	TestDct <FO>::perform_test_single_object (FO &dct)
+{
+	int				ret_val = 0;
+
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_dct2 (dct);
+	}
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_dct4 (dct);
+	}
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_mdct (dct);
+	}
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_imdct (dct);
+	}
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_tdac (dct);
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class FO>
+int	TestDct <FO>::perform_test_dct2 (FO &dct)
+{
+	const long		len = dct.get_length ();
+	printf ("Testing %s::do_dct2 () [%ld samples]... ", typeid (dct).name (), len);
+	fflush (stdout);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	x (len);
+	std::vector <DataType>	f (len);
+	std::vector <DataType>	f_ref (len);
+	noise.generate (&x [0], len);
+
+	dct.do_dct2 (&f [0], &x [0]);
+	compute_cos_sum (&f_ref [0], len, &x [0], len, len, 0.5, 0, false);
+
+	return (check_err (compute_rel_err (&f [0], &f_ref [0], len)));
+}
+
+
+
+template <class FO>
+int	TestDct <FO>::perform_test_dct4 (FO &dct)
+{
+	const long		len = dct.get_length ();
+	printf ("Testing %s::do_dct4 () [%ld samples]... ", typeid (dct).name (), len);
+	fflush (stdout);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	x (len);
+	std::vector <DataType>	f (len);
+	std::vector <DataType>	f_ref (len);
+	noise.generate (&x [0], len);
+
+	dct.do_dct4 (&f [0], &x [0]);
+	compute_cos_sum (&f_ref [0], len, &x [0], len, len, 0.5, 0.5, false);
+
+	return (check_err (compute_rel_err (&f [0], &f_ref [0], len)));
+}
+
+
+
+template <class FO>
+int	TestDct <FO>::perform_test_mdct (FO &dct)
+{
+	const long		len = dct.get_length ();
+	printf ("Testing %s::do_mdct () [%ld samples]... ", typeid (dct).name (), len * 2);
+	fflush (stdout);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	x (len * 2);
+	std::vector <DataType>	f (len);
+	std::vector <DataType>	f_ref (len);
+	noise.generate (&x [0], len * 2);
+
+	dct.do_mdct (&f [0], &x [0]);
+	compute_cos_sum (
+		&f_ref [0], len, &x [0], len * 2, len, 0.5 + len / 2, 0.5, false
+	);
+
+	return (check_err (compute_rel_err (&f [0], &f_ref [0], len)));
+}
+
+
+
+template <class FO>
+int	TestDct <FO>::perform_test_imdct (FO &dct)
+{
+	const long		len = dct.get_length ();
+	printf ("Testing %s::do_imdct () [%ld samples]... ", typeid (dct).name (), len * 2);
+	fflush (stdout);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	f (len);
+	std::vector <DataType>	x (len * 2);
+	std::vector <DataType>	x_ref (len * 2);
+	noise.generate (&f [0], len);
+
+	dct.do_imdct (&x [0], &f [0]);
+	compute_cos_sum (
+		&x_ref [0], len * 2, &f [0], len, len, 0.5 + len / 2, 0.5, true
+	);
+
+	return (check_err (compute_rel_err (&x [0], &x_ref [0], len * 2)));
+}
+
+
+
+// Frames of 2N samples with a hop of N, windowed before the MDCT and after
+// the inverse MDCT by the sine window, which satisfies the Princen-Bradley
+// condition w [n]^2 + w [n + N]^2 = 1. Overlap-adding the frames rebuilds
+// the signal multiplied by N/2, except the first and last N samples which
+// are only covered by one frame.
+template <class FO>
+int	TestDct <FO>::perform_test_tdac (FO &dct)
+{
+	using namespace std;
+
+	const long		len = dct.get_length ();
+	const long		sig_len = (NBR_FRAMES + 1) * len;
+	printf (
+		"Testing %s::do_mdct () / do_imdct () overlap-add [%ld samples]... ",
+		typeid (dct).name (),
+		sig_len
+	);
+	fflush (stdout);
+
+	std::vector <DataType>	win (len * 2);
+	for (long pos = 0; pos < len * 2; ++pos)
+	{
+		win [pos] = DataType (sin (PI / (len * 2) * (pos + 0.5)));
+	}
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	sig (sig_len);
+	std::vector <DataType>	rec (sig_len, 0);
+	std::vector <DataType>	frame (len * 2);
+	std::vector <DataType>	f (len);
+	noise.generate (&sig [0], sig_len);
+
+	for (long frame_idx = 0; frame_idx < NBR_FRAMES; ++frame_idx)
+	{
+		const long		ofs = frame_idx * len;
+		for (long pos = 0; pos < len * 2; ++pos)
+		{
+			frame [pos] = sig [ofs + pos] * win [pos];
+		}
+		dct.do_mdct (&f [0], &frame [0]);
+		dct.do_imdct (&frame [0], &f [0]);
+		for (long pos = 0; pos < len * 2; ++pos)
+		{
+			rec [ofs + pos] += frame [pos] * win [pos];
+		}
+	}
+
+	const DataType	scale = DataType (2.0 / len);
+	for (long pos = 0; pos < sig_len; ++pos)
+	{
+		rec [pos] *= scale;
+	}
+
+	const long		cmp_len = sig_len - len * 2;
+
+	return (check_err (compute_rel_err (&rec [len], &sig [len], cmp_len)));
+}
+
+
+
+// f [k] = sum (x [n] * cos (PI / len * (n + n_ofs) * (k + k_ofs))), with
+// the roles of n and k swapped when transp_flag is set, for the inverse MDCT.
+template <class FO>
+void	TestDct <FO>::compute_cos_sum (DataType f [], long nbr_f, const DataType x [], long nbr_x, long len, BigFloat n_ofs, BigFloat k_ofs, bool transp_flag)
+{
+	assert (f != 0);
+	assert (nbr_f > 0);
+	assert (x != 0);
+	assert (nbr_x > 0);
+	assert (len > 0);
+
+	using namespace std;
+
+	const BigFloat	m = static_cast <BigFloat> (PI) / len;
+	for (long k = 0; k < nbr_f; ++k)
+	{
+		BigFloat			sum = 0;
+		for (long n = 0; n < nbr_x; ++n)
+		{
+			const BigFloat	phase = (transp_flag)
+				? m * (k + n_ofs) * (n + k_ofs)
+				: m * (n + n_ofs) * (k + k_ofs);
+			sum += x [n] * cos (phase);
+		}
+		f [k] = static_cast <DataType> (sum);
+	}
+}
+
+
+
+// err: RMS error, relative to the reference
+template <class FO>
+int	TestDct <FO>::check_err (double err)
+{
+	int				ret_val = 0;
+	const double	max_rel_err = 1e-5;
+
+	printf ("done.\n");
+	printf ("Relative error: %g\n", err);
+	if (err > max_rel_err)
+	{
+		printf ("*** Results differ from the reference.\n");
+		ret_val = -1;
+	}
+
+	return (ret_val);
+}
+
+
+
+#endif	// TestDct_CODEHEADER_INCLUDED
+
+#undef TestDct_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
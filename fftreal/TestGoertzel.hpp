@@ -0,0 +1,155 @@
+/*****************************************************************************
+
+        TestGoertzel.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (TestGoertzel_CURRENT_CODEHEADER)
+	#error Recursive inclusion of TestGoertzel code header.
+#endif
+#define	TestGoertzel_CURRENT_CODEHEADER
+
+#if ! defined (TestGoertzel_CODEHEADER_INCLUDED)
+#define	TestGoertzel_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"FFTReal.h"
+#include	"test_fnc.h"
+#include	"TestWhiteNoiseGen.h"
+
+#include	<vector>
+
+#include	<cassert>
+#include	<cstdio>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+void	TestGoertzel::perform_test (int &ret_val)
+{
+	const int		len_arr [] = { 6, 10, 12 };
+	const int		nbr_len = sizeof (len_arr) / sizeof (len_arr [0]);
+	for (int k = 0; k < nbr_len && ret_val == 0; ++k)
+	{
+		const long		len = 1L << (len_arr [k]);
+		ret_val = perform_test_len (len);
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("\n");
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// 11 filters, so the last vector is not full, on bins spread from DC to
+// Nyquist
+int	TestGoertzel::perform_test_len (long len)
+{
+	assert (len >= 16);
+
+	int				ret_val = 0;
+
+	const long		nbr_filters = 11;
+	std::vector <long>	bin_arr (nbr_filters);
+	std::vector <double>	freq_arr (nbr_filters);
+	for (long index = 0; index < nbr_filters; ++index)
+	{
+		bin_arr [index] = index * (len / 2) / (nbr_filters - 1);
+		if (index > 0 && index < nbr_filters - 1)
+		{
+			bin_arr [index] += index % 3;
+		}
+		freq_arr [index] = double (bin_arr [index]) / double (len);
+	}
+
+	printf (
+		"Testing FFTRealGoertzel::get_power () [%ld samples, %ld filters]... ",
+		len,
+		nbr_filters
+	);
+	fflush (stdout);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	x (len);
+	noise.generate (&x [0], len);
+
+	// The block is split over two calls
+	FFTRealGoertzel	goertzel (&freq_arr [0], nbr_filters);
+	std::vector <DataType>	p (nbr_filters);
+	goertzel.clear ();
+	goertzel.process_block (&x [0], len / 3);
+	goertzel.process_block (&x [len / 3], len - len / 3);
+	goertzel.get_power (&p [0]);
+
+	// FFTReal has no imaginary part for DC and Nyquist
+	FFTReal <DataType>	fft (len);
+	std::vector <DataType>	f (len);
+	fft.do_fft (&f [0], &x [0]);
+	std::vector <DataType>	p_ref (nbr_filters);
+	for (long index = 0; index < nbr_filters; ++index)
+	{
+		const long		bin = bin_arr [index];
+		const double	re = f [bin];
+		const double	im = (bin == 0 || bin == len / 2) ? 0 : f [len / 2 + bin];
+		p_ref [index] = DataType (re * re + im * im);
+	}
+
+	// The recursion runs in DataType: its rounding errors grow with the
+	// number of samples, and are the largest at DC and Nyquist.
+	const double	err = compute_rel_err (&p [0], &p_ref [0], nbr_filters);
+	const double	max_rel_err = 1e-6 * len;
+
+	printf ("done.\n");
+	printf ("Relative error: %g\n", err);
+	if (err > max_rel_err)
+	{
+		printf ("*** Results differ from the power spectrum.\n");
+		ret_val = -1;
+	}
+
+	return (ret_val);
+}
+
+
+
+#endif	// TestGoertzel_CODEHEADER_INCLUDED
+
+#undef TestGoertzel_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
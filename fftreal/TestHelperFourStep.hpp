@@ -0,0 +1,82 @@
+/*****************************************************************************
+
+        TestHelperFourStep.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (TestHelperFourStep_CURRENT_CODEHEADER)
+	#error Recursive inclusion of TestHelperFourStep code header.
+#endif
+#define	TestHelperFourStep_CURRENT_CODEHEADER
+
+#if ! defined (TestHelperFourStep_CODEHEADER_INCLUDED)
+#define	TestHelperFourStep_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"TestAccuracy.h"
+
+#include	<cstdio>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+void	TestHelperFourStep <DT>::perform_test_accuracy (int &ret_val)
+{
+	const int		len_arr [] = { 17, 18 };
+	const int		nbr_len = sizeof (len_arr) / sizeof (len_arr [0]);
+	const int		nbr_thr_arr [] = { 1, 4 };
+	const int		nbr_thr = sizeof (nbr_thr_arr) / sizeof (nbr_thr_arr [0]);
+	for (int k = 0; k < nbr_len && ret_val == 0; ++k)
+	{
+		for (int t = 0; t < nbr_thr && ret_val == 0; ++t)
+		{
+			const long		len = 1L << (len_arr [k]);
+			FftType			fft (len, nbr_thr_arr [t]);
+			printf ("%d thread(s)\n", fft.get_nbr_threads ());
+			ret_val = TestAccuracy <FftType>::perform_test_single_object (fft);
+		}
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+#endif	// TestHelperFourStep_CODEHEADER_INCLUDED
+
+#undef TestHelperFourStep_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
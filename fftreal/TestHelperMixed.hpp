@@ -0,0 +1,85 @@
+/*****************************************************************************
+
+        TestHelperMixed.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (TestHelperMixed_CURRENT_CODEHEADER)
+	#error Recursive inclusion of TestHelperMixed code header.
+#endif
+#define	TestHelperMixed_CURRENT_CODEHEADER
+
+#if ! defined (TestHelperMixed_CODEHEADER_INCLUDED)
+#define	TestHelperMixed_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"TestAccuracy.h"
+
+#include	<cassert>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// 3 * 2^k, 5 * 2^k, 7 * 2^k, odd lengths and lengths mixing all the radices
+template <class DT>
+void	TestHelperMixed <DT>::perform_test_accuracy (int &ret_val)
+{
+	const long		len_arr [] =
+	{
+		3, 5, 6, 7, 9, 15, 105,
+		3 * 16, 3 * 256,
+		5 * 8, 5 * 64,
+		7 * 4, 7 * 256,
+		2 * 3 * 5 * 7, 2 * 3 * 5 * 7 * 4
+	};
+	const int		nbr_len = sizeof (len_arr) / sizeof (len_arr [0]);
+	for (int k = 0; k < nbr_len && ret_val == 0; ++k)
+	{
+		const long		len = len_arr [k];
+		assert (FftType::is_supported_length (len));
+		FftType			fft (len);
+		ret_val = TestAccuracy <FftType>::perform_test_single_object (fft);
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+#endif	// TestHelperMixed_CODEHEADER_INCLUDED
+
+#undef TestHelperMixed_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
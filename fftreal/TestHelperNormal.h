@@ -52,6 +52,7 @@ public:
 
    static void    perform_test_accuracy (int &ret_val);
    static void    perform_test_speed (int &ret_val);
+   static void    perform_test_thread_pool (int &ret_val);
 
 
 
@@ -65,6 +66,8 @@ protected:
 
 private:
 
+	static int		compare_with_single_thread (FftType &fft);
+
 
 
 /*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -41,6 +41,12 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #if defined (test_settings_SPEED_TEST_ENABLED)
 	#include	"TestSpeed.h"
 #endif
+#include	"TestWhiteNoiseGen.h"
+
+#include	<vector>
+
+#include	<cmath>
+#include	<cstdio>
 
 
 
@@ -51,7 +57,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 template <class DT>
 void	TestHelperNormal <DT>::perform_test_accuracy (int &ret_val)
 {
-	const int		len_arr [] = { 1, 2, 3, 4, 7, 8, 10, 12 };
+	const int		len_arr [] = { 1, 2, 3, 4, 5, 6, 7, 8, 10, 12 };
 	const int		nbr_len = sizeof (len_arr) / sizeof (len_arr [0]);
 	for (int k = 0; k < nbr_len && ret_val == 0; ++k)
 	{
@@ -82,6 +88,30 @@ void	TestHelperNormal <DT>::perform_test_speed (int &ret_val)
 
 
 
+// From 2^MIN_PARALLEL_BIT_DEPTH points, the passes are spread over the pool
+template <class DT>
+void	TestHelperNormal <DT>::perform_test_thread_pool (int &ret_val)
+{
+	FFTRealThreadPool	pool (4);
+
+	const int		len_arr [] = { 17, 18 };
+	const int		nbr_len = sizeof (len_arr) / sizeof (len_arr [0]);
+	for (int k = 0; k < nbr_len && ret_val == 0; ++k)
+	{
+		const long		len = 1L << (len_arr [k]);
+		FftType			fft (len);
+		fft.set_thread_pool (&pool);
+		printf ("%d thread(s)\n", pool.get_nbr_threads ());
+		ret_val = TestAccuracy <FftType>::perform_test_single_object (fft);
+		if (ret_val == 0)
+		{
+			ret_val = compare_with_single_thread (fft);
+		}
+	}
+}
+
+
+
 /*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
 
@@ -90,6 +120,66 @@ void	TestHelperNormal <DT>::perform_test_speed (int &ret_val)
 
 
 
+// The oscillators restart from an exact phase at each part, so the results
+// may differ by the rounding errors of the single-threaded transform. They
+// must match within the power error allowed by TestAccuracy.
+template <class DT>
+int	TestHelperNormal <DT>::compare_with_single_thread (FftType &fft)
+{
+	using namespace std;
+
+	int				ret_val = 0;
+	const long		len = fft.get_length ();
+
+	printf ("Comparing with the calling thread only [%ld samples]... ", len);
+	fflush (stdout);
+	FftType			fft_ref (len);
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	x (len);
+	std::vector <DataType>	f1 (len);
+	std::vector <DataType>	f2 (len);
+	std::vector <DataType>	y1 (len);
+	std::vector <DataType>	y2 (len);
+
+	noise.generate (&x [0], len);
+	fft.do_fft (&f1 [0], &x [0]);
+	fft_ref.do_fft (&f2 [0], &x [0]);
+	fft.do_ifft (&f2 [0], &y1 [0]);
+	fft_ref.do_ifft (&f2 [0], &y2 [0]);
+
+	double			power_f = 0;
+	double			power_dif_f = 0;
+	double			power_y = 0;
+	double			power_dif_y = 0;
+	for (long pos = 0; pos < len; ++pos)
+	{
+		const double	dif_f = double (f1 [pos]) - double (f2 [pos]);
+		const double	dif_y = double (y1 [pos]) - double (y2 [pos]);
+		power_f     += double (f2 [pos]) * double (f2 [pos]);
+		power_dif_f += dif_f * dif_f;
+		power_y     += double (y2 [pos]) * double (y2 [pos]);
+		power_dif_y += dif_y * dif_y;
+	}
+	const double	err_f = sqrt (power_dif_f / power_f);
+	const double	err_y = sqrt (power_dif_y / power_y);
+
+	printf ("done.\n");
+	printf (
+		"Relative difference: do_fft () %g, do_ifft () %g\n\n",
+		err_f,
+		err_y
+	);
+	if (err_f > 0.001 || err_y > 0.001)
+	{
+		printf ("*** Results differ from the single-threaded ones.\n");
+		ret_val = -1;
+	}
+
+	return (ret_val);
+}
+
+
+
 #endif	// TestHelperNormal_CODEHEADER_INCLUDED
 
 #undef TestHelperNormal_CURRENT_CODEHEADER
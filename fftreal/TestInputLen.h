@@ -0,0 +1,105 @@
+/*****************************************************************************
+
+        TestInputLen.h
+
+Checks that set_input_len () of FFTRealFixLen and FFTReal does not change
+the transforms of zero-padded sources.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (TestInputLen_HEADER_INCLUDED)
+#define	TestInputLen_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"FFTReal.h"
+#include	"FFTRealFixLen.h"
+
+
+
+class TestInputLen
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	static inline void
+						perform_test (int &ret_val);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	template <int L>
+	static inline int	perform_test_fix_len (long input_len);
+	template <class DT>
+	static inline int	perform_test_normal (long len, long input_len);
+	template <int L>
+	static inline void
+						perform_test_fix_len_all (int &ret_val);
+	template <class DT>
+	static inline void
+						perform_test_normal_all (long len, int &ret_val);
+	static inline int	check_err (double err);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						TestInputLen ();
+						~TestInputLen ();
+						TestInputLen (const TestInputLen &other);
+	TestInputLen &
+						operator = (const TestInputLen &other);
+	bool				operator == (const TestInputLen &other);
+	bool				operator != (const TestInputLen &other);
+
+};	// class TestInputLen
+
+
+
+#include	"TestInputLen.hpp"
+
+
+
+#endif	// TestInputLen_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,219 @@
+/*****************************************************************************
+
+        TestInputLen.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (TestInputLen_CURRENT_CODEHEADER)
+	#error Recursive inclusion of TestInputLen code header.
+#endif
+#define	TestInputLen_CURRENT_CODEHEADER
+
+#if ! defined (TestInputLen_CODEHEADER_INCLUDED)
+#define	TestInputLen_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"test_fnc.h"
+#include	"TestWhiteNoiseGen.h"
+
+#include	<algorithm>
+#include	<vector>
+
+#include	<cassert>
+#include	<cstdio>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// FFTRealFixLen::do_fft () ignores the input length under 128 points, where
+// it uses straight-line code, but do_power_spectrum () does not.
+void	TestInputLen::perform_test (int &ret_val)
+{
+	perform_test_fix_len_all < 6> (ret_val);
+	perform_test_fix_len_all < 7> (ret_val);
+	perform_test_fix_len_all <10> (ret_val);
+	perform_test_fix_len_all <13> (ret_val);
+
+	const int		len_arr [] = { 6, 7, 12, 17 };
+	const int		nbr_len = sizeof (len_arr) / sizeof (len_arr [0]);
+	for (int k = 0; k < nbr_len && ret_val == 0; ++k)
+	{
+		const long		len = 1L << (len_arr [k]);
+		perform_test_normal_all <float> (len, ret_val);
+		perform_test_normal_all <double> (len, ret_val);
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("\n");
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// Input lengths giving no spread, a partial one and a full one, some of
+// them not powers of 2
+template <int L>
+void	TestInputLen::perform_test_fix_len_all (int &ret_val)
+{
+	const long		len = FFTRealFixLen <L>::FFT_LEN;
+	const long		input_len_arr [] = { 1, 3, len / 16, len / 8 - 5, len / 2 };
+	const int		nbr_input_len =
+		sizeof (input_len_arr) / sizeof (input_len_arr [0]);
+	for (int k = 0; k < nbr_input_len && ret_val == 0; ++k)
+	{
+		ret_val = perform_test_fix_len <L> (input_len_arr [k]);
+	}
+}
+
+
+
+template <class DT>
+void	TestInputLen::perform_test_normal_all (long len, int &ret_val)
+{
+	const long		input_len_arr [] = { 1, 3, len / 16, len / 8 - 5, len / 2 };
+	const int		nbr_input_len =
+		sizeof (input_len_arr) / sizeof (input_len_arr [0]);
+	for (int k = 0; k < nbr_input_len && ret_val == 0; ++k)
+	{
+		ret_val = perform_test_normal <DT> (len, input_len_arr [k]);
+	}
+}
+
+
+
+template <int L>
+int	TestInputLen::perform_test_fix_len (long input_len)
+{
+	typedef	FFTRealFixLen <L>	FftType;
+	typedef	typename FftType::DataType	DataType;
+
+	const long		len = FftType::FFT_LEN;
+	const long		nbr_bins = len / 2 + 1;
+	assert (input_len > 0);
+	assert (input_len <= len);
+
+	printf (
+		"Testing FFTRealFixLen <%d>::set_input_len () [%ld samples, %ld input samples]... ",
+		L,
+		len,
+		input_len
+	);
+	fflush (stdout);
+
+	std::vector <DataType>	x (len, 0);
+	TestWhiteNoiseGen <DataType>	noise;
+	noise.generate (&x [0], input_len);
+
+	FftType			fft_ref;
+	std::vector <DataType>	f_ref (len);
+	std::vector <DataType>	p_ref (nbr_bins);
+	fft_ref.do_fft (&f_ref [0], &x [0]);
+	fft_ref.do_power_spectrum (&p_ref [0], &x [0]);
+
+	FftType			fft;
+	fft.set_input_len (input_len);
+	std::vector <DataType>	f (len);
+	std::vector <DataType>	p (nbr_bins);
+	fft.do_fft (&f [0], &x [0]);
+	fft.do_power_spectrum (&p [0], &x [0]);
+
+	const double	err = std::max (
+		compute_rel_err (&f [0], &f_ref [0], len),
+		compute_rel_err (&p [0], &p_ref [0], nbr_bins)
+	);
+
+	return (check_err (err));
+}
+
+
+
+template <class DT>
+int	TestInputLen::perform_test_normal (long len, long input_len)
+{
+	assert (len > 0);
+	assert (input_len > 0);
+	assert (input_len <= len);
+
+	printf (
+		"Testing FFTReal <%s>::set_input_len () [%ld samples, %ld input samples]... ",
+		(sizeof (DT) == sizeof (float)) ? "float" : "double",
+		len,
+		input_len
+	);
+	fflush (stdout);
+
+	std::vector <DT>	x (len, 0);
+	TestWhiteNoiseGen <DT>	noise;
+	noise.generate (&x [0], input_len);
+
+	FFTReal <DT>		fft_ref (len);
+	std::vector <DT>	f_ref (len);
+	fft_ref.do_fft (&f_ref [0], &x [0]);
+
+	FFTReal <DT>		fft (len);
+	fft.set_input_len (input_len);
+	std::vector <DT>	f (len);
+	fft.do_fft (&f [0], &x [0]);
+
+	return (check_err (compute_rel_err (&f [0], &f_ref [0], len)));
+}
+
+
+
+int	TestInputLen::check_err (double err)
+{
+	printf ("done.\n");
+	printf ("Relative error: %g\n", err);
+
+	int				ret_val = 0;
+	if (err > 1e-5)
+	{
+		printf ("*** Results differ from the transform of the whole source.\n");
+		ret_val = -1;
+	}
+
+	return (ret_val);
+}
+
+
+
+#endif	// TestInputLen_CODEHEADER_INCLUDED
+
+#undef TestInputLen_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,100 @@
+/*****************************************************************************
+
+        TestPcm16.h
+
+Checks the FFTRealFixLen transforms reading 16-bit PCM through
+FFTRealPcm16Reader against the same transforms of the samples scaled and
+windowed beforehand.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (TestPcm16_HEADER_INCLUDED)
+#define	TestPcm16_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"FFTRealFixLen.h"
+#include	"FFTRealPcm16Reader.h"
+
+
+
+template <int L>
+class TestPcm16
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	FFTRealFixLen <L>	FftType;
+	typedef	typename FftType::DataType	DataType;
+
+	static void		perform_test (int &ret_val);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	static int		perform_test_stride (long stride, long offset);
+	static int		check_err (double err);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						TestPcm16 ();
+						~TestPcm16 ();
+						TestPcm16 (const TestPcm16 &other);
+	TestPcm16 &
+						operator = (const TestPcm16 &other);
+	bool				operator == (const TestPcm16 &other);
+	bool				operator != (const TestPcm16 &other);
+
+};	// class TestPcm16
+
+
+
+#include	"TestPcm16.hpp"
+
+
+
+#endif	// TestPcm16_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,167 @@
+/*****************************************************************************
+
+        TestPcm16.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (TestPcm16_CURRENT_CODEHEADER)
+	#error Recursive inclusion of TestPcm16 code header.
+#endif
+#define	TestPcm16_CURRENT_CODEHEADER
+
+#if ! defined (TestPcm16_CODEHEADER_INCLUDED)
+#define	TestPcm16_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"test_fnc.h"
+
+#include	<vector>
+
+#include	<cassert>
+#include	<cmath>
+#include	<cstdio>
+#include	<cstdlib>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// Mono and stereo frames, aligned or not
+template <int L>
+void	TestPcm16 <L>::perform_test (int &ret_val)
+{
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_stride (2, 0);
+	}
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_stride (2, 1);
+	}
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_stride (4, 3);
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// The samples span the whole 16-bit range. For stereo frames, the other
+// channel holds other samples, which must not be read.
+template <int L>
+int	TestPcm16 <L>::perform_test_stride (long stride, long offset)
+{
+	assert (stride >= 2);
+	assert (offset >= 0);
+
+	const long		len = FftType::FFT_LEN;
+	const long		nbr_bins = len / 2 + 1;
+	const double	scale = 20 / log (10.0);
+
+	printf (
+		"Testing FFTRealFixLen <%d>::do_fft () / do_log_magnitude () on PCM [%ld samples, stride %ld, offset %ld]... ",
+		L,
+		len,
+		stride,
+		offset
+	);
+	fflush (stdout);
+
+	std::vector <unsigned char>	pcm (offset + len * stride);
+	for (size_t pos = 0; pos < pcm.size (); ++pos)
+	{
+		pcm [pos] = static_cast <unsigned char> (rand () & 0xFF);
+	}
+	const unsigned char *	pcm_ptr = &pcm [offset];
+
+	// Hann window, and the samples as the reader should see them
+	std::vector <DataType>	win (len);
+	std::vector <DataType>	x (len);
+	for (long pos = 0; pos < len; ++pos)
+	{
+		win [pos] = DataType (0.5 - 0.5 * cos (2 * PI * pos / len));
+		const unsigned char *	byte_ptr = pcm_ptr + pos * stride;
+		const short		sample = static_cast <short> (byte_ptr [0] | (byte_ptr [1] << 8));
+		x [pos] = DataType (sample) * DataType (1.0 / 32768) * win [pos];
+	}
+
+	FftType			fft;
+	const FFTRealPcm16Reader	reader (pcm_ptr, stride, &win [0]);
+
+	std::vector <DataType>	f (len);
+	std::vector <DataType>	f_ref (len);
+	fft.do_fft (&f [0], reader);
+	fft.do_fft (&f_ref [0], &x [0]);
+	double			err = compute_rel_err (&f [0], &f_ref [0], len);
+
+	std::vector <DataType>	m (nbr_bins);
+	std::vector <DataType>	m_ref (nbr_bins);
+	fft.do_log_magnitude (&m [0], reader, DataType (scale));
+	fft.do_log_magnitude (&m_ref [0], &x [0], DataType (scale));
+	const double	err_log = compute_rel_err (&m [0], &m_ref [0], nbr_bins);
+	if (err_log > err)
+	{
+		err = err_log;
+	}
+
+	return (check_err (err));
+}
+
+
+
+template <int L>
+int	TestPcm16 <L>::check_err (double err)
+{
+	printf ("done.\n");
+	printf ("Relative error: %g\n", err);
+
+	int				ret_val = 0;
+	if (err > 1e-5)
+	{
+		printf ("*** Results differ from the transforms of the converted samples.\n");
+		ret_val = -1;
+	}
+
+	return (ret_val);
+}
+
+
+
+#endif	// TestPcm16_CODEHEADER_INCLUDED
+
+#undef TestPcm16_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,176 @@
+/*****************************************************************************
+
+        TestSlidingDft.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (TestSlidingDft_CURRENT_CODEHEADER)
+	#error Recursive inclusion of TestSlidingDft code header.
+#endif
+#define	TestSlidingDft_CURRENT_CODEHEADER
+
+#if ! defined (TestSlidingDft_CODEHEADER_INCLUDED)
+#define	TestSlidingDft_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"def.h"
+#include	"FFTReal.h"
+#include	"test_fnc.h"
+#include	"TestWhiteNoiseGen.h"
+
+#include	<vector>
+
+#include	<cassert>
+#include	<cmath>
+#include	<cstdio>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+void	TestSlidingDft <DT>::perform_test (int &ret_val)
+{
+	const int		len_arr [] = { 4, 8, 10 };
+	const int		nbr_len = sizeof (len_arr) / sizeof (len_arr [0]);
+	for (int k = 0; k < nbr_len && ret_val == 0; ++k)
+	{
+		const long		len = 1L << (len_arr [k]);
+		for (int hann = 0; hann < 2 && ret_val == 0; ++hann)
+		{
+			// All the bins, then a range away from DC and Nyquist
+			ret_val = perform_test_range (len, 0, len / 2 + 1, hann != 0);
+			if (ret_val == 0)
+			{
+				ret_val = perform_test_range (len, 3, len / 4 + 1, hann != 0);
+			}
+		}
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("\n");
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+int	TestSlidingDft <DT>::perform_test_range (long len, long bin_beg, long bin_end, bool hann_flag)
+{
+	assert (len > 1);
+	assert (bin_beg >= 0);
+	assert (bin_beg < bin_end);
+	assert (bin_end <= len / 2 + 1);
+
+	using namespace std;
+
+	int				ret_val = 0;
+
+	printf (
+		"Testing FFTRealSlidingDft::get_bins () [%ld samples, bins %ld to %ld, %s]... ",
+		len,
+		bin_beg,
+		bin_end - 1,
+		(hann_flag) ? "Hann" : "rectangular"
+	);
+	fflush (stdout);
+
+	// The history wraps around several times, and not at a multiple of len.
+	// The first part goes through process_block (), the rest sample by
+	// sample.
+	const long		sig_len = len * 3 + len / 2 + 1;
+	const long		block_len = sig_len / 2;
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	sig (sig_len);
+	noise.generate (&sig [0], sig_len);
+
+	SdftType			sdft (len, bin_beg, bin_end);
+	sdft.process_block (&sig [0], block_len);
+	for (long pos = block_len; pos < sig_len; ++pos)
+	{
+		sdft.process_sample (sig [pos]);
+	}
+
+	const long		nbr_bins = bin_end - bin_beg;
+	std::vector <DataType>	bins (nbr_bins * 2);
+	sdft.get_bins (&bins [0], &bins [nbr_bins], hann_flag);
+
+	// Full FFT of the last len samples. FFTReal stores the opposite of the
+	// imaginary parts, and none for DC and Nyquist.
+	std::vector <DataType>	x (len);
+	for (long pos = 0; pos < len; ++pos)
+	{
+		DataType			win = 1;
+		if (hann_flag)
+		{
+			win = DataType (0.5 - 0.5 * cos (2 * PI * pos / len));
+		}
+		x [pos] = sig [sig_len - len + pos] * win;
+	}
+	std::vector <DataType>	f (len);
+	FFTReal <DataType>	fft (len);
+	fft.do_fft (&f [0], &x [0]);
+
+	std::vector <DataType>	bins_ref (nbr_bins * 2);
+	for (long bin = bin_beg; bin < bin_end; ++bin)
+	{
+		const bool		real_flag = (bin == 0 || bin == len / 2);
+		bins_ref [           bin - bin_beg] = f [bin];
+		bins_ref [nbr_bins + bin - bin_beg] = (real_flag) ? 0 : -f [len / 2 + bin];
+	}
+
+	const double	err = compute_rel_err (&bins [0], &bins_ref [0], nbr_bins * 2);
+	const double	max_rel_err = 1e-5;
+
+	printf ("done.\n");
+	printf ("Relative error: %g\n", err);
+	if (err > max_rel_err)
+	{
+		printf ("*** Results differ from the full FFT.\n");
+		ret_val = -1;
+	}
+
+	return (ret_val);
+}
+
+
+
+#endif	// TestSlidingDft_CODEHEADER_INCLUDED
+
+#undef TestSlidingDft_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,102 @@
+/*****************************************************************************
+
+        TestSpectrum.h
+
+Checks the power and log-magnitude spectra of FFTRealFixLen against the
+half-complex output of FFTReal <double>, and that set_max_bin () keeps the
+bins it does not prune.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (TestSpectrum_HEADER_INCLUDED)
+#define	TestSpectrum_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"FFTRealFixLen.h"
+
+
+
+template <int L>
+class TestSpectrum
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	FFTRealFixLen <L>	FftType;
+	typedef	typename FftType::DataType	DataType;
+
+	static void		perform_test (int &ret_val);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	static int		perform_test_power (const DataType x []);
+	static int		perform_test_log (const DataType x []);
+	static int		perform_test_max_bin (const DataType x [], long max_bin);
+	static void		compute_power_ref (DataType p [], const DataType x []);
+	static int		check_err (double err);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						TestSpectrum ();
+						~TestSpectrum ();
+						TestSpectrum (const TestSpectrum &other);
+	TestSpectrum &
+						operator = (const TestSpectrum &other);
+	bool				operator == (const TestSpectrum &other);
+	bool				operator != (const TestSpectrum &other);
+
+};	// class TestSpectrum
+
+
+
+#include	"TestSpectrum.hpp"
+
+
+
+#endif	// TestSpectrum_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
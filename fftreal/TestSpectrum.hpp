@@ -0,0 +1,255 @@
+/*****************************************************************************
+
+        TestSpectrum.hpp
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (TestSpectrum_CURRENT_CODEHEADER)
+	#error Recursive inclusion of TestSpectrum code header.
+#endif
+#define	TestSpectrum_CURRENT_CODEHEADER
+
+#if ! defined (TestSpectrum_CODEHEADER_INCLUDED)
+#define	TestSpectrum_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"FFTReal.h"
+#include	"test_fnc.h"
+#include	"TestWhiteNoiseGen.h"
+
+#include	<algorithm>
+#include	<vector>
+
+#include	<cassert>
+#include	<cfloat>
+#include	<cmath>
+#include	<cstdio>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// Noise, then silence for the null bins of do_log_magnitude ()
+template <int L>
+void	TestSpectrum <L>::perform_test (int &ret_val)
+{
+	const long		len = FftType::FFT_LEN;
+	std::vector <DataType>	x (len);
+	TestWhiteNoiseGen <DataType>	noise;
+	noise.generate (&x [0], len);
+
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_power (&x [0]);
+	}
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_log (&x [0]);
+	}
+
+	// 37 is not a power of 2. Pruning starts at the passes whose blocks are
+	// longer than 4 * max_bin.
+	const long		max_bin_arr [] = { 1, 37, len / 8, len / 2 };
+	const int		nbr_max_bin = sizeof (max_bin_arr) / sizeof (max_bin_arr [0]);
+	for (int k = 0; k < nbr_max_bin && ret_val == 0; ++k)
+	{
+		if (max_bin_arr [k] <= len / 2)
+		{
+			ret_val = perform_test_max_bin (&x [0], max_bin_arr [k]);
+		}
+	}
+
+	std::fill (x.begin (), x.end (), DataType (0));
+	if (ret_val == 0)
+	{
+		ret_val = perform_test_log (&x [0]);
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <int L>
+int	TestSpectrum <L>::perform_test_power (const DataType x [])
+{
+	assert (x != 0);
+
+	const long		len = FftType::FFT_LEN;
+	const long		nbr_bins = len / 2 + 1;
+
+	printf (
+		"Testing FFTRealFixLen <%d>::do_power_spectrum () [%ld samples]... ",
+		L,
+		len
+	);
+	fflush (stdout);
+
+	FftType			fft;
+	std::vector <DataType>	p (nbr_bins);
+	std::vector <DataType>	p_ref (nbr_bins);
+	fft.do_power_spectrum (&p [0], x);
+	compute_power_ref (&p_ref [0], x);
+
+	return (check_err (compute_rel_err (&p [0], &p_ref [0], nbr_bins)));
+}
+
+
+
+// m [k] = scale * ln (|X [k]|), null bins clipped to FLT_MIN in power
+template <int L>
+int	TestSpectrum <L>::perform_test_log (const DataType x [])
+{
+	assert (x != 0);
+
+	const long		len = FftType::FFT_LEN;
+	const long		nbr_bins = len / 2 + 1;
+	const double	scale = 20 / log (10.0);
+
+	printf (
+		"Testing FFTRealFixLen <%d>::do_log_magnitude () [%ld samples]... ",
+		L,
+		len
+	);
+	fflush (stdout);
+
+	FftType			fft;
+	std::vector <DataType>	m (nbr_bins);
+	std::vector <DataType>	m_ref (nbr_bins);
+	fft.do_log_magnitude (&m [0], x, DataType (scale));
+	compute_power_ref (&m_ref [0], x);
+	for (long bin = 0; bin < nbr_bins; ++bin)
+	{
+		const double	p = std::max (double (m_ref [bin]), double (FLT_MIN));
+		m_ref [bin] = DataType (scale * 0.5 * log (p));
+	}
+
+	return (check_err (compute_rel_err (&m [0], &m_ref [0], nbr_bins)));
+}
+
+
+
+// Bins 0 to max_bin must not depend on max_bin
+template <int L>
+int	TestSpectrum <L>::perform_test_max_bin (const DataType x [], long max_bin)
+{
+	assert (x != 0);
+	assert (max_bin >= 0);
+	assert (max_bin <= FftType::FFT_LEN / 2);
+
+	const long		len = FftType::FFT_LEN;
+	const long		nbr_bins = len / 2 + 1;
+	const long		nbr_kept = max_bin + 1;
+
+	printf (
+		"Testing FFTRealFixLen <%d>::set_max_bin () [%ld samples, max bin %ld]... ",
+		L,
+		len,
+		max_bin
+	);
+	fflush (stdout);
+
+	FftType			fft;
+	std::vector <DataType>	p_ref (nbr_bins);
+	std::vector <DataType>	m_ref (nbr_bins);
+	fft.do_power_spectrum (&p_ref [0], x);
+	fft.do_log_magnitude (&m_ref [0], x);
+
+	fft.set_max_bin (max_bin);
+	std::vector <DataType>	p (nbr_bins);
+	std::vector <DataType>	m (nbr_bins);
+	fft.do_power_spectrum (&p [0], x);
+	fft.do_log_magnitude (&m [0], x);
+
+	const double	err = std::max (
+		compute_rel_err (&p [0], &p_ref [0], nbr_kept),
+		compute_rel_err (&m [0], &m_ref [0], nbr_kept)
+	);
+
+	return (check_err (err));
+}
+
+
+
+// |X [k]|^2 for k in [0 ; len/2], from the half-complex layout of FFTReal
+template <int L>
+void	TestSpectrum <L>::compute_power_ref (DataType p [], const DataType x [])
+{
+	assert (p != 0);
+	assert (x != 0);
+
+	const long		len = FftType::FFT_LEN;
+	const long		h_len = len / 2;
+
+	std::vector <double>	x_dbl (x, x + len);
+	std::vector <double>	f (len);
+	FFTReal <double>	fft (len);
+	fft.do_fft (&f [0], &x_dbl [0]);
+
+	for (long bin = 0; bin <= h_len; ++bin)
+	{
+		const double	re = f [bin];
+		const double	im = (bin == 0 || bin == h_len) ? 0 : f [h_len + bin];
+		p [bin] = DataType (re * re + im * im);
+	}
+}
+
+
+
+// Above 2^TRIGO_BD_LIMIT points, the last passes get their twiddle factors
+// from oscillators, whose rounding errors accumulate: the float spectrum is
+// then about 1e-5 off, as for do_fft ().
+template <int L>
+int	TestSpectrum <L>::check_err (double err)
+{
+	printf ("done.\n");
+	printf ("Relative error: %g\n", err);
+
+	int				ret_val = 0;
+	if (err > 1e-4)
+	{
+		printf ("*** Results differ from the reference spectrum.\n");
+		ret_val = -1;
+	}
+
+	return (ret_val);
+}
+
+
+
+#endif	// TestSpectrum_CODEHEADER_INCLUDED
+
+#undef TestSpectrum_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -6,15 +6,47 @@ HEADERS  += Array.h \
             Array.hpp \
             DynArray.h \
             DynArray.hpp \
+            FFTRealBatch.h \
+            FFTRealBatch.hpp \
+            FFTRealBitRev.h \
+            FFTRealBitRev.hpp \
+            FFTRealCodelet.h \
+            FFTRealCodelet.hpp \
+            FFTRealConvolver.h \
+            FFTRealConvolver.hpp \
+            FFTRealCorrelation.h \
+            FFTRealCorrelation.hpp \
+            FFTRealDct.h \
+            FFTRealDct.hpp \
+            FFTRealDctCore.h \
+            FFTRealDctCore.hpp \
+            FFTRealDctFixLen.h \
+            FFTRealDctFixLen.hpp \
             FFTRealFixLen.h \
             FFTRealFixLen.hpp \
             FFTRealFixLenParam.h \
+            FFTRealFourStep.h \
+            FFTRealFourStep.hpp \
+            FFTRealGoertzel.h \
+            FFTRealGoertzel.hpp \
+            FFTRealMixed.h \
+            FFTRealMixed.hpp \
             FFTRealPassDirect.h \
             FFTRealPassDirect.hpp \
             FFTRealPassInverse.h \
             FFTRealPassInverse.hpp \
+            FFTRealPcm16Reader.h \
+            FFTRealPcm16Reader.hpp \
             FFTRealSelect.h \
             FFTRealSelect.hpp \
+            FFTRealSimd.h \
+            FFTRealSimd.hpp \
+            FFTRealSlidingDft.h \
+            FFTRealSlidingDft.hpp \
+            FFTRealTable.h \
+            FFTRealTable.hpp \
+            FFTRealThreadPool.h \
+            FFTRealThreadPool.hpp \
             FFTRealUseTrigo.h \
             FFTRealUseTrigo.hpp \
             OscSinCos.h \
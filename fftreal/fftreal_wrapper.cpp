@@ -29,16 +29,360 @@
 #    pragma warning off (10182)
 #endif
 
+#include "FFTRealBatch.h"
+#include "FFTRealConvolver.h"
+#include "FFTRealCorrelation.h"
 #include "FFTRealFixLen.h"
+#include "FFTRealFourStep.h"
+#include "FFTRealGoertzel.h"
+#include "FFTRealMixed.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <thread>
+#include <vector>
 
 class FFTRealWrapperPrivate {
 public:
-    FFTRealFixLen<FFTLengthPowerOfTwo> m_fft;
+    FFTRealWrapperPrivate() : m_batch(0) { }
+    virtual ~FFTRealWrapperPrivate() { delete m_batch; }
+
+    // Created on first use, as its buffers hold several frames
+    FFTRealBatch *batch()
+    {
+        if (!m_batch)
+            m_batch = new FFTRealBatch(length());
+        return m_batch;
+    }
+
+    virtual int length() const = 0;
+    virtual int inputLength() const = 0;
+    virtual void setInputLength(int count) = 0;
+    virtual int maxBin() const = 0;
+    virtual void setMaxBin(int bin) = 0;
+    virtual void calculateFFT(FFTRealWrapper::DataType in[],
+                              const FFTRealWrapper::DataType out[]) = 0;
+    virtual void calculateIFFT(FFTRealWrapper::DataType out[],
+                               const FFTRealWrapper::DataType in[]) = 0;
+    virtual void calculatePowerSpectrum(FFTRealWrapper::DataType bins[],
+                                        const FFTRealWrapper::DataType samples[]) = 0;
+    virtual void calculateLogMagnitude(FFTRealWrapper::DataType bins[],
+                                       const FFTRealWrapper::DataType samples[],
+                                       FFTRealWrapper::DataType scale) = 0;
+    virtual void calculateFFT(FFTRealWrapper::DataType out[],
+                              const FFTRealPcm16Reader &pcm) = 0;
+    virtual void calculateLogMagnitude(FFTRealWrapper::DataType bins[],
+                                       const FFTRealPcm16Reader &pcm,
+                                       FFTRealWrapper::DataType scale) = 0;
+
+    virtual void calculateFFTBatch(FFTRealWrapper::DataType in[], int inStride,
+                                   const FFTRealWrapper::DataType out[], int outStride,
+                                   int frameCount)
+    {
+        batch()->do_fft(in, inStride, out, outStride, frameCount);
+    }
+
+    // Both inputs are padded to length() with zeros; the forward FFTs are
+    // told that only the first count samples are non-zero.
+    void autocorrelate(FFTRealWrapper::DataType out[],
+                       const FFTRealWrapper::DataType in[], int count)
+    {
+        const int n = length();
+        std::vector<FFTRealWrapper::DataType> &x = padded(m_corrX, in, count);
+        m_corrF.resize(n);
+
+        const int oldInputLength = inputLength();
+        setInputLength(count);
+        calculateFFT(&m_corrF[0], &x[0]);
+        setInputLength(oldInputLength);
+
+        FFTRealCorrelation::mul_power(n, &m_corrF[0], &m_corrF[0]);
+        calculateIFFT(&x[0], &m_corrF[0]);
+        std::copy(x.begin(), x.begin() + count, out);
+    }
+
+    void crossCorrelate(FFTRealWrapper::DataType out[],
+                        const FFTRealWrapper::DataType a[],
+                        const FFTRealWrapper::DataType b[], int count)
+    {
+        const int n = length();
+        std::vector<FFTRealWrapper::DataType> &x = padded(m_corrX, a, count);
+        std::vector<FFTRealWrapper::DataType> &y = padded(m_corrY, b, count);
+        m_corrF.resize(n);
+
+        const int oldInputLength = inputLength();
+        setInputLength(count);
+        calculateFFT(&m_corrF[0], &x[0]);
+        calculateFFT(&x[0], &y[0]);
+        setInputLength(oldInputLength);
+
+        FFTRealCorrelation::mul_conj(n, &m_corrF[0], &m_corrF[0], &x[0]);
+        calculateIFFT(&x[0], &m_corrF[0]);
+
+        // Negative lags wrap around to the end of the circular result
+        std::copy(x.end() - (count - 1), x.end(), out);
+        std::copy(x.begin(), x.begin() + count, out + count - 1);
+    }
+
+private:
+    std::vector<FFTRealWrapper::DataType> &padded(std::vector<FFTRealWrapper::DataType> &buf,
+                                                  const FFTRealWrapper::DataType in[],
+                                                  int count)
+    {
+        buf.resize(length());
+        std::copy(in, in + count, buf.begin());
+        std::fill(buf.begin() + count, buf.end(), FFTRealWrapper::DataType(0));
+        return buf;
+    }
+
+    FFTRealBatch *m_batch;
+    std::vector<FFTRealWrapper::DataType> m_corrX;
+    std::vector<FFTRealWrapper::DataType> m_corrY;
+    std::vector<FFTRealWrapper::DataType> m_corrF;
+};
+
+template <int LengthPowerOfTwo>
+class FFTRealWrapperFixLen : public FFTRealWrapperPrivate {
+public:
+    int length() const
+    {
+        return m_fft.get_length();
+    }
+
+    int inputLength() const
+    {
+        return m_fft.get_input_len();
+    }
+
+    void setInputLength(int count)
+    {
+        m_fft.set_input_len(count);
+    }
+
+    int maxBin() const
+    {
+        return m_fft.get_max_bin();
+    }
+
+    void setMaxBin(int bin)
+    {
+        m_fft.set_max_bin(bin);
+    }
+
+    void calculateFFT(FFTRealWrapper::DataType in[],
+                      const FFTRealWrapper::DataType out[])
+    {
+        m_fft.do_fft(in, out);
+    }
+
+    void calculateIFFT(FFTRealWrapper::DataType out[],
+                       const FFTRealWrapper::DataType in[])
+    {
+        m_fft.do_ifft(in, out);
+    }
+
+    void calculatePowerSpectrum(FFTRealWrapper::DataType bins[],
+                                const FFTRealWrapper::DataType samples[])
+    {
+        m_fft.do_power_spectrum(bins, samples);
+    }
+
+    void calculateLogMagnitude(FFTRealWrapper::DataType bins[],
+                               const FFTRealWrapper::DataType samples[],
+                               FFTRealWrapper::DataType scale)
+    {
+        m_fft.do_log_magnitude(bins, samples, scale);
+    }
+
+    void calculateFFT(FFTRealWrapper::DataType out[],
+                      const FFTRealPcm16Reader &pcm)
+    {
+        m_fft.do_fft(out, pcm);
+    }
+
+    void calculateLogMagnitude(FFTRealWrapper::DataType bins[],
+                               const FFTRealPcm16Reader &pcm,
+                               FFTRealWrapper::DataType scale)
+    {
+        m_fft.do_log_magnitude(bins, pcm, scale);
+    }
+
+private:
+    FFTRealFixLen<LengthPowerOfTwo> m_fft;
+};
+
+// Wrapper around an FFT object whose length is chosen at runtime:
+// FFTRealMixed or FFTRealFourStep.  There are no fused passes here: the
+// spectrum bins are computed from the half-complex output, and setMaxBin()
+// only saves the conversion of the bins above.  setInputLength() has no
+// effect.
+template <class FFTType>
+class FFTRealWrapperDynLen : public FFTRealWrapperPrivate {
+public:
+    explicit FFTRealWrapperDynLen(int length)
+        :   m_fft(length)
+        ,   m_inputLength(length)
+        ,   m_maxBin(length / 2)
+        ,   m_input(length)
+        ,   m_output(length)
+    {
+
+    }
+
+    FFTRealWrapperDynLen(int length, int threadCount)
+        :   m_fft(length, threadCount)
+        ,   m_inputLength(length)
+        ,   m_maxBin(length / 2)
+        ,   m_input(length)
+        ,   m_output(length)
+    {
+
+    }
+
+    int length() const
+    {
+        return m_fft.get_length();
+    }
+
+    int inputLength() const
+    {
+        return m_inputLength;
+    }
+
+    void setInputLength(int count)
+    {
+        m_inputLength = count;
+    }
+
+    int maxBin() const
+    {
+        return m_maxBin;
+    }
+
+    void setMaxBin(int bin)
+    {
+        m_maxBin = bin;
+    }
+
+    void calculateFFT(FFTRealWrapper::DataType in[],
+                      const FFTRealWrapper::DataType out[])
+    {
+        m_fft.do_fft(in, out);
+    }
+
+    void calculateIFFT(FFTRealWrapper::DataType out[],
+                       const FFTRealWrapper::DataType in[])
+    {
+        m_fft.do_ifft(in, out);
+    }
+
+    void calculatePowerSpectrum(FFTRealWrapper::DataType bins[],
+                                const FFTRealWrapper::DataType samples[])
+    {
+        m_fft.do_fft(&m_output[0], samples);
+
+        const int n = length();
+        const int half = n / 2;
+        bins[0] = m_output[0] * m_output[0];
+        for (int i = 1; i <= m_maxBin; ++i) {
+            const FFTRealWrapper::DataType re = m_output[i];
+            const FFTRealWrapper::DataType im = (half + i < n) ? m_output[half + i] : 0;
+            bins[i] = re * re + im * im;
+        }
+    }
+
+    void calculateLogMagnitude(FFTRealWrapper::DataType bins[],
+                               const FFTRealWrapper::DataType samples[],
+                               FFTRealWrapper::DataType scale)
+    {
+        calculatePowerSpectrum(bins, samples);
+        powerToLog(bins, scale);
+    }
+
+    void calculateFFT(FFTRealWrapper::DataType out[],
+                      const FFTRealPcm16Reader &pcm)
+    {
+        readPcm(pcm);
+        m_fft.do_fft(out, &m_input[0]);
+    }
+
+    void calculateLogMagnitude(FFTRealWrapper::DataType bins[],
+                               const FFTRealPcm16Reader &pcm,
+                               FFTRealWrapper::DataType scale)
+    {
+        readPcm(pcm);
+        calculateLogMagnitude(bins, &m_input[0], scale);
+    }
+
+    void calculateFFTBatch(FFTRealWrapper::DataType in[], int inStride,
+                           const FFTRealWrapper::DataType out[], int outStride,
+                           int frameCount)
+    {
+        for (int i = 0; i < frameCount; ++i)
+            m_fft.do_fft(in + i * inStride, out + i * outStride);
+    }
+
+private:
+    void readPcm(const FFTRealPcm16Reader &pcm)
+    {
+        const int n = length();
+        for (int i = 0; i < n; ++i)
+            m_input[i] = pcm[i];
+    }
+
+    void powerToLog(FFTRealWrapper::DataType bins[], FFTRealWrapper::DataType scale) const
+    {
+        const int binCount = m_maxBin + 1;
+        if (FFTRealSimd::get_isa() != FFTRealSimd::Isa_SCALAR) {
+            FFTRealSimd::power_to_log(binCount, bins, scale);
+        } else {
+            const FFTRealWrapper::DataType mul = scale * FFTRealWrapper::DataType(0.5);
+            for (int i = 0; i < binCount; ++i)
+                bins[i] = mul * std::log(std::max(bins[i], FLT_MIN));
+        }
+    }
+
+    FFTType m_fft;
+    int m_inputLength;
+    int m_maxBin;
+    std::vector<FFTRealWrapper::DataType> m_input;
+    std::vector<FFTRealWrapper::DataType> m_output;
 };
 
+static FFTRealWrapperPrivate *createPrivate(int lengthPowerOfTwo)
+{
+    switch (lengthPowerOfTwo) {
+    case 8:  return new FFTRealWrapperFixLen<8>;
+    case 9:  return new FFTRealWrapperFixLen<9>;
+    case 10: return new FFTRealWrapperFixLen<10>;
+    case 11: return new FFTRealWrapperFixLen<11>;
+    case 12: return new FFTRealWrapperFixLen<12>;
+    case 13: return new FFTRealWrapperFixLen<13>;
+    case 14: return new FFTRealWrapperFixLen<14>;
+    case 15: return new FFTRealWrapperFixLen<15>;
+    case 16: return new FFTRealWrapperFixLen<16>;
+    default: return 0;
+    }
+}
+
+static int lengthToPowerOfTwo(int length)
+{
+    for (int i = FFTMinLengthPowerOfTwo; i <= FFTFourStepMaxLengthPowerOfTwo; ++i)
+        if (length == (1 << i))
+            return i;
+    return -1;
+}
+
 
 FFTRealWrapper::FFTRealWrapper()
-    :   m_private(new FFTRealWrapperPrivate)
+    :   m_private(createPrivate(FFTLengthPowerOfTwo))
+{
+
+}
+
+FFTRealWrapper::FFTRealWrapper(FFTRealWrapperPrivate *d)
+    :   m_private(d)
 {
 
 }
@@ -48,7 +392,264 @@ FFTRealWrapper::~FFTRealWrapper()
     delete m_private;
 }
 
+FFTRealWrapper *FFTRealWrapper::create(int length)
+{
+    if (!isSupportedLength(length))
+        return 0;
+
+    const int lengthPowerOfTwo = lengthToPowerOfTwo(length);
+    FFTRealWrapperPrivate *d = createPrivate(lengthPowerOfTwo);
+    if (!d && lengthPowerOfTwo > FFTMaxLengthPowerOfTwo) {
+        const int threadCount = std::max(int(std::thread::hardware_concurrency()), 1);
+        d = new FFTRealWrapperDynLen<FFTRealFourStep<DataType> >(length, threadCount);
+    }
+    if (!d)
+        d = new FFTRealWrapperDynLen<FFTRealMixed<DataType> >(length);
+    return new FFTRealWrapper(d);
+}
+
+bool FFTRealWrapper::isSupportedLength(int length)
+{
+    if (lengthToPowerOfTwo(length) >= 0)
+        return true;
+    return length >= (1 << FFTMinLengthPowerOfTwo)
+            && length <= (1 << FFTMaxLengthPowerOfTwo)
+            && FFTRealMixed<DataType>::is_supported_length(length);
+}
+
+int FFTRealWrapper::length() const
+{
+    return m_private->length();
+}
+
+int FFTRealWrapper::inputLength() const
+{
+    return m_private->inputLength();
+}
+
+void FFTRealWrapper::setInputLength(int count)
+{
+    Q_ASSERT(count >= 0 && count <= length());
+    m_private->setInputLength(count);
+}
+
+int FFTRealWrapper::maxBin() const
+{
+    return m_private->maxBin();
+}
+
+void FFTRealWrapper::setMaxBin(int bin)
+{
+    Q_ASSERT(bin >= 0 && bin <= length() / 2);
+    m_private->setMaxBin(bin);
+}
+
 void FFTRealWrapper::calculateFFT(DataType in[], const DataType out[])
 {
-    m_private->m_fft.do_fft(in, out);
+    m_private->calculateFFT(in, out);
+}
+
+void FFTRealWrapper::autocorrelate(DataType out[], const DataType in[], int count)
+{
+    Q_ASSERT(count > 0 && count <= length() / 2);
+    m_private->autocorrelate(out, in, count);
+}
+
+void FFTRealWrapper::crossCorrelate(DataType out[], const DataType a[],
+                                    const DataType b[], int count)
+{
+    Q_ASSERT(count > 0 && count <= length() / 2);
+    m_private->crossCorrelate(out, a, b, count);
+}
+
+void FFTRealWrapper::calculatePowerSpectrum(DataType bins[], const DataType samples[])
+{
+    m_private->calculatePowerSpectrum(bins, samples);
+}
+
+void FFTRealWrapper::calculateLogMagnitude(DataType bins[], const DataType samples[],
+                                           DataType scale)
+{
+    m_private->calculateLogMagnitude(bins, samples, scale);
+}
+
+void FFTRealWrapper::calculateFFTPcm16(DataType out[], const char *pcm, int stride,
+                                       const DataType window[])
+{
+    m_private->calculateFFT(out, FFTRealPcm16Reader(pcm, stride, window));
+}
+
+void FFTRealWrapper::calculateLogMagnitudePcm16(DataType bins[], const char *pcm,
+                                                int stride, const DataType window[],
+                                                DataType scale)
+{
+    m_private->calculateLogMagnitude(bins, FFTRealPcm16Reader(pcm, stride, window),
+                                     scale);
+}
+
+void FFTRealWrapper::calculateFFTBatch(DataType in[], const DataType out[],
+                                       int frameCount)
+{
+    const int frameLength = length();
+    calculateFFTBatch(in, frameLength, out, frameLength, frameCount);
+}
+
+void FFTRealWrapper::calculateFFTBatch(DataType in[], int inStride,
+                                       const DataType out[], int outStride,
+                                       int frameCount)
+{
+    m_private->calculateFFTBatch(in, inStride, out, outStride, frameCount);
+}
+
+
+FFTRealGoertzelWrapper::FFTRealGoertzelWrapper(const qreal frequencies[], int count,
+                                               int sampleRate)
+    :   m_bank(0)
+    ,   m_sampleRate(sampleRate)
+{
+    Q_ASSERT(count > 0);
+    Q_ASSERT(sampleRate > 0);
+    std::vector<double> normalized(count);
+    for (int i = 0; i < count; ++i) {
+        Q_ASSERT(frequencies[i] >= 0 && frequencies[i] <= sampleRate / 2.0);
+        normalized[i] = frequencies[i] / sampleRate;
+    }
+    m_bank = new FFTRealGoertzel(&normalized[0], count);
+}
+
+FFTRealGoertzelWrapper::~FFTRealGoertzelWrapper()
+{
+    delete m_bank;
+}
+
+int FFTRealGoertzelWrapper::count() const
+{
+    return int(m_bank->get_nbr_filters());
+}
+
+qreal FFTRealGoertzelWrapper::frequency(int index) const
+{
+    return m_bank->get_freq(index) * m_sampleRate;
+}
+
+void FFTRealGoertzelWrapper::reset()
+{
+    m_bank->clear();
+}
+
+void FFTRealGoertzelWrapper::process(const DataType samples[], int count)
+{
+    m_bank->process_block(samples, count);
+}
+
+void FFTRealGoertzelWrapper::power(DataType power[]) const
+{
+    m_bank->get_power(power);
+}
+
+
+class FFTRealConvolverWrapperPrivate {
+public:
+    virtual ~FFTRealConvolverWrapperPrivate() { }
+
+    virtual int blockLength() const = 0;
+    virtual int filterLength() const = 0;
+    virtual void reset() = 0;
+    virtual void process(FFTRealWrapper::DataType out[],
+                         const FFTRealWrapper::DataType in[]) = 0;
+};
+
+template <int BlockLengthPowerOfTwo>
+class FFTRealConvolverWrapperImpl : public FFTRealConvolverWrapperPrivate {
+public:
+    FFTRealConvolverWrapperImpl(const FFTRealWrapper::DataType filter[], int filterLength)
+        :   m_convolver(filter, filterLength)
+    {
+
+    }
+
+    int blockLength() const
+    {
+        return FFTRealConvolver<BlockLengthPowerOfTwo>::BLOCK_LEN;
+    }
+
+    int filterLength() const
+    {
+        return m_convolver.get_filter_len();
+    }
+
+    void reset()
+    {
+        m_convolver.clear();
+    }
+
+    void process(FFTRealWrapper::DataType out[],
+                 const FFTRealWrapper::DataType in[])
+    {
+        m_convolver.process_block(out, in);
+    }
+
+private:
+    FFTRealConvolver<BlockLengthPowerOfTwo> m_convolver;
+};
+
+// The FFTs have twice the block length, so the FFTRealFixLen instances are
+// the same as the ones of FFTRealWrapper.
+static FFTRealConvolverWrapperPrivate *createConvolverPrivate(int blockLength,
+                                                              const FFTRealWrapper::DataType filter[],
+                                                              int filterLength)
+{
+    switch (lengthToPowerOfTwo(blockLength * 2)) {
+    case 8:  return new FFTRealConvolverWrapperImpl<7>(filter, filterLength);
+    case 9:  return new FFTRealConvolverWrapperImpl<8>(filter, filterLength);
+    case 10: return new FFTRealConvolverWrapperImpl<9>(filter, filterLength);
+    case 11: return new FFTRealConvolverWrapperImpl<10>(filter, filterLength);
+    case 12: return new FFTRealConvolverWrapperImpl<11>(filter, filterLength);
+    case 13: return new FFTRealConvolverWrapperImpl<12>(filter, filterLength);
+    case 14: return new FFTRealConvolverWrapperImpl<13>(filter, filterLength);
+    case 15: return new FFTRealConvolverWrapperImpl<14>(filter, filterLength);
+    case 16: return new FFTRealConvolverWrapperImpl<15>(filter, filterLength);
+    default: return 0;
+    }
+}
+
+FFTRealConvolverWrapper::FFTRealConvolverWrapper(FFTRealConvolverWrapperPrivate *d)
+    :   m_private(d)
+{
+
+}
+
+FFTRealConvolverWrapper::~FFTRealConvolverWrapper()
+{
+    delete m_private;
+}
+
+FFTRealConvolverWrapper *FFTRealConvolverWrapper::create(int blockLength,
+                                                         const DataType filter[],
+                                                         int filterLength)
+{
+    Q_ASSERT(filterLength > 0);
+    FFTRealConvolverWrapperPrivate *d = createConvolverPrivate(blockLength, filter,
+                                                               filterLength);
+    return d ? new FFTRealConvolverWrapper(d) : 0;
+}
+
+int FFTRealConvolverWrapper::blockLength() const
+{
+    return m_private->blockLength();
+}
+
+int FFTRealConvolverWrapper::filterLength() const
+{
+    return m_private->filterLength();
+}
+
+void FFTRealConvolverWrapper::reset()
+{
+    m_private->reset();
+}
+
+void FFTRealConvolverWrapper::process(DataType out[], const DataType in[])
+{
+    m_private->process(out, in);
 }
@@ -29,20 +29,38 @@
 #endif
 
 class FFTRealWrapperPrivate;
+class FFTRealGoertzel;
+class FFTRealConvolverWrapperPrivate;
 
 // Each pass of the FFT processes 2^X samples, where X is the
 // number below.
 static const int FFTLengthPowerOfTwo = 12;
 
+// Range of lengths for which the library contains an FFTRealFixLen
+// instantiation.  Other lengths within this range are supported too if
+// their only prime factors are 2, 3, 5 and 7.
+static const int FFTMinLengthPowerOfTwo = 8;
+static const int FFTMaxLengthPowerOfTwo = 16;
+
+// Longer powers of two, up to 2^X, are computed with the four-step
+// FFTRealFourStep, to transform whole recordings in one call.
+static const int FFTFourStepMaxLengthPowerOfTwo = 24;
+
 /**
  * Wrapper around the FFTRealFixLen template provided by the FFTReal
  * library
  *
- * This class instantiates a single instance of FFTRealFixLen, using
- * FFTLengthPowerOfTwo as the template parameter.  It then exposes
- * FFTRealFixLen<FFTLengthPowerOfTwo>::do_fft via the calculateFFT
- * function, thereby allowing an application to dynamically link
- * against the FFTReal implementation.
+ * The library contains instances of FFTRealFixLen for every length
+ * between 2^FFTMinLengthPowerOfTwo and 2^FFTMaxLengthPowerOfTwo.  The
+ * default constructor uses FFTLengthPowerOfTwo; create() selects one of
+ * the other instances at runtime, the four-step FFTRealFourStep for longer
+ * powers of two, or the mixed-radix FFTRealMixed for lengths which are not
+ * powers of two.  FFTRealFixLen<N>::do_fft is
+ * exposed via the calculateFFT function, thereby allowing an application
+ * to dynamically link against the FFTReal implementation.
+ *
+ * For a length N, calculateFFT() writes the real parts of bins 0 to N / 2
+ * followed by the negated imaginary parts of bins 1 to (N - 1) / 2.
  *
  * See http://ldesoras.free.fr/prod.html
  */
@@ -52,12 +70,184 @@ public:
     FFTRealWrapper();
     ~FFTRealWrapper();
 
+    /**
+     * Returns a wrapper for an FFT of the given number of samples, or 0
+     * if isSupportedLength(length) is false.
+     */
+    static FFTRealWrapper *create(int length);
+    static bool isSupportedLength(int length);
+
+    int length() const;
+
     typedef float DataType;
     void calculateFFT(DataType in[], const DataType out[]);
 
+    /**
+     * Linear correlations of count samples, computed with two or three FFTs
+     * of length() points instead of count * count multiplications.  The
+     * samples are padded with zeros, so count must not exceed length() / 2.
+     *
+     * autocorrelate() writes count lags:
+     *     out[k] = sum(in[n] * in[n + k]), 0 <= k < count
+     * crossCorrelate() writes 2 * count - 1 lags, the negative ones first:
+     *     out[count - 1 + k] = sum(a[n + k] * b[n]), -count < k < count
+     * so a peak at k > 0 means that a is late with respect to b.
+     */
+    void autocorrelate(DataType out[], const DataType in[], int count);
+    void crossCorrelate(DataType out[], const DataType a[], const DataType b[],
+                        int count);
+
+    /**
+     * Compute length() / 2 + 1 spectrum bins from length() samples,
+     * directly from the last pass of the FFT for powers of two: either
+     * the squared magnitude, or scale * ln(magnitude).  Use a scale of
+     * 20 / ln(10) to get decibels.
+     */
+    void calculatePowerSpectrum(DataType bins[], const DataType samples[]);
+    void calculateLogMagnitude(DataType bins[], const DataType samples[],
+                               DataType scale = 1);
+
+    /**
+     * Tell the forward transforms that only the first count input samples
+     * can be non-zero, the others being zero-padding.  The first FFT passes,
+     * which would only combine single samples with zeros, are then replaced
+     * by a copy, so a window of M samples padded to length() points costs
+     * about log2(M) passes instead of log2(length()).  Only used for the
+     * lengths between 2^FFTMinLengthPowerOfTwo and 2^FFTMaxLengthPowerOfTwo,
+     * and not by calculateFFTBatch().  The default is length().
+     */
+    void setInputLength(int count);
+    int inputLength() const;
+
+    /**
+     * Limit calculatePowerSpectrum() and the calculateLogMagnitude
+     * functions to bins 0 to bin, for applications which only show the
+     * low part of the spectrum.  The bins above are left undefined.  The
+     * FFT skips the butterflies which only feed these bins, so the cost
+     * decreases with the logarithm of bin.  The default is length() / 2,
+     * the whole spectrum.
+     */
+    void setMaxBin(int bin);
+    int maxBin() const;
+
+    /**
+     * Same as calculateFFT() and calculateLogMagnitude(), reading length()
+     * signed 16-bit little-endian PCM samples, stride bytes apart.  Each
+     * sample is scaled to [-1.0, 1.0) and multiplied by window[i] while the
+     * first FFT pass reads it, so no intermediate buffer is needed.
+     */
+    void calculateFFTPcm16(DataType out[], const char *pcm, int stride,
+                           const DataType window[]);
+    void calculateLogMagnitudePcm16(DataType bins[], const char *pcm, int stride,
+                                    const DataType window[], DataType scale = 1);
+
+    /**
+     * Transform frameCount frames in one call.  For powers of two, the
+     * frames are processed several at a time, one per SIMD lane, which is
+     * faster than calling calculateFFT() for each of them.  Frame i is
+     * read from out + i * outStride and written to in + i * inStride; the
+     * first overload uses contiguous frames.  Input frames may overlap, but
+     * must not overlap the output frames.
+     */
+    void calculateFFTBatch(DataType in[], const DataType out[], int frameCount);
+    void calculateFFTBatch(DataType in[], int inStride,
+                           const DataType out[], int outStride,
+                           int frameCount);
+
+private:
+    explicit FFTRealWrapper(FFTRealWrapperPrivate *d);
+    Q_DISABLE_COPY(FFTRealWrapper)
+
 private:
     FFTRealWrapperPrivate*  m_private;
 };
 
+/**
+ * Wrapper around the FFTRealGoertzel filter bank
+ *
+ * Measures the energy of a signal at a few arbitrary frequencies, for
+ * silence detection or pitch tracking, without computing a whole
+ * spectrum.  The filters are processed four at a time, one per SIMD lane,
+ * so the cost is about one multiply-add per filter and per sample.
+ */
+class FFTREAL_EXPORT FFTRealGoertzelWrapper
+{
+public:
+    typedef FFTRealWrapper::DataType DataType;
+
+    /**
+     * Create count filters, at the given frequencies in Hz.  Frequencies
+     * must lie between 0 and sampleRate / 2.
+     */
+    FFTRealGoertzelWrapper(const qreal frequencies[], int count, int sampleRate);
+    ~FFTRealGoertzelWrapper();
+
+    int count() const;
+    qreal frequency(int index) const;
+
+    /**
+     * Start a new analysis block.  process() may then be called several
+     * times; power() returns, for each filter, the squared magnitude of the
+     * DFT of all the samples given since reset().  For a frequency of
+     * k * sampleRate / N and N samples, this is the same value as bin k of
+     * FFTRealWrapper::calculatePowerSpectrum().
+     */
+    void reset();
+    void process(const DataType samples[], int count);
+    void power(DataType power[]) const;
+
+private:
+    Q_DISABLE_COPY(FFTRealGoertzelWrapper)
+
+private:
+    FFTRealGoertzel*        m_bank;
+    int                     m_sampleRate;
+};
+
+/**
+ * Wrapper around the FFTRealConvolver template
+ *
+ * Streams a signal through a long FIR filter by blocks of blockLength()
+ * samples, with a latency of one block.  Each block costs two FFTs of
+ * 2 * blockLength() points whatever the filter length, plus one spectrum
+ * multiply-add per blockLength() taps of the filter.  Block lengths are
+ * the powers of two from 2^(FFTMinLengthPowerOfTwo - 1) to
+ * 2^(FFTMaxLengthPowerOfTwo - 1).
+ */
+class FFTREAL_EXPORT FFTRealConvolverWrapper
+{
+public:
+    typedef FFTRealWrapper::DataType DataType;
+
+    /**
+     * Returns a convolver for the given impulse response, or 0 if the
+     * block length is not supported.
+     */
+    static FFTRealConvolverWrapper *create(int blockLength, const DataType filter[],
+                                           int filterLength);
+    ~FFTRealConvolverWrapper();
+
+    int blockLength() const;
+    int filterLength() const;
+
+    /**
+     * Forget the previous blocks, as if the stream was preceded by
+     * silence.
+     */
+    void reset();
+
+    /**
+     * Filter the next blockLength() samples of the stream.  out may be in.
+     */
+    void process(DataType out[], const DataType in[]);
+
+private:
+    explicit FFTRealConvolverWrapper(FFTRealConvolverWrapperPrivate *d);
+    Q_DISABLE_COPY(FFTRealConvolverWrapper)
+
+private:
+    FFTRealConvolverWrapperPrivate*  m_private;
+};
+
 #endif // FFTREAL_WRAPPER_H
 
@@ -0,0 +1,394 @@
+#!/usr/bin/env python3
+#
+#        gen_codelets.py
+#
+# Generates FFTRealCodelet.hpp: straight-line FFT and IFFT for 8 to 64
+# points. The passes of FFTReal are run on symbolic values, so the code has
+# exactly the same operations and output layout as the general case, with
+# the bit-reversal, the loops and the trigonometric table resolved here.
+# Multiplications by 0, 1 and -1 are removed and sign changes are folded
+# into the additions.
+#
+# Usage: python3 gen_codelets.py > FFTRealCodelet.hpp
+
+import math
+import sys
+
+MIN_BITS = 3
+MAX_BITS = 6
+
+
+class Codelet:
+    """Records the operations on the symbolic values of one transform.
+
+    A value is None (zero) or a (name, sign) pair, where name is an input
+    element or a temporary and sign is 1 or -1.
+    """
+
+    def __init__(self, type_name):
+        self.type_name = type_name
+        self.lines = []
+        self.cache = {}
+        self.nbr_temps = 0
+
+    def emit(self, expr):
+        if expr in self.cache:
+            return (self.cache[expr], 1)
+        name = 't_%d' % self.nbr_temps
+        self.nbr_temps += 1
+        self.lines.append((name, expr))
+        self.cache[expr] = name
+        return (name, 1)
+
+    def add(self, a, b):
+        if a is None:
+            return b
+        if b is None:
+            return a
+        (na, sa) = a
+        (nb, sb) = b
+        if sa == sb:
+            (na, nb) = sorted((na, nb))
+            (n, s) = self.emit('%s + %s' % (na, nb))
+            return (n, s * sa)
+        if sa > 0:
+            return self.emit('%s - %s' % (na, nb))
+        return self.emit('%s - %s' % (nb, na))
+
+    def neg(self, a):
+        if a is None:
+            return None
+        return (a[0], -a[1])
+
+    def sub(self, a, b):
+        return self.add(a, self.neg(b))
+
+    def mul(self, a, c):
+        if a is None or abs(c) < 1e-15:
+            return None
+        (na, sa) = a
+        if c < 0:
+            c = -c
+            sa = -sa
+        if abs(c - 1) < 1e-15:
+            return (na, sa)
+        if c == 2:
+            (n, s) = self.emit('%s * 2' % na)
+        else:
+            (n, s) = self.emit('%s * %s (%.20f)' % (na, self.type_name, c))
+        return (n, s * sa)
+
+    # (a * c - b * s, a * s + b * c)
+    def rotate(self, a, b, c, s):
+        if abs(c - s) < 1e-15:
+            return (self.mul(self.sub(a, b), c), self.mul(self.add(a, b), c))
+        return (
+            self.sub(self.mul(a, c), self.mul(b, s)),
+            self.add(self.mul(a, s), self.mul(b, c))
+        )
+
+
+def bit_reverse(i, nbr_bits):
+    r = 0
+    for b in range(nbr_bits):
+        r = (r << 1) | ((i >> b) & 1)
+    return r
+
+
+# Same as FFTReal::compute_fft_general ()
+def build_fft(cl, nbr_bits):
+    n = 1 << nbr_bits
+    x = [('x [%d]' % i, 1) for i in range(n)]
+
+    df = [None] * n
+    for ci in range(0, n, 4):
+        r = [bit_reverse(ci + k, nbr_bits) for k in range(4)]
+        df[ci + 1] = cl.sub(x[r[0]], x[r[1]])
+        df[ci + 3] = cl.sub(x[r[2]], x[r[3]])
+        sf_0 = cl.add(x[r[0]], x[r[1]])
+        sf_2 = cl.add(x[r[2]], x[r[3]])
+        df[ci] = cl.add(sf_0, sf_2)
+        df[ci + 2] = cl.sub(sf_0, sf_2)
+
+    sf = df
+    df = [None] * n
+    sqrt2_2 = math.sqrt(2) * 0.5
+    for ci in range(0, n, 8):
+        df[ci] = cl.add(sf[ci], sf[ci + 4])
+        df[ci + 4] = cl.sub(sf[ci], sf[ci + 4])
+        df[ci + 2] = sf[ci + 2]
+        df[ci + 6] = sf[ci + 6]
+        v = cl.mul(cl.sub(sf[ci + 5], sf[ci + 7]), sqrt2_2)
+        df[ci + 1] = cl.add(sf[ci + 1], v)
+        df[ci + 3] = cl.sub(sf[ci + 1], v)
+        v = cl.mul(cl.add(sf[ci + 5], sf[ci + 7]), sqrt2_2)
+        df[ci + 5] = cl.add(v, sf[ci + 3])
+        df[ci + 7] = cl.sub(v, sf[ci + 3])
+
+    for p in range(3, nbr_bits):
+        sf = df
+        df = [None] * n
+        nbr_coef = 1 << p
+        h_nbr_coef = nbr_coef >> 1
+        for ci in range(0, n, nbr_coef * 2):
+            r1 = ci
+            r2 = ci + nbr_coef
+            i1 = r1 + h_nbr_coef
+            i2 = r2 + h_nbr_coef
+            df[r1] = cl.add(sf[r1], sf[r2])
+            df[r2] = cl.sub(sf[r1], sf[r2])
+            df[r1 + h_nbr_coef] = sf[r1 + h_nbr_coef]
+            df[r2 + h_nbr_coef] = sf[r2 + h_nbr_coef]
+            for i in range(1, h_nbr_coef):
+                c = math.cos(i * math.pi / nbr_coef)
+                s = math.sin(i * math.pi / nbr_coef)
+                (v1, v2) = cl.rotate(sf[r2 + i], sf[i2 + i], c, s)
+                df[r1 + i] = cl.add(sf[r1 + i], v1)
+                df[r2 - i] = cl.sub(sf[r1 + i], v1)
+                df[r2 + i] = cl.add(v2, sf[i1 + i])
+                df[r2 + nbr_coef - i] = cl.sub(v2, sf[i1 + i])
+
+    return [('f [%d]' % i, df[i]) for i in range(n)]
+
+
+# Same as FFTReal::compute_ifft_general ()
+def build_ifft(cl, nbr_bits):
+    n = 1 << nbr_bits
+    sf = [('f [%d]' % i, 1) for i in range(n)]
+
+    for p in range(nbr_bits - 1, 2, -1):
+        df = [None] * n
+        nbr_coef = 1 << p
+        h_nbr_coef = nbr_coef >> 1
+        for ci in range(0, n, nbr_coef * 2):
+            r = ci
+            im = ci + nbr_coef
+            d1 = ci
+            d2 = ci + nbr_coef
+            df[d1] = cl.add(sf[r], sf[im])
+            df[d2] = cl.sub(sf[r], sf[im])
+            df[d1 + h_nbr_coef] = cl.mul(sf[r + h_nbr_coef], 2)
+            df[d2 + h_nbr_coef] = cl.mul(sf[im + h_nbr_coef], 2)
+            for i in range(1, h_nbr_coef):
+                df[d1 + i] = cl.add(sf[r + i], sf[im - i])
+                df[d1 + h_nbr_coef + i] = cl.sub(sf[im + i], sf[im + nbr_coef - i])
+                c = math.cos(i * math.pi / nbr_coef)
+                s = math.sin(i * math.pi / nbr_coef)
+                vr = cl.sub(sf[r + i], sf[im - i])
+                vi = cl.add(sf[im + i], sf[im + nbr_coef - i])
+                (a, b) = cl.rotate(vi, vr, c, s)
+                df[d2 + h_nbr_coef + i] = a
+                df[d2 + i] = b
+        sf = df
+
+    df = [None] * n
+    sqrt2_2 = math.sqrt(2) * 0.5
+    for ci in range(0, n, 8):
+        df[ci] = cl.add(sf[ci], sf[ci + 4])
+        df[ci + 4] = cl.sub(sf[ci], sf[ci + 4])
+        df[ci + 2] = cl.mul(sf[ci + 2], 2)
+        df[ci + 6] = cl.mul(sf[ci + 6], 2)
+        df[ci + 1] = cl.add(sf[ci + 1], sf[ci + 3])
+        df[ci + 3] = cl.sub(sf[ci + 5], sf[ci + 7])
+        vr = cl.sub(sf[ci + 1], sf[ci + 3])
+        vi = cl.add(sf[ci + 5], sf[ci + 7])
+        df[ci + 5] = cl.mul(cl.add(vr, vi), sqrt2_2)
+        df[ci + 7] = cl.mul(cl.sub(vi, vr), sqrt2_2)
+    sf = df
+
+    x = [None] * n
+    for ci in range(0, n, 4):
+        b_0 = cl.add(sf[ci], sf[ci + 2])
+        b_2 = cl.sub(sf[ci], sf[ci + 2])
+        b_1 = cl.mul(sf[ci + 1], 2)
+        b_3 = cl.mul(sf[ci + 3], 2)
+        x[bit_reverse(ci, nbr_bits)] = cl.add(b_0, b_1)
+        x[bit_reverse(ci + 1, nbr_bits)] = cl.sub(b_0, b_1)
+        x[bit_reverse(ci + 2, nbr_bits)] = cl.add(b_2, b_3)
+        x[bit_reverse(ci + 3, nbr_bits)] = cl.sub(b_2, b_3)
+
+    return [('x [%d]' % i, x[i]) for i in range(n)]
+
+
+def format_body(cl, outputs):
+    # Temporaries in the order of the passes, then the stores, so the source
+    # is never read after the destination has been written. Unused
+    # temporaries are dropped.
+    used = set()
+    for (dst, val) in outputs:
+        if val is not None:
+            used.add(val[0])
+    for (name, expr) in reversed(cl.lines):
+        if name in used:
+            for tok in expr.split():
+                if tok.startswith('t_'):
+                    used.add(tok)
+    out = []
+    for (name, expr) in cl.lines:
+        if name in used:
+            out.append('\tconst DT\t\t%s = %s;' % (name, expr))
+    out.append('')
+    for (dst, val) in outputs:
+        if val is None:
+            out.append('\t%s = 0;' % dst)
+        elif val[1] > 0:
+            out.append('\t%s = %s;' % (dst, val[0]))
+        else:
+            out.append('\t%s = -%s;' % (dst, val[0]))
+    return '\n'.join(out)
+
+
+HEADER = r'''/*****************************************************************************
+
+        FFTRealCodelet.hpp
+
+Generated by gen_codelets.py, do not edit.
+
+--- Legal stuff ---
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (FFTRealCodelet_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealCodelet code header.
+#endif
+#define	FFTRealCodelet_CURRENT_CODEHEADER
+
+#if ! defined (FFTRealCodelet_CODEHEADER_INCLUDED)
+#define	FFTRealCodelet_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// No codelet for this length
+template <>
+template <int LL2, class DT>
+bool	FFTRealCodeletUse <0>::do_fft (DT /*f*/ [], const DT /*x*/ [])
+{
+	return (false);
+}
+
+
+
+template <>
+template <int LL2, class DT>
+bool	FFTRealCodeletUse <0>::do_ifft (const DT /*f*/ [], DT /*x*/ [])
+{
+	return (false);
+}
+
+
+
+template <>
+template <int LL2, class DT>
+bool	FFTRealCodeletUse <1>::do_fft (DT f [], const DT x [])
+{
+	FFTRealCodelet <LL2>::do_fft (f, x);
+
+	return (true);
+}
+
+
+
+template <>
+template <int LL2, class DT>
+bool	FFTRealCodeletUse <1>::do_ifft (const DT f [], DT x [])
+{
+	FFTRealCodelet <LL2>::do_ifft (f, x);
+
+	return (true);
+}
+'''
+
+FOOTER = r'''
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+#endif	// FFTRealCodelet_CODEHEADER_INCLUDED
+
+#undef FFTRealCodelet_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+'''
+
+
+def main():
+    out = [HEADER]
+    for nbr_bits in range(MIN_BITS, MAX_BITS + 1):
+        n = 1 << nbr_bits
+
+        cl = Codelet('DT')
+        body = format_body(cl, build_fft(cl, nbr_bits))
+        out.append('''
+
+
+// %d-point FFT
+template <>
+template <class DT>
+void	FFTRealCodelet <%d>::do_fft (DT f [], const DT x [])
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+
+%s
+}
+''' % (n, nbr_bits, body))
+
+        cl = Codelet('DT')
+        body = format_body(cl, build_ifft(cl, nbr_bits))
+        out.append('''
+
+
+// %d-point IFFT
+template <>
+template <class DT>
+void	FFTRealCodelet <%d>::do_ifft (const DT f [], DT x [])
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+
+%s
+}
+''' % (n, nbr_bits, body))
+
+    out.append(FOOTER)
+    sys.stdout.write(''.join(out))
+
+
+if __name__ == '__main__':
+    main()
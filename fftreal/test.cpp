@@ -33,8 +33,22 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
 #include	"test_settings.h"
+#include	"FFTRealDct.h"
+#include	"FFTRealDctFixLen.h"
+#include	"FFTRealSimd.h"
+#include	"TestBatch.h"
+#include	"TestConvolver.h"
+#include	"TestCorrelation.h"
+#include	"TestDct.h"
+#include	"TestGoertzel.h"
 #include	"TestHelperFixLen.h"
+#include	"TestHelperFourStep.h"
+#include	"TestHelperMixed.h"
 #include	"TestHelperNormal.h"
+#include	"TestInputLen.h"
+#include	"TestPcm16.h"
+#include	"TestSlidingDft.h"
+#include	"TestSpectrum.h"
 
 #if defined (_MSC_VER)
 #include	<crtdbg.h>
@@ -56,6 +70,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 
 static int	TEST_perform_test_accuracy_all ();
+static void	TEST_perform_test_dct (int &ret_val);
+static void	TEST_perform_test_fix_len (int &ret_val);
 static int	TEST_perform_test_speed_all ();
 
 static void	TEST_prog_init ();
@@ -109,18 +125,114 @@ int	TEST_perform_test_accuracy_all ()
 
 	TestHelperNormal <float >::perform_test_accuracy (ret_val);
 	TestHelperNormal <double>::perform_test_accuracy (ret_val);
+	TestHelperNormal <float >::perform_test_thread_pool (ret_val);
+	TestHelperNormal <double>::perform_test_thread_pool (ret_val);
 
+	// FFTRealFixLen with each instruction set, the lesser ones being forced
+	// even when the CPU supports better
+	const FFTRealSimd::Isa	isa_arr [] =
+	{
+		FFTRealSimd::Isa_AVX2, FFTRealSimd::Isa_SSE2, FFTRealSimd::Isa_SCALAR
+	};
+	const char *	isa_name_arr [] = { "scalar", "SSE2", "AVX2" };	// By Isa value
+	const int		nbr_isa = sizeof (isa_arr) / sizeof (isa_arr [0]);
+	for (int k = 0; k < nbr_isa && ret_val == 0; ++k)
+	{
+		FFTRealSimd::set_isa_limit (isa_arr [k]);
+		printf ("Instruction set: %s\n\n", isa_name_arr [FFTRealSimd::get_isa ()]);
+		TEST_perform_test_fix_len (ret_val);
+	}
+	FFTRealSimd::set_isa_limit (FFTRealSimd::Isa_AVX2);
+
+	TestInputLen::perform_test (ret_val);
+
+	TestHelperMixed <float >::perform_test_accuracy (ret_val);
+	TestHelperMixed <double>::perform_test_accuracy (ret_val);
+
+	TestHelperFourStep <float >::perform_test_accuracy (ret_val);
+	TestHelperFourStep <double>::perform_test_accuracy (ret_val);
+
+	TestBatch::perform_test (ret_val);
+
+	TEST_perform_test_dct (ret_val);
+
+	TestSlidingDft <float >::perform_test (ret_val);
+	TestSlidingDft <double>::perform_test (ret_val);
+
+	TestGoertzel::perform_test (ret_val);
+
+	TestCorrelation::perform_test (ret_val);
+
+	TestConvolver::perform_test (ret_val);
+
+	return (ret_val);
+}
+
+
+
+void	TEST_perform_test_fix_len (int &ret_val)
+{
    TestHelperFixLen < 1>::perform_test_accuracy (ret_val);
    TestHelperFixLen < 2>::perform_test_accuracy (ret_val);
    TestHelperFixLen < 3>::perform_test_accuracy (ret_val);
    TestHelperFixLen < 4>::perform_test_accuracy (ret_val);
+   TestHelperFixLen < 5>::perform_test_accuracy (ret_val);
+   TestHelperFixLen < 6>::perform_test_accuracy (ret_val);
    TestHelperFixLen < 7>::perform_test_accuracy (ret_val);
    TestHelperFixLen < 8>::perform_test_accuracy (ret_val);
    TestHelperFixLen <10>::perform_test_accuracy (ret_val);
    TestHelperFixLen <12>::perform_test_accuracy (ret_val);
    TestHelperFixLen <13>::perform_test_accuracy (ret_val);
+   TestHelperFixLen <16>::perform_test_accuracy (ret_val);
+
+	// Fallback on do_fft () up to 2^3, SIMD last pass up to 2^12, oscillators
+	// above
+	TestSpectrum < 1>::perform_test (ret_val);
+	TestSpectrum < 3>::perform_test (ret_val);
+	TestSpectrum < 4>::perform_test (ret_val);
+	TestSpectrum < 6>::perform_test (ret_val);
+	TestSpectrum < 8>::perform_test (ret_val);
+	TestSpectrum <12>::perform_test (ret_val);
+	TestSpectrum <13>::perform_test (ret_val);
+	TestSpectrum <14>::perform_test (ret_val);
+
+	// Conversion in a copy up to 2^2, in the scalar first pass at 2^3, in the
+	// SIMD one above
+	TestPcm16 < 2>::perform_test (ret_val);
+	TestPcm16 < 3>::perform_test (ret_val);
+	TestPcm16 < 4>::perform_test (ret_val);
+	TestPcm16 <10>::perform_test (ret_val);
+	TestPcm16 <13>::perform_test (ret_val);
+}
 
-	return (ret_val);
+
+
+void	TEST_perform_test_dct (int &ret_val)
+{
+	const int		len_arr [] = { 2, 4, 8, 10 };
+	const int		nbr_len = sizeof (len_arr) / sizeof (len_arr [0]);
+	for (int k = 0; k < nbr_len && ret_val == 0; ++k)
+	{
+		const long		len = 1L << (len_arr [k]);
+		FFTRealDct <float>	dct_f (len);
+		ret_val = TestDct <FFTRealDct <float> >::perform_test_single_object (dct_f);
+		if (ret_val == 0)
+		{
+			FFTRealDct <double>	dct_d (len);
+			ret_val = TestDct <FFTRealDct <double> >::perform_test_single_object (dct_d);
+		}
+	}
+
+	if (ret_val == 0)
+	{
+		FFTRealDctFixLen <3>	dct;
+		ret_val = TestDct <FFTRealDctFixLen <3> >::perform_test_single_object (dct);
+	}
+	if (ret_val == 0)
+	{
+		FFTRealDctFixLen <9>	dct;
+		ret_val = TestDct <FFTRealDctFixLen <9> >::perform_test_single_object (dct);
+	}
 }
 
 
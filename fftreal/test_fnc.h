@@ -40,6 +40,9 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 template <class T>
 inline T	limit (const T &x, const T &inf, const T &sup);
 
+template <class T>
+inline double	compute_rel_err (const T x_ptr [], const T ref_ptr [], long len);
+
 
 
 #include	"test_fnc.hpp"
@@ -35,6 +35,9 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
+#include	<cassert>
+#include	<cmath>
+
 
 
 template <class T>
@@ -47,6 +50,35 @@ T	limit (const T &x, const T &inf, const T &sup)
 
 
 
+// RMS of the difference, relative to the RMS of the reference
+template <class T>
+double	compute_rel_err (const T x_ptr [], const T ref_ptr [], long len)
+{
+	assert (x_ptr != 0);
+	assert (ref_ptr != 0);
+	assert (len > 0);
+
+	double			power_ref = 0;
+	double			power_dif = 0;
+	for (long pos = 0; pos < len; ++pos)
+	{
+		const double	ref = ref_ptr [pos];
+		const double	dif = x_ptr [pos] - ref;
+		power_ref += ref * ref;
+		power_dif += dif * dif;
+	}
+	if (power_ref == 0)
+	{
+		power_ref = 1;
+	}
+
+	using namespace std;
+
+	return (sqrt (power_dif / power_ref));
+}
+
+
+
 #endif	// test_fnc_CODEHEADER_INCLUDED
 
 #undef test_fnc_CURRENT_CODEHEADER
@@ -36,6 +36,9 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 // #undef this label to avoid speed test compilation.
 #define	test_settings_SPEED_TEST_ENABLED
 
+// #undef this label to build the tests without Qt and fftreal_wrapper.cpp.
+#define	test_settings_WRAPPER_TEST_ENABLED
+
 
 
 #endif	// test_settings_HEADER_INCLUDED